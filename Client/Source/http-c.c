@@ -173,6 +173,8 @@ void  HTTPc_Init (const  HTTPc_CFG       *p_cfg,
 
         HTTPc_CfgPtr = p_cfg;                                   /* Set global Cfg pointer variable.                     */
 
+        HTTP_Dict_Init();                                       /* Build hdr field dictionary idx.                      */
+
 
 #ifdef HTTPc_TASK_MODULE_EN
         HTTPc_Mem_TaskMsgPoolInit(p_cfg, p_mem_seg, p_err);
@@ -38,6 +38,103 @@
 #include  "http_dict.h"
 
 
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  HTTP_STR_WORD_OCTET_LSB                 0x01010101u
+#define  HTTP_STR_WORD_OCTET_MSB                 0x80808080u
+
+#define  HTTP_STR_DELIM_CHAR_MAX                         64u    /* All delimiters are lower than '@' (0x40).            */
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                             LOCAL MACROS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                       HTTP_STR_WORD_HAS_ZERO()
+*
+* Description : Check if a 32-bit word contains a zero octet.
+*
+* Argument(s) : word        Word to check.
+*
+* Return(s)   : Non-zero value, if the word contains at least one zero octet.
+*               0,              otherwise.
+*
+* Caller(s)   : HTTP_StrDelimSrch().
+*
+* Note(s)     : (1) The result is exact on whether the word contains a zero octet, but the marked octets
+*                   located after the first zero octet are not meaningful.
+*********************************************************************************************************
+*/
+
+#define  HTTP_STR_WORD_HAS_ZERO(word)          ((((word) - HTTP_STR_WORD_OCTET_LSB) & ~(word)) & HTTP_STR_WORD_OCTET_MSB)
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                        LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+                                                                /* Delimiter char of each HTTP_STR_DELIM bit.           */
+static  const  CPU_CHAR  HTTP_StrDelimCharTbl[HTTP_STR_DELIM_NBR] = {
+    ASCII_CHAR_NULL,
+    ASCII_CHAR_CARRIAGE_RETURN,
+    ASCII_CHAR_LINE_FEED,
+    ASCII_CHAR_SPACE,
+    ASCII_CHAR_COLON,
+    ASCII_CHAR_QUESTION_MARK,
+    ASCII_CHAR_AMPERSAND,
+    ASCII_CHAR_EQUALS_SIGN,
+    ASCII_CHAR_PERCENTAGE_SIGN,
+    ASCII_CHAR_PLUS_SIGN
+};
+
+                                                                /* Delimiter set of each char below '@', matching ...   */
+                                                                /* ... HTTP_StrDelimCharTbl.                            */
+static  const  HTTP_STR_DELIM  HTTP_StrDelimSetTbl[HTTP_STR_DELIM_CHAR_MAX] = {
+                                                                /* 0x00 - 0x07.                                         */
+    HTTP_STR_DELIM_NULL, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+                                                                /* 0x08 - 0x0F.                                         */
+    0u, 0u, HTTP_STR_DELIM_LF, 0u, 0u, HTTP_STR_DELIM_CR, 0u, 0u,
+                                                                /* 0x10 - 0x17.                                         */
+    0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+                                                                /* 0x18 - 0x1F.                                         */
+    0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+                                                                /* 0x20 - 0x27.                                         */
+    HTTP_STR_DELIM_SPACE, 0u, 0u, 0u, 0u, HTTP_STR_DELIM_PERCENTAGE_SIGN, HTTP_STR_DELIM_AMPERSAND, 0u,
+                                                                /* 0x28 - 0x2F.                                         */
+    0u, 0u, 0u, HTTP_STR_DELIM_PLUS_SIGN, 0u, 0u, 0u, 0u,
+                                                                /* 0x30 - 0x37.                                         */
+    0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u,
+                                                                /* 0x38 - 0x3F.                                         */
+    0u, 0u, HTTP_STR_DELIM_COLON, 0u, 0u, HTTP_STR_DELIM_EQUALS_SIGN, 0u, HTTP_STR_DELIM_QUESTION_MARK
+};
+
+                                                                /* Names of the week days, from Sunday.                 */
+static  const  CPU_CHAR  HTTP_StrDateDayTbl[7][4] = {
+    "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"
+};
+
+                                                                /* Names of the months, from January.                   */
+static  const  CPU_CHAR  HTTP_StrDateMonthTbl[12][4] = {
+    "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"
+};
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -58,6 +155,10 @@ static  CPU_INT08U   HTTP_StrSizeHexDigReq (       CPU_INT32U   nbr);
 static  CPU_CHAR    *HTTP_StrFileExtGet    (       CPU_CHAR    *p_file_name,
                                                    CPU_SIZE_T   path_len);
 
+static  CPU_BOOLEAN  HTTP_StrDecNbrGet     (const  CPU_CHAR    *p_str,
+                                                   CPU_INT08U   nbr_dig,
+                                                   CPU_INT16U  *p_nbr);
+
 
 /*
 *********************************************************************************************************
@@ -113,7 +214,9 @@ CPU_CHAR  *HTTP_HdrParseFieldValueGet (CPU_CHAR    *p_field,
     p_val     =  p_field + field_len;
     len       = (p_field_end - p_val);
 
-    p_val     =  Str_Char_N(p_val, len, ASCII_CHAR_COLON);      /* Field val located after ':' (see Note #1a).          */
+    p_val     =  HTTP_StrDelimSrch(p_val,                       /* Field val located after ':' (see Note #1a).          */
+                                   len,
+                                  (HTTP_STR_DELIM_COLON | HTTP_STR_DELIM_NULL));
     p_val++;
 
     len       = (p_field_end - p_val);
@@ -168,6 +271,168 @@ CPU_CHAR  *HTTP_StrGraphSrchFirst (CPU_CHAR    *p_str,
 }
 
 
+/*
+*********************************************************************************************************
+*                                         HTTP_StrDelimSrch()
+*
+* Description : Search a string for the first occurrence of any delimiter of a set.
+*
+* Argument(s) : p_str       Pointer to the string to search.
+*
+*               str_len     Maximum number of characters to search.
+*
+*               delim_set   Set of delimiters to search for (see 'http.h  STRING DELIMITER DEFINES') :
+*
+*                               HTTP_STR_DELIM_NULL             Stop the search on a NULL character.
+*                               HTTP_STR_DELIM_CR               Carriage return.
+*                               HTTP_STR_DELIM_LF               Line feed.
+*                               HTTP_STR_DELIM_SPACE            Space.
+*                               HTTP_STR_DELIM_COLON            Colon (':').
+*                               HTTP_STR_DELIM_QUESTION_MARK    Question mark ('?').
+*                               HTTP_STR_DELIM_AMPERSAND        Ampersand ('&').
+*                               HTTP_STR_DELIM_EQUALS_SIGN      Equals sign ('=').
+*                               HTTP_STR_DELIM_PERCENTAGE_SIGN  Percentage sign ('%').
+*                               HTTP_STR_DELIM_PLUS_SIGN        Plus sign ('+').
+*
+* Return(s)   : Pointer to the first delimiter found, if any.
+*
+*               DEF_NULL,                               otherwise.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : (1) The string is searched one 32-bit word at a time, so that the callers can find all the
+*                   delimiters they look for in a single pass :
+*
+*                   (a) Each delimiter of the set is replicated in every octet of a pattern word. A word of
+*                       the string contains the delimiter if the word XOR the pattern contains a zero octet.
+*
+*                   (b) The first word that contains a delimiter is searched one character at a time, as
+*                       are the unaligned characters at the beginning and at the end of the string.
+*
+*               (2) See 'http.h  STRING DELIMITER DEFINES  Note #2'.
+*********************************************************************************************************
+*/
+
+CPU_CHAR  *HTTP_StrDelimSrch (const  CPU_CHAR        *p_str,
+                                     CPU_SIZE_T       str_len,
+                                     HTTP_STR_DELIM   delim_set)
+{
+    const  CPU_CHAR        *p_char;
+    const  CPU_INT32U      *p_word;
+           CPU_INT32U       pattern_tbl[HTTP_STR_DELIM_NBR];
+           CPU_INT32U       word;
+           CPU_INT32U       match;
+           CPU_INT08U       pattern_nbr;
+           CPU_INT08U       ix;
+           CPU_INT08U       char_val;
+
+
+                                                                /* ------------ BUILD PATTERNS (see Note #1a) --------- */
+    pattern_nbr = 0u;
+    for (ix = 0u; ix < HTTP_STR_DELIM_NBR; ix++) {
+        if (DEF_BIT_IS_SET(delim_set, DEF_BIT(ix)) == DEF_YES) {
+            pattern_tbl[pattern_nbr] = (CPU_INT32U)(CPU_INT08U)HTTP_StrDelimCharTbl[ix] * HTTP_STR_WORD_OCTET_LSB;
+            pattern_nbr++;
+        }
+    }
+
+    p_char = p_str;
+                                                                /* ------------- SRCH UNALIGNED FIRST CHAR ------------ */
+    while ((str_len                                    >  0u) &&
+           (((CPU_ADDR)p_char % sizeof(CPU_INT32U))    != 0u)) {
+        char_val = (CPU_INT08U)*p_char;
+        if ((char_val                                       <  HTTP_STR_DELIM_CHAR_MAX) &&
+            ((HTTP_StrDelimSetTbl[char_val] & delim_set)    != 0u)) {
+            goto exit_found;
+        }
+        p_char++;
+        str_len--;
+    }
+                                                                /* ---------------- SRCH ALIGNED WORDS ---------------- */
+    p_word = (const CPU_INT32U *)p_char;
+    while (str_len >= sizeof(CPU_INT32U)) {
+        word  = *p_word;
+        match =  0u;
+        for (ix = 0u; ix < pattern_nbr; ix++) {
+            match |= HTTP_STR_WORD_HAS_ZERO(word ^ pattern_tbl[ix]);
+        }
+        if (match != 0u) {                                      /* Locate the delimiter in the word (see Note #1b).     */
+            break;
+        }
+        p_word++;
+        str_len -= sizeof(CPU_INT32U);
+    }
+                                                                /* -------------- SRCH REMAINING CHAR ----------------- */
+    p_char = (const CPU_CHAR *)p_word;
+    while (str_len > 0u) {
+        char_val = (CPU_INT08U)*p_char;
+        if ((char_val                                       <  HTTP_STR_DELIM_CHAR_MAX) &&
+            ((HTTP_StrDelimSetTbl[char_val] & delim_set)    != 0u)) {
+            goto exit_found;
+        }
+        p_char++;
+        str_len--;
+    }
+
+    return (DEF_NULL);
+
+
+exit_found:
+    if (*p_char == ASCII_CHAR_NULL) {                           /* See Note #2.                                         */
+        return (DEF_NULL);
+    }
+
+    return ((CPU_CHAR *)p_char);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         HTTP_StrCRLF_Srch()
+*
+* Description : Search a string for the first CRLF sequence.
+*
+* Argument(s) : p_str       Pointer to the string to search.
+*
+*               str_len     Maximum number of characters to search.
+*
+* Return(s)   : Pointer to the CRLF sequence, if found.
+*
+*               DEF_NULL,                     otherwise.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : (1) Same result as Str_Str_N(p_str, STR_CR_LF, str_len) : the search stops at the first NULL
+*                   character and the whole sequence MUST be within the searched length.
+*********************************************************************************************************
+*/
+
+CPU_CHAR  *HTTP_StrCRLF_Srch (const  CPU_CHAR    *p_str,
+                                     CPU_SIZE_T   str_len)
+{
+    CPU_CHAR  *p_cr;
+
+
+    while (str_len >= 2u) {
+        p_cr = HTTP_StrDelimSrch(p_str,
+                                 str_len - 1u,
+                                (HTTP_STR_DELIM_CR | HTTP_STR_DELIM_NULL));
+        if (p_cr == DEF_NULL) {
+            break;
+        }
+
+        if (p_cr[1] == ASCII_CHAR_LINE_FEED) {
+            return (p_cr);
+        }
+
+        str_len -= (p_cr - p_str) + 1u;                         /* Lone CR: srch after it.                              */
+        p_str    =  p_cr + 1;
+    }
+
+    return (DEF_NULL);
+}
+
+
 /*
 *********************************************************************************************************
 *                                         HTTP_URL_EncodeStr()
@@ -311,7 +576,10 @@ exit:
 *
 * Caller(s)   : Various.
 *
-* Note(s)     : None.
+* Note(s)     : (1) The source & destination strings MUST NOT overlap.
+*
+*               (2) The characters located before the next '%' or '+' don't need decoding and are copied in
+*                   a single block.
 *********************************************************************************************************
 */
 
@@ -319,15 +587,37 @@ CPU_BOOLEAN  HTTP_URL_DecodeStr (const  CPU_CHAR    *p_str_src,
                                         CPU_CHAR    *p_str_dest,
                                         CPU_SIZE_T  *p_str_len)
 {
-    CPU_CHAR     char_tmp;
-    CPU_INT16U   len;
-    CPU_INT16U   len_copy;
-    CPU_BOOLEAN  result;
+    const  CPU_CHAR     *p_delim;
+           CPU_CHAR      char_tmp;
+           CPU_INT16U    len;
+           CPU_INT16U    len_copy;
+           CPU_SIZE_T    len_blk;
+           CPU_BOOLEAN   result;
 
 
     len_copy = 0;
 
     for (len = 0u; len < *p_str_len; len++) {
+                                                                /* Copy chars that don't need decoding (see Note #2).   */
+        p_delim = HTTP_StrDelimSrch(p_str_src,
+                                   *p_str_len - len,
+                                   (HTTP_STR_DELIM_PERCENTAGE_SIGN | HTTP_STR_DELIM_PLUS_SIGN));
+        if (p_delim == DEF_NULL) {
+            len_blk = *p_str_len - len;
+        } else {
+            len_blk = p_delim - p_str_src;
+        }
+        if (len_blk > 0u) {
+            Mem_Copy(p_str_dest, p_str_src, len_blk);
+            p_str_src  += len_blk;
+            p_str_dest += len_blk;
+            len_copy   += len_blk;
+            len        += len_blk;
+            if (len >= *p_str_len) {
+                break;
+            }
+        }
+
         if (*p_str_src == ASCII_CHAR_PERCENTAGE_SIGN) {
              char_tmp = HTTP_StrHexToChar(p_str_src);
              if (char_tmp != ASCII_CHAR_NULL) {
@@ -595,6 +885,250 @@ CPU_INT08U  HTTP_StrSizeHexDigReq (CPU_INT32U  nbr)
 }
 
 
+/*
+*********************************************************************************************************
+*                                            HTTP_DateToTS()
+*
+* Description : Convert a date to a number of seconds since January 1st 1970, 00:00:00 GMT.
+*
+* Argument(s) : yr          Year  (HTTP_DATE_YR_MIN to HTTP_DATE_YR_MAX).
+*
+*               month       Month (1 to 12).
+*
+*               day         Day   (1 to 31).
+*
+*               hr          Hour  (0 to 23).
+*
+*               min         Minutes (0 to 59).
+*
+*               sec         Seconds (0 to 60).
+*
+*               p_ts        Pointer to variable that will receive the number of seconds.
+*
+* Return(s)   : DEF_OK,   if the date is valid.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : HTTP_StrDateParse(),
+*               Various.
+*
+* Note(s)     : (1) The number of days is computed on years beginning in March, so that the leap day is the
+*                   last day of its year.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  HTTP_DateToTS (CPU_INT16U   yr,
+                            CPU_INT16U   month,
+                            CPU_INT16U   day,
+                            CPU_INT16U   hr,
+                            CPU_INT16U   min,
+                            CPU_INT16U   sec,
+                            CPU_INT32U  *p_ts)
+{
+    CPU_INT32U  yr_mar;
+    CPU_INT32U  day_of_yr;
+    CPU_INT32U  days;
+
+
+    if ((yr    <  HTTP_DATE_YR_MIN) ||
+        (yr    >  HTTP_DATE_YR_MAX) ||
+        (month <  1u)               ||
+        (month > 12u)               ||
+        (day   <  1u)               ||
+        (day   > 31u)               ||
+        (hr    > 23u)               ||
+        (min   > 59u)               ||
+        (sec   > 60u)) {
+        return (DEF_FAIL);
+    }
+                                                                /* See Note #1.                                         */
+    yr_mar    = (month <= 2u) ? (yr - 1u) : yr;
+    day_of_yr = (((153u * ((month > 2u) ? (month - 3u) : (month + 9u))) + 2u) / 5u) + (day - 1u);
+    days      = (yr_mar * 365u) + (yr_mar / 4u) - (yr_mar / 100u) + (yr_mar / 400u) + day_of_yr;
+    days     -=  719468u;                                       /* Days from 0000-03-01 to 1970-01-01.                  */
+
+   *p_ts = (days * 86400u) + (hr * 3600u) + (min * 60u) + sec;
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           HTTP_StrDateWr()
+*
+* Description : Write a date in the IMF-fixdate format.
+*
+* Argument(s) : ts          Number of seconds since January 1st 1970, 00:00:00 GMT.
+*
+*               p_buf       Pointer to buffer in which to write the date.
+*
+*               buf_len     Buffer length remaining.
+*
+* Return(s)   : Pointer to end of written date in buffer, if no error(s).
+*
+*               DEF_NULL,                                 otherwise.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : (1) See 'http.h  DATE STRING DEFINES  Note #1'.
+*
+*               (2) January 1st 1970 is a Thursday.
+*********************************************************************************************************
+*/
+
+CPU_CHAR  *HTTP_StrDateWr (CPU_INT32U   ts,
+                           CPU_CHAR    *p_buf,
+                           CPU_SIZE_T   buf_len)
+{
+    CPU_CHAR    *p_str;
+    CPU_INT32U   days;
+    CPU_INT32U   sec_of_day;
+    CPU_INT32U   day_of_era;
+    CPU_INT32U   yr_of_era;
+    CPU_INT32U   day_of_yr;
+    CPU_INT32U   month_mar;
+    CPU_INT32U   yr;
+    CPU_INT32U   month;
+    CPU_INT32U   day;
+
+
+    if (buf_len < HTTP_STR_DATE_LEN) {
+        return (DEF_NULL);
+    }
+
+    days       = ts / 86400u;
+    sec_of_day = ts % 86400u;
+                                                                /* Civil date from the days since 0000-03-01.           */
+    day_of_era = days + 719468u;
+    yr         = (day_of_era / 146097u) * 400u;
+    day_of_era =  day_of_era % 146097u;
+    yr_of_era  = (day_of_era - (day_of_era / 1460u) + (day_of_era / 36524u) - (day_of_era / 146096u)) / 365u;
+    day_of_yr  =  day_of_era - ((365u * yr_of_era) + (yr_of_era / 4u) - (yr_of_era / 100u));
+    month_mar  = ((5u * day_of_yr) + 2u) / 153u;
+    day        =  day_of_yr - (((153u * month_mar) + 2u) / 5u) + 1u;
+    month      = (month_mar < 10u) ? (month_mar + 3u) : (month_mar - 9u);
+    yr        +=  yr_of_era + ((month <= 2u) ? 1u : 0u);
+
+    p_str = p_buf;
+                                                                /* Wr "Sun, 06 Nov 1994 08:49:37 GMT" (see Note #1).    */
+   (void)Str_Copy_N(p_str, HTTP_StrDateDayTbl[(days + 4u) % 7u], 3u);   /* See Note #2.                         */
+    p_str   += 3u;
+   *p_str++  = ASCII_CHAR_COMMA;
+   *p_str++  = ASCII_CHAR_SPACE;
+   (void)Str_FmtNbr_Int32U(day,   2u, DEF_NBR_BASE_DEC, '0', DEF_NO, DEF_NO, p_str);
+    p_str   += 2u;
+   *p_str++  = ASCII_CHAR_SPACE;
+   (void)Str_Copy_N(p_str, HTTP_StrDateMonthTbl[month - 1u], 3u);
+    p_str   += 3u;
+   *p_str++  = ASCII_CHAR_SPACE;
+   (void)Str_FmtNbr_Int32U(yr,    4u, DEF_NBR_BASE_DEC, '0', DEF_NO, DEF_NO, p_str);
+    p_str   += 4u;
+   *p_str++  = ASCII_CHAR_SPACE;
+   (void)Str_FmtNbr_Int32U(sec_of_day / 3600u,        2u, DEF_NBR_BASE_DEC, '0', DEF_NO, DEF_NO, p_str);
+    p_str   += 2u;
+   *p_str++  = ASCII_CHAR_COLON;
+   (void)Str_FmtNbr_Int32U((sec_of_day / 60u) % 60u,  2u, DEF_NBR_BASE_DEC, '0', DEF_NO, DEF_NO, p_str);
+    p_str   += 2u;
+   *p_str++  = ASCII_CHAR_COLON;
+   (void)Str_FmtNbr_Int32U(sec_of_day % 60u,          2u, DEF_NBR_BASE_DEC, '0', DEF_NO, DEF_NO, p_str);
+    p_str   += 2u;
+   (void)Str_Copy_N(p_str, " GMT", 4u);
+    p_str   += 4u;
+
+    return (p_str);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          HTTP_StrDateParse()
+*
+* Description : Parse a date in the IMF-fixdate format.
+*
+* Argument(s) : p_str       Pointer to the date string.
+*
+*               str_len     Length of the string.
+*
+*               p_ts        Pointer to variable that will receive the number of seconds since January 1st 1970,
+*                           00:00:00 GMT.
+*
+* Return(s)   : DEF_OK,   if the date is valid.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : (1) RFC #7231, Section 7.1.1.1 states that a recipient should also accept the obsolete
+*                   rfc850-date & asctime-date formats. Those are not sent by current clients & are reported
+*                   as invalid, so that the caller processes the request as if the date was absent.
+*
+*               (2) The day name is not validated since it is redundant with the date.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  HTTP_StrDateParse (const  CPU_CHAR    *p_str,
+                                       CPU_SIZE_T   str_len,
+                                       CPU_INT32U  *p_ts)
+{
+    CPU_INT16U   day;
+    CPU_INT16U   month;
+    CPU_INT16U   yr;
+    CPU_INT16U   hr;
+    CPU_INT16U   min;
+    CPU_INT16U   sec;
+    CPU_INT16S   cmp_val;
+    CPU_BOOLEAN  valid;
+
+
+    while ((str_len > 0u) &&
+           ((*p_str == ASCII_CHAR_SPACE) || (*p_str == ASCII_CHAR_CHARACTER_TABULATION))) {
+        p_str++;
+        str_len--;
+    }
+                                                                /* Validate IMF-fixdate format (see Note #1).           */
+    if ((str_len  <  HTTP_STR_DATE_LEN) ||
+        (p_str[3] != ASCII_CHAR_COMMA)  ||
+        (p_str[4] != ASCII_CHAR_SPACE)  ||
+        (p_str[7] != ASCII_CHAR_SPACE)  ||
+        (p_str[11] != ASCII_CHAR_SPACE) ||
+        (p_str[16] != ASCII_CHAR_SPACE) ||
+        (p_str[19] != ASCII_CHAR_COLON) ||
+        (p_str[22] != ASCII_CHAR_COLON) ||
+        (p_str[25] != ASCII_CHAR_SPACE)) {
+        return (DEF_FAIL);
+    }
+
+    cmp_val = Str_Cmp_N(&p_str[26], "GMT", 3u);
+    if (cmp_val != 0) {
+        return (DEF_FAIL);
+    }
+
+    for (month = 0u; month < 12u; month++) {
+        cmp_val = Str_Cmp_N(&p_str[8], HTTP_StrDateMonthTbl[month], 3u);
+        if (cmp_val == 0) {
+            break;
+        }
+    }
+    if (month >= 12u) {
+        return (DEF_FAIL);
+    }
+
+    valid = HTTP_StrDecNbrGet(&p_str[5],  2u, &day);
+    valid = valid && HTTP_StrDecNbrGet(&p_str[12], 4u, &yr);
+    valid = valid && HTTP_StrDecNbrGet(&p_str[17], 2u, &hr);
+    valid = valid && HTTP_StrDecNbrGet(&p_str[20], 2u, &min);
+    valid = valid && HTTP_StrDecNbrGet(&p_str[23], 2u, &sec);
+    if (valid != DEF_YES) {
+        return (DEF_FAIL);
+    }
+
+    valid = HTTP_DateToTS(yr, month + 1u, day, hr, min, sec, p_ts);
+
+    return (valid);
+}
+
+
 /*
 *********************************************************************************************************
 *                                   HTTP_GetContentTypeFromFileExt()
@@ -647,6 +1181,51 @@ HTTP_CONTENT_TYPE  HTTP_GetContentTypeFromFileExt (CPU_CHAR   *p_file_path,
 *********************************************************************************************************
 */
 
+/*
+*********************************************************************************************************
+*                                          HTTP_StrDecNbrGet()
+*
+* Description : Get a number written with a fixed number of decimal digits.
+*
+* Argument(s) : p_str       Pointer to the first digit.
+*
+*               nbr_dig     Number of digits.
+*
+*               p_nbr       Pointer to variable that will receive the number.
+*
+* Return(s)   : DEF_OK,   if all the characters are digits.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : HTTP_StrDateParse().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  HTTP_StrDecNbrGet (const  CPU_CHAR    *p_str,
+                                               CPU_INT08U   nbr_dig,
+                                               CPU_INT16U  *p_nbr)
+{
+    CPU_INT16U  nbr;
+
+
+    nbr = 0u;
+    while (nbr_dig > 0u) {
+        if (ASCII_IS_DIG(*p_str) != DEF_YES) {
+            return (DEF_FAIL);
+        }
+        nbr = (nbr * 10u) + (*p_str - ASCII_CHAR_DIGIT_ZERO);
+        p_str++;
+        nbr_dig--;
+    }
+
+   *p_nbr = nbr;
+
+    return (DEF_OK);
+}
+
+
 /*
 *********************************************************************************************************
 *                                          HTTP_CharToStrHex()
@@ -114,6 +114,50 @@
 #define  HTTP_INT_16U_HEX_STR_LEN_MAX         4u
 
 
+/*
+*********************************************************************************************************
+*                                         DATE STRING DEFINES
+*
+* Note(s) : (1) Dates are written & parsed in the IMF-fixdate format of RFC #7231, Section 7.1.1.1 :
+*
+*                   Sun, 06 Nov 1994 08:49:37 GMT
+*
+*           (2) Dates are converted in seconds since January 1st 1970, 00:00:00 GMT, on 32 bits. Years are
+*               thus limited to the 1970 to 2105 range.
+*********************************************************************************************************
+*/
+
+#define  HTTP_STR_DATE_LEN                   29u                /* See Note #1.                                         */
+
+#define  HTTP_DATE_YR_MIN                  1970u                /* See Note #2.                                         */
+#define  HTTP_DATE_YR_MAX                  2105u
+
+
+/*
+*********************************************************************************************************
+*                                     STRING DELIMITER DEFINES
+*
+* Note(s) : (1) Delimiter sets passed to HTTP_StrDelimSrch().
+*
+*           (2) When HTTP_STR_DELIM_NULL is part of the set, the search stops at the first NULL character
+*               and returns a NULL pointer, like Str_Char_N() does.
+*********************************************************************************************************
+*/
+
+#define  HTTP_STR_DELIM_NULL                   DEF_BIT_00       /* See Note #2.                                         */
+#define  HTTP_STR_DELIM_CR                     DEF_BIT_01
+#define  HTTP_STR_DELIM_LF                     DEF_BIT_02
+#define  HTTP_STR_DELIM_SPACE                  DEF_BIT_03
+#define  HTTP_STR_DELIM_COLON                  DEF_BIT_04
+#define  HTTP_STR_DELIM_QUESTION_MARK          DEF_BIT_05
+#define  HTTP_STR_DELIM_AMPERSAND              DEF_BIT_06
+#define  HTTP_STR_DELIM_EQUALS_SIGN            DEF_BIT_07
+#define  HTTP_STR_DELIM_PERCENTAGE_SIGN        DEF_BIT_08
+#define  HTTP_STR_DELIM_PLUS_SIGN              DEF_BIT_09
+
+#define  HTTP_STR_DELIM_NBR                   10u
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -122,6 +166,15 @@
 *********************************************************************************************************
 */
 
+/*
+*********************************************************************************************************
+*                                     STRING DELIMITER SET DATA TYPE
+*********************************************************************************************************
+*/
+
+typedef  CPU_INT16U  HTTP_STR_DELIM;
+
+
 /*
 *********************************************************************************************************
 *                                     TASK CONFIGURATION DATA TYPE
@@ -379,6 +432,19 @@ typedef enum http_hdr_field_upgrade_val {
 } HTTP_HDR_FIELD_UPGRADE_VAL;
 
 
+/*
+*********************************************************************************************************
+*                                  HEADER FIELD CONTENT CODING VALUES ENUMARATION
+*********************************************************************************************************
+*/
+
+typedef enum http_hdr_field_content_coding_val {
+    HTTP_HDR_FIELD_CONTENT_CODING_GZIP,
+    HTTP_HDR_FIELD_CONTENT_CODING_BR,
+    HTTP_HDR_FIELD_CONTENT_CODING_UNKNOWN
+} HTTP_HDR_FIELD_CONTENT_CODING_VAL;
+
+
 /*
 *********************************************************************************************************
 *                                       FILE TYPES ENUMARATION
@@ -572,6 +638,13 @@ CPU_CHAR           *HTTP_HdrParseFieldValueGet     (       CPU_CHAR          *p_
 CPU_CHAR           *HTTP_StrGraphSrchFirst         (       CPU_CHAR          *p_str,
                                                            CPU_INT32U         str_len);
 
+CPU_CHAR           *HTTP_StrDelimSrch              (const  CPU_CHAR          *p_str,
+                                                           CPU_SIZE_T         str_len,
+                                                           HTTP_STR_DELIM     delim_set);
+
+CPU_CHAR           *HTTP_StrCRLF_Srch              (const  CPU_CHAR          *p_str,
+                                                           CPU_SIZE_T         str_len);
+
 CPU_BOOLEAN         HTTP_URL_EncodeStr             (const  CPU_CHAR          *p_str_src,
                                                            CPU_CHAR          *p_str_dest,
                                                            CPU_SIZE_T        *p_str_len,
@@ -594,6 +667,22 @@ CPU_CHAR           *HTTP_ChunkTransferWrSize       (       CPU_CHAR          *p_
 
 CPU_INT08U          HTTP_StrSizeHexDigReq          (       CPU_INT32U         nbr);
 
+CPU_BOOLEAN         HTTP_DateToTS                  (       CPU_INT16U         yr,
+                                                           CPU_INT16U         month,
+                                                           CPU_INT16U         day,
+                                                           CPU_INT16U         hr,
+                                                           CPU_INT16U         min,
+                                                           CPU_INT16U         sec,
+                                                           CPU_INT32U        *p_ts);
+
+CPU_CHAR           *HTTP_StrDateWr                 (       CPU_INT32U         ts,
+                                                           CPU_CHAR          *p_buf,
+                                                           CPU_SIZE_T         buf_len);
+
+CPU_BOOLEAN         HTTP_StrDateParse              (const  CPU_CHAR          *p_str,
+                                                           CPU_SIZE_T         str_len,
+                                                           CPU_INT32U        *p_ts);
+
 HTTP_CONTENT_TYPE   HTTP_GetContentTypeFromFileExt (       CPU_CHAR          *p_file_path,
                                                            CPU_SIZE_T         path_len_max);
 
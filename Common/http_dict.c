@@ -37,6 +37,20 @@
 #include  "http_dict.h"
 
 
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  HTTP_DICT_HDR_FIELD_IX_SLOT_NBR                 128u   /* MUST be a power of 2 > nbr of hdr field entries.     */
+#define  HTTP_DICT_HDR_FIELD_IX_KEY_NBR                   64u   /* MUST be > highest HTTP_HDR_FIELD key.                */
+
+#define  HTTP_DICT_IX_NONE                                 0u   /* Idx tbl entries are dictionary entry ix + 1.         */
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -405,6 +419,41 @@ const  HTTP_DICT  HTTP_Dict_HdrFieldUpgradeVal[] = {
 CPU_SIZE_T  HTTP_Dict_HdrFieldUpgradeValSize = sizeof(HTTP_Dict_HdrFieldUpgradeVal);
 
 
+/*
+*********************************************************************************************************
+*                                     HTTP CONTENT CODING VALUE
+*********************************************************************************************************
+*/
+
+const  HTTP_DICT  HTTP_Dict_HdrFieldContentCodingVal[] = {
+    { HTTP_HDR_FIELD_CONTENT_CODING_GZIP, HTTP_STR_HDR_FIELD_CONTENT_CODING_GZIP, (sizeof(HTTP_STR_HDR_FIELD_CONTENT_CODING_GZIP) - 1)},
+    { HTTP_HDR_FIELD_CONTENT_CODING_BR,   HTTP_STR_HDR_FIELD_CONTENT_CODING_BR,   (sizeof(HTTP_STR_HDR_FIELD_CONTENT_CODING_BR)   - 1)}
+};
+
+CPU_SIZE_T  HTTP_Dict_HdrFieldContentCodingValSize = sizeof(HTTP_Dict_HdrFieldContentCodingVal);
+
+
+/*
+*********************************************************************************************************
+*                                     HTTP HEADER FIELD INDEX
+*
+* Note(s) : (1) The header field dictionary is indexed by HTTP_Dict_Init() :
+*
+*               (a) 'HTTP_Dict_HdrFieldIxSlotTbl' is an open addressing hash table of the field names. The
+*                   hash only uses the name length and three of its characters (case insensitive), so a
+*                   lookup costs a few octets of hashing and usually a single string comparison.
+*
+*               (b) 'HTTP_Dict_HdrFieldIxKeyTbl' gives the entry of each header field key.
+*
+*           (2) Until the index is built, the dictionary functions search the dictionary linearly.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  HTTP_Dict_HdrFieldIxRdy = DEF_NO;
+static  CPU_INT08U   HTTP_Dict_HdrFieldIxSlotTbl[HTTP_DICT_HDR_FIELD_IX_SLOT_NBR];
+static  CPU_INT08U   HTTP_Dict_HdrFieldIxKeyTbl[HTTP_DICT_HDR_FIELD_IX_KEY_NBR];
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -413,6 +462,72 @@ CPU_SIZE_T  HTTP_Dict_HdrFieldUpgradeValSize = sizeof(HTTP_Dict_HdrFieldUpgradeV
 *********************************************************************************************************
 */
 
+static  CPU_INT32U  HTTP_Dict_HdrFieldHash (const  CPU_CHAR    *p_str,
+                                                   CPU_INT32U   str_len);
+
+
+/*
+*********************************************************************************************************
+*                                           HTTP_Dict_Init()
+*
+* Description : Build the header field dictionary index.
+*
+* Argument(s) : none.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPs_Init(),
+*               HTTPc_Init().
+*
+* Note(s)     : (1) See 'HTTP HEADER FIELD INDEX Note #1'. The index is built once; subsequent calls have no
+*                   effect. This function MUST be called during initialization, before any HTTP task runs.
+*
+*               (2) An entry whose key doesn't fit in the key table is only found by the linear search of
+*                   HTTP_Dict_EntryGet().
+*********************************************************************************************************
+*/
+
+void  HTTP_Dict_Init (void)
+{
+    const  HTTP_DICT   *p_entry;
+           CPU_INT32U   nbr_entry;
+           CPU_INT32U   ix;
+           CPU_INT32U   slot;
+
+
+    if (HTTP_Dict_HdrFieldIxRdy == DEF_YES) {                   /* See Note #1.                                         */
+        return;
+    }
+
+    nbr_entry = HTTP_Dict_HdrFieldSize / sizeof(HTTP_DICT);
+    if (nbr_entry >= HTTP_DICT_HDR_FIELD_IX_SLOT_NBR) {         /* Keep linear srch if the idx is too small.            */
+        return;
+    }
+
+    Mem_Clr(HTTP_Dict_HdrFieldIxSlotTbl, sizeof(HTTP_Dict_HdrFieldIxSlotTbl));
+    Mem_Clr(HTTP_Dict_HdrFieldIxKeyTbl,  sizeof(HTTP_Dict_HdrFieldIxKeyTbl));
+
+    p_entry = HTTP_Dict_HdrField;
+    for (ix = 0u; ix < nbr_entry; ix++) {
+                                                                /* Insert name in the first free slot.                  */
+        slot = HTTP_Dict_HdrFieldHash(p_entry->StrPtr, p_entry->StrLen);
+        while (HTTP_Dict_HdrFieldIxSlotTbl[slot] != HTTP_DICT_IX_NONE) {
+            slot = (slot + 1u) & (HTTP_DICT_HDR_FIELD_IX_SLOT_NBR - 1u);
+        }
+        HTTP_Dict_HdrFieldIxSlotTbl[slot] = (CPU_INT08U)(ix + 1u);
+
+        if ((p_entry->Key                                   <  HTTP_DICT_HDR_FIELD_IX_KEY_NBR) &&
+            (HTTP_Dict_HdrFieldIxKeyTbl[p_entry->Key]       == HTTP_DICT_IX_NONE)) {
+            HTTP_Dict_HdrFieldIxKeyTbl[p_entry->Key] = (CPU_INT08U)(ix + 1u);   /* See Note #2.                         */
+        }
+
+        p_entry++;
+    }
+
+    HTTP_Dict_HdrFieldIxRdy = DEF_YES;
+}
+
+
 /*
 *********************************************************************************************************
 *                                         HTTP_Dict_KeyGet()
@@ -433,7 +548,13 @@ CPU_SIZE_T  HTTP_Dict_HdrFieldUpgradeValSize = sizeof(HTTP_Dict_HdrFieldUpgradeV
 *
 * Caller(s)   : Various.
 *
-* Note(s)     : None.
+* Note(s)     : (1) The header field dictionary is searched with its hash index (see HTTP_Dict_Init()).
+*
+*               (2) Other dictionaries are searched linearly. Since entries are compared over the shortest
+*                   of both lengths, the first character is compared before calling the string comparison
+*                   function.
+*
+*               (3) A header field line without ':' has no field name & can't match any header field.
 *********************************************************************************************************
 */
 
@@ -446,7 +567,10 @@ CPU_INT32U  HTTP_Dict_KeyGet (const  HTTP_DICT    *p_dict_tbl,
            CPU_INT32U   nbr_entry;
            CPU_INT32U   ix;
            CPU_INT32U   len;
+           CPU_INT32U   slot;
            CPU_INT16S   cmp;
+           CPU_CHAR     char_cmp;
+           CPU_CHAR     char_srch;
            HTTP_DICT   *p_srch;
     const  CPU_CHAR    *p_str_start;
 
@@ -459,9 +583,33 @@ CPU_INT32U  HTTP_Dict_KeyGet (const  HTTP_DICT    *p_dict_tbl,
         p_str_cmp = Str_Char_N(p_str_cmp,                       /* Find end of the field name.                           */
                                str_len,
                                ASCII_CHAR_COLON);
+        if (p_str_cmp == DEF_NULL) {                            /* No field name without ':' (see Note #3).             */
+            return (HTTP_DICT_KEY_INVALID);
+        }
 
         len       = p_str_cmp - p_str_start;
         p_str_cmp = p_str_start;
+
+        if ((HTTP_Dict_HdrFieldIxRdy == DEF_YES) &&             /* Srch with the hash idx (see Note #1).                */
+            (len                     >  0u)) {
+            slot = HTTP_Dict_HdrFieldHash(p_str_cmp, len);
+            while (HTTP_Dict_HdrFieldIxSlotTbl[slot] != HTTP_DICT_IX_NONE) {
+                p_srch = (HTTP_DICT *)&p_dict_tbl[HTTP_Dict_HdrFieldIxSlotTbl[slot] - 1u];
+                if (len == p_srch->StrLen) {
+                    if (case_sensitive == DEF_YES) {
+                        cmp = Str_Cmp_N(p_str_cmp, p_srch->StrPtr, len);
+                    } else {
+                        cmp = Str_CmpIgnoreCase_N(p_str_cmp, p_srch->StrPtr, len);
+                    }
+                    if (cmp == 0) {
+                        return (p_srch->Key);
+                    }
+                }
+                slot = (slot + 1u) & (HTTP_DICT_HDR_FIELD_IX_SLOT_NBR - 1u);
+            }
+
+            return (HTTP_DICT_KEY_INVALID);
+        }
     }
 
     for (ix = 0; ix < nbr_entry; ix++) {
@@ -473,6 +621,19 @@ CPU_INT32U  HTTP_Dict_KeyGet (const  HTTP_DICT    *p_dict_tbl,
         }
         len = DEF_MIN(str_len, p_srch->StrLen);
 
+        if (len > 0u) {                                         /* Cmp first char before the str (see Note #2).         */
+            char_cmp  = p_str_cmp[0];
+            char_srch = p_srch->StrPtr[0];
+            if (case_sensitive != DEF_YES) {
+                char_cmp  = ASCII_TO_LOWER(char_cmp);
+                char_srch = ASCII_TO_LOWER(char_srch);
+            }
+            if (char_cmp != char_srch) {
+                p_srch++;
+                continue;
+            }
+        }
+
         if (case_sensitive == DEF_YES) {
             cmp = Str_Cmp_N(p_str_cmp, p_srch->StrPtr, len);
 
@@ -509,7 +670,9 @@ CPU_INT32U  HTTP_Dict_KeyGet (const  HTTP_DICT    *p_dict_tbl,
 *
 * Caller(s)   : Various.
 *
-* Note(s)     : None.
+* Note(s)     : (1) Most dictionaries list their entries in key order, so the entry at the key index is
+*                   tried first. The header field dictionary entry is taken from its key index (see
+*                   HTTP_Dict_Init()). Otherwise, the dictionary is searched linearly.
 *********************************************************************************************************
 */
 
@@ -523,6 +686,23 @@ HTTP_DICT  *HTTP_Dict_EntryGet (const  HTTP_DICT   *p_dict_tbl,
 
 
     nbr_entry =  dict_size / sizeof(HTTP_DICT);
+                                                                /* ---------------- DIRECT LOOKUP --------------------- */
+    if (key < nbr_entry) {                                      /* Try the entry at the key ix (see Note #1).           */
+        p_entry = (HTTP_DICT *)&p_dict_tbl[key];
+        if (p_entry->Key == key) {
+            return (p_entry);
+        }
+    }
+
+    if ((p_dict_tbl              == (HTTP_DICT *)&HTTP_Dict_HdrField) &&
+        (HTTP_Dict_HdrFieldIxRdy == DEF_YES)                          &&
+        (key                     <  HTTP_DICT_HDR_FIELD_IX_KEY_NBR)) {
+        ix = HTTP_Dict_HdrFieldIxKeyTbl[key];
+        if (ix != HTTP_DICT_IX_NONE) {
+            return ((HTTP_DICT *)&p_dict_tbl[ix - 1u]);
+        }
+    }
+                                                                /* ----------------- LINEAR SEARCH -------------------- */
     p_entry   = (HTTP_DICT *)p_dict_tbl;
     for (ix = 0; ix < nbr_entry; ix++) {                        /* Srch until last entry is reached.                    */
         if (p_entry->Key == key) {                              /* If keys match ...                                    */
@@ -665,3 +845,45 @@ CPU_CHAR  *HTTP_Dict_StrKeySrch (const  HTTP_DICT   *p_dict_tbl,
 
     return (p_found);
 }
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                       HTTP_Dict_HdrFieldHash()
+*
+* Description : Compute the header field index slot of a field name.
+*
+* Argument(s) : p_str       Pointer to the field name.
+*
+*               str_len     Field name length (MUST be greater than 0).
+*
+* Return(s)   : Index slot of the field name.
+*
+* Caller(s)   : HTTP_Dict_Init(),
+*               HTTP_Dict_KeyGet().
+*
+* Note(s)     : (1) The hash is case insensitive since field names are case insensitive.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  HTTP_Dict_HdrFieldHash (const  CPU_CHAR    *p_str,
+                                                   CPU_INT32U   str_len)
+{
+    CPU_INT32U  hash;
+
+
+    hash = str_len;
+    hash = (hash * 31u) + (CPU_INT08U)ASCII_TO_LOWER(p_str[0]);
+    hash = (hash * 31u) + (CPU_INT08U)ASCII_TO_LOWER(p_str[str_len / 2u]);
+    hash = (hash * 31u) + (CPU_INT08U)ASCII_TO_LOWER(p_str[str_len - 1u]);
+
+    return (hash & (HTTP_DICT_HDR_FIELD_IX_SLOT_NBR - 1u));
+}
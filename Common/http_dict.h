@@ -424,6 +424,16 @@
 #define  HTTP_STR_HDR_FIELD_UPGRADE_WEBSOCKET              "websocket"
 
 
+/*
+*********************************************************************************************************
+*                                     HTTP CONTENT CODING VALUE
+*********************************************************************************************************
+*/
+
+#define  HTTP_STR_HDR_FIELD_CONTENT_CODING_GZIP            "gzip"
+#define  HTTP_STR_HDR_FIELD_CONTENT_CODING_BR              "br"
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -464,6 +474,7 @@ extern  const  HTTP_DICT     HTTP_Dict_HdrFieldConnVal[];
 extern  const  HTTP_DICT     HTTP_Dict_HdrFieldTransferTypeVal[];
 extern  const  HTTP_DICT     HTTP_Dict_MultipartField[];
 extern  const  HTTP_DICT     HTTP_Dict_HdrFieldUpgradeVal[];
+extern  const  HTTP_DICT     HTTP_Dict_HdrFieldContentCodingVal[];
 
 extern         CPU_SIZE_T    HTTP_Dict_ReqMethodSize;
 extern         CPU_SIZE_T    HTTP_Dict_ProtocolVerSize;
@@ -477,6 +488,7 @@ extern         CPU_SIZE_T    HTTP_Dict_HdrFieldConnValSize;
 extern         CPU_SIZE_T    HTTP_Dict_HdrFieldTransferTypeValSize;
 extern         CPU_SIZE_T    HTTP_Dict_MultipartFieldSize;
 extern         CPU_SIZE_T    HTTP_Dict_HdrFieldUpgradeValSize;
+extern         CPU_SIZE_T    HTTP_Dict_HdrFieldContentCodingValSize;
 
 
 /*
@@ -487,6 +499,8 @@ extern         CPU_SIZE_T    HTTP_Dict_HdrFieldUpgradeValSize;
 *********************************************************************************************************
 */
 
+void         HTTP_Dict_Init        (void);
+
 CPU_INT32U   HTTP_Dict_KeyGet      (const  HTTP_DICT   *p_dict_tbl,
                                            CPU_INT32U   dict_size,
                                     const  CPU_CHAR    *p_str_cmp,
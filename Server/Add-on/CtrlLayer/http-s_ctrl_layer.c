@@ -232,7 +232,7 @@ CPU_BOOLEAN  HTTPsCtrlLayer_OnInstanceInit (const  HTTPs_INSTANCE  *p_instance,
 
                                                                 /* Initialize the pool for Ctrl Layer conn data.        */
     result = HTTPsCtrlLayerMem_ConnDataPoolInit(p_inst_data,
-                                                p_instance->CfgPtr->ConnNbrMax);
+                                                p_instance->ConnNbrMax);
     if (result != DEF_OK) {
         return (DEF_FAIL);
     }
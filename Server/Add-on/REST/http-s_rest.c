@@ -147,7 +147,7 @@ CPU_BOOLEAN  HTTPsREST_Init (const  HTTPs_INSTANCE  *p_instance,
     HTTPs_REST_INST_DATA  *p_inst_data;
 
 
-    p_inst_data = HTTPsREST_Mem_Init_Pools(p_instance->CfgPtr->ConnNbrMax);
+    p_inst_data = HTTPsREST_Mem_Init_Pools(p_instance->ConnNbrMax);
     if (p_inst_data == DEF_NULL) {
         return (DEF_FAIL);
     }
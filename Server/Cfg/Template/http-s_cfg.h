@@ -197,6 +197,52 @@
                                                                 /*   DEF_ENABLED    Absolute URI support ENABLED        */
 
 
+/*
+*********************************************************************************************************
+*                                HTTP SERVER CONTENT CODING CONFIGURATION
+*
+* Note(s) : (1) Configure HTTPs_CFG_CONTENT_CODING_EN to enable/disable Accept-Encoding negotiation and the
+*               transmission of pre-compressed file variants (e.g. 'index.html.gz', 'index.html.br').
+*
+*           (2) Configure HTTPs_CFG_DEFLATE_EN to enable/disable the gzip compression on the fly of the chunked
+*               responses (token replaced files & hook generated data). HTTPs_CFG_CONTENT_CODING_EN MUST be
+*               enabled. The compression is enabled per instance with the deflate configuration object.
+*********************************************************************************************************
+*/
+
+                                                                /* Configure content coding feature ...                 */
+                                                                /* ... (see Note #1):                                   */
+#define  HTTPs_CFG_CONTENT_CODING_EN              DEF_ENABLED
+                                                                /*   DEF_DISABLED   Content coding DISABLED             */
+                                                                /*   DEF_ENABLED    Content coding ENABLED              */
+
+                                                                /* Configure streaming deflate compression feature ...  */
+                                                                /* ... (see Note #2):                                   */
+#define  HTTPs_CFG_DEFLATE_EN                     DEF_ENABLED
+                                                                /*   DEF_DISABLED   Deflate compression DISABLED        */
+                                                                /*   DEF_ENABLED    Deflate compression ENABLED         */
+
+
+/*
+*********************************************************************************************************
+*                              HTTP SERVER CONDITIONAL REQUEST CONFIGURATION
+*
+* Note(s) : (1) Configure HTTPs_CFG_COND_REQ_EN to enable/disable the ETag & Last-Modified validators of the
+*               files transmitted and the processing of the If-None-Match & If-Modified-Since headers. A file
+*               unchanged since the client's copy is answered with a '304 Not Modified' response without body.
+*
+*           (2) Dynamic FS files are validated on their size & their modification date. The static FS
+*               images generated by the image tool also store the CRC-32 of each file used as entity tag.
+*********************************************************************************************************
+*/
+
+                                                                /* Configure conditional request feature ...            */
+                                                                /* ... (see Note #1):                                   */
+#define  HTTPs_CFG_COND_REQ_EN                    DEF_ENABLED
+                                                                /*   DEF_DISABLED   Conditional requests DISABLED       */
+                                                                /*   DEF_ENABLED    Conditional requests ENABLED        */
+
+
 /*
 *********************************************************************************************************
 *                           DEFAULT FATAL ERROR HTML DOCUMENT CONFIGURATION
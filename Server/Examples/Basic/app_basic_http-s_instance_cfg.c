@@ -112,12 +112,16 @@ const  HTTPs_CFG_FS_DYN  HTTPs_CfgFS_AppBasic = {
 
    &NetFS_API_FS_V4,                                            /* .FS_API_Ptr : Pointer to FS API.                     */
 
-    HTTPs_CFG_INSTANCE_STR_FOLDER_ROOT                          /* .WorkingFolderNamePtr : FS working folder.           */
+    HTTPs_CFG_INSTANCE_STR_FOLDER_ROOT,                         /* .WorkingFolderNamePtr : FS working folder.           */
+
+    DEF_NULL                                                    /* .FS_TxAPI_Ptr : FS transmit API (optional).          */
 };
 #else
 const  HTTPs_CFG_FS_STATIC  HTTPs_CfgFS_AppBasic = {
 
    &HTTPs_FS_API_Static,                                        /* .FS_API_Ptr : Pointer to FS API.                     */
+
+    HTTPs_FS_FileETagGet                                        /* .FileETagGet : File entity tag getter (optional).    */
 };
 #endif
 
@@ -279,6 +283,20 @@ const  HTTPs_CFG  HTTPs_CfgInstance_AppBasic = {
 
     DEF_ENABLED,                                               /* .ConnPersistentEn : Persistent conn feature.         */
 
+    10,                                                         /* .ConnReqHdrTimeout_s : Req hdr rx timeout.           */
+
+    60,                                                         /* .ConnReqBodyTimeout_s : Req body rx timeout.         */
+
+    10,                                                         /* .ConnIdleTimeout_s : Persistent conn idle timeout.   */
+
+    15,                                                         /* .ConnOverloadHighWater : Overload high mark.         */
+
+    12,                                                         /* .ConnOverloadLowWater : Overload low mark.           */
+
+    5,                                                          /* .ConnOverloadRetryAfter_s : 503 Retry-After.         */
+
+    DEF_ENABLED,                                                /* .ConnOverloadEvictIdleEn : Evict idle conn.          */
+
 
 /*
 *--------------------------------------------------------------------------------------------------------
@@ -352,5 +370,34 @@ const  HTTPs_CFG  HTTPs_CfgInstance_AppBasic = {
 
    &HTTPs_TokenCfg_AppBasic,                                    /* .TokenCfgPtr : Pointer to Token Cfg Ojbect.          */
 
+
+/*
+*--------------------------------------------------------------------------------------------------------
+*                              STREAMING DEFLATE COMPRESSION CONFIGURATION
+*--------------------------------------------------------------------------------------------------------
+*/
+
+    DEF_NULL,                                                   /* .DeflateCfgPtr : Pointer to Deflate Cfg Object.      */
+
+
+/*
+*--------------------------------------------------------------------------------------------------------
+*                                  INSTANCE SOCKET EVENT CONFIGURATION
+*--------------------------------------------------------------------------------------------------------
+*/
+
+    DEF_NULL,                                                   /* .SockEvtAPI_Ptr : DEF_NULL for NetSock_Sel() backend.*/
+
+
+/*
+*--------------------------------------------------------------------------------------------------------
+*                                    INSTANCE WORKER CONFIGURATION
+*--------------------------------------------------------------------------------------------------------
+*/
+
+    1u,                                                         /* .WorkerNbr        : Single worker task.              */
+
+    DEF_NULL,                                                   /* .WorkerTaskCfgTbl : No additional worker task.       */
+
 };                                                              /* End of configuration structure.                      */
 
@@ -103,6 +103,8 @@ const  HTTPs_CFG_FS_NONE  HTTPs_CfgFS_None_AppGlobal = {
 const  HTTPs_CFG_FS_STATIC  HTTPs_CfgFS_Static_AppGlobal = {
 
    &HTTPs_FS_API_Static,                                        /* .FS_API_Ptr : Pointer to FS API.                     */
+
+    HTTPs_FS_FileETagGet                                        /* .FileETagGet : File entity tag getter (optional).    */
 };
 #endif
 
@@ -111,7 +113,9 @@ const  HTTPs_CFG_FS_DYN  HTTPs_CfgFS_Dyn_AppGlobal = {
 
    &NetFS_API_FS_V4,                                            /* .FS_API_Ptr : Pointer to FS API.                     */
 
-    HTTPs_CFG_INSTANCE_STR_FOLDER_ROOT                          /* .WorkingFolderPtr : FS working folder.               */
+    HTTPs_CFG_INSTANCE_STR_FOLDER_ROOT,                         /* .WorkingFolderPtr : FS working folder.               */
+
+    DEF_NULL                                                    /* .FS_TxAPI_Ptr : FS transmit API (optional).          */
 };
 #endif
 
@@ -268,6 +272,20 @@ const  HTTPs_CFG  HTTPs_CfgInstance_AppGlobal = {
 
     DEF_ENABLED,                                                /* .ConnPersistentEn : Persistent conn feature.         */
 
+    10,                                                         /* .ConnReqHdrTimeout_s : Req hdr rx timeout.           */
+
+    60,                                                         /* .ConnReqBodyTimeout_s : Req body rx timeout.         */
+
+    10,                                                         /* .ConnIdleTimeout_s : Persistent conn idle timeout.   */
+
+    6,                                                          /* .ConnOverloadHighWater : Overload high mark.         */
+
+    4,                                                          /* .ConnOverloadLowWater : Overload low mark.           */
+
+    5,                                                          /* .ConnOverloadRetryAfter_s : 503 Retry-After.         */
+
+    DEF_ENABLED,                                                /* .ConnOverloadEvictIdleEn : Evict idle conn.          */
+
 
 /*
 *--------------------------------------------------------------------------------------------------------
@@ -337,5 +355,34 @@ const  HTTPs_CFG  HTTPs_CfgInstance_AppGlobal = {
 
    &HTTPs_TokenCfg_AppGlobal,                                   /* .TokenCfgPtr : Pointer to Token Cfg Ojbect.          */
 
+
+/*
+*--------------------------------------------------------------------------------------------------------
+*                              STREAMING DEFLATE COMPRESSION CONFIGURATION
+*--------------------------------------------------------------------------------------------------------
+*/
+
+    DEF_NULL,                                                   /* .DeflateCfgPtr : Pointer to Deflate Cfg Object.      */
+
+
+/*
+*--------------------------------------------------------------------------------------------------------
+*                                  INSTANCE SOCKET EVENT CONFIGURATION
+*--------------------------------------------------------------------------------------------------------
+*/
+
+    DEF_NULL,                                                   /* .SockEvtAPI_Ptr : DEF_NULL for NetSock_Sel() backend.*/
+
+
+/*
+*--------------------------------------------------------------------------------------------------------
+*                                    INSTANCE WORKER CONFIGURATION
+*--------------------------------------------------------------------------------------------------------
+*/
+
+    1u,                                                         /* .WorkerNbr        : Single worker task.              */
+
+    DEF_NULL,                                                   /* .WorkerTaskCfgTbl : No additional worker task.       */
+
 };                                                              /* End of configuration structure.                      */
 
@@ -171,6 +171,20 @@ const  HTTPs_CFG  HTTPs_CfgInstance_NoFS = {
 
     DEF_ENABLED,                                                /* .ConnPersistentEn : Persistent conn feature.         */
 
+    10,                                                         /* .ConnReqHdrTimeout_s : Req hdr rx timeout.           */
+
+    60,                                                         /* .ConnReqBodyTimeout_s : Req body rx timeout.         */
+
+    10,                                                         /* .ConnIdleTimeout_s : Persistent conn idle timeout.   */
+
+    15,                                                         /* .ConnOverloadHighWater : Overload high mark.         */
+
+    12,                                                         /* .ConnOverloadLowWater : Overload low mark.           */
+
+    5,                                                          /* .ConnOverloadRetryAfter_s : 503 Retry-After.         */
+
+    DEF_ENABLED,                                                /* .ConnOverloadEvictIdleEn : Evict idle conn.          */
+
 
 /*
 *--------------------------------------------------------------------------------------------------------
@@ -242,5 +256,34 @@ const  HTTPs_CFG  HTTPs_CfgInstance_NoFS = {
 
     DEF_NULL,                                                   /* .TokenCfgPtr : Pointer to Token Cfg Ojbect.          */
 
+
+/*
+*--------------------------------------------------------------------------------------------------------
+*                              STREAMING DEFLATE COMPRESSION CONFIGURATION
+*--------------------------------------------------------------------------------------------------------
+*/
+
+    DEF_NULL,                                                   /* .DeflateCfgPtr : Pointer to Deflate Cfg Object.      */
+
+
+/*
+*--------------------------------------------------------------------------------------------------------
+*                                  INSTANCE SOCKET EVENT CONFIGURATION
+*--------------------------------------------------------------------------------------------------------
+*/
+
+    DEF_NULL,                                                   /* .SockEvtAPI_Ptr : DEF_NULL for NetSock_Sel() backend.*/
+
+
+/*
+*--------------------------------------------------------------------------------------------------------
+*                                    INSTANCE WORKER CONFIGURATION
+*--------------------------------------------------------------------------------------------------------
+*/
+
+    1u,                                                         /* .WorkerNbr        : Single worker task.              */
+
+    DEF_NULL,                                                   /* .WorkerTaskCfgTbl : No additional worker task.       */
+
 };                                                              /* End of configuration structure.                      */
 
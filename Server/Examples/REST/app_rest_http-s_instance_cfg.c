@@ -105,6 +105,8 @@ const  HTTPs_CFG_FS_NONE  HTTPs_CfgFS_None_REST = {
 const  HTTPs_CFG_FS_STATIC  HTTPs_CfgFS_Static_REST = {
 
    &HTTPs_FS_API_Static,                                        /* .FS_API_Ptr : Pointer to FS API.                     */
+
+    HTTPs_FS_FileETagGet                                        /* .FileETagGet : File entity tag getter (optional).    */
 };
 #endif
 
@@ -113,7 +115,9 @@ const  HTTPs_CFG_FS_DYN  HTTPs_CfgFS_Dyn_REST = {
 
    &NetFS_API_FS_V4,                                            /* .FS_API_Ptr : Pointer to FS API.                     */
 
-    HTTPs_CFG_INSTANCE_STR_FOLDER_ROOT                          /* .WorkingFolderPtr : FS working folder.               */
+    HTTPs_CFG_INSTANCE_STR_FOLDER_ROOT,                         /* .WorkingFolderPtr : FS working folder.               */
+
+    DEF_NULL                                                    /* .FS_TxAPI_Ptr : FS transmit API (optional).          */
 };
 #endif
 
@@ -184,6 +188,20 @@ const  HTTPs_CFG  HTTPs_CfgInstance_REST = {
 
     DEF_ENABLED,                                                /* .ConnPersistentEn : Persistent conn feature.         */
 
+    10,                                                         /* .ConnReqHdrTimeout_s : Req hdr rx timeout.           */
+
+    60,                                                         /* .ConnReqBodyTimeout_s : Req body rx timeout.         */
+
+    10,                                                         /* .ConnIdleTimeout_s : Persistent conn idle timeout.   */
+
+    APP_REST_HTTPs_CONN_NBR_MAX,                                /* .ConnOverloadHighWater : Overload high mark.         */
+
+    (APP_REST_HTTPs_CONN_NBR_MAX - 2u),                         /* .ConnOverloadLowWater : Overload low mark.           */
+
+    5,                                                          /* .ConnOverloadRetryAfter_s : 503 Retry-After.         */
+
+    DEF_ENABLED,                                                /* .ConnOverloadEvictIdleEn : Evict idle conn.          */
+
 
 /*
 *--------------------------------------------------------------------------------------------------------
@@ -253,5 +271,34 @@ const  HTTPs_CFG  HTTPs_CfgInstance_REST = {
 
     DEF_NULL,                                                   /* .TokenCfgPtr : Pointer to Token Cfg Ojbect.          */
 
+
+/*
+*--------------------------------------------------------------------------------------------------------
+*                              STREAMING DEFLATE COMPRESSION CONFIGURATION
+*--------------------------------------------------------------------------------------------------------
+*/
+
+    DEF_NULL,                                                   /* .DeflateCfgPtr : Pointer to Deflate Cfg Object.      */
+
+
+/*
+*--------------------------------------------------------------------------------------------------------
+*                                  INSTANCE SOCKET EVENT CONFIGURATION
+*--------------------------------------------------------------------------------------------------------
+*/
+
+    DEF_NULL,                                                   /* .SockEvtAPI_Ptr : DEF_NULL for NetSock_Sel() backend.*/
+
+
+/*
+*--------------------------------------------------------------------------------------------------------
+*                                    INSTANCE WORKER CONFIGURATION
+*--------------------------------------------------------------------------------------------------------
+*/
+
+    1u,                                                         /* .WorkerNbr        : Single worker task.              */
+
+    DEF_NULL,                                                   /* .WorkerTaskCfgTbl : No additional worker task.       */
+
 };                                                              /* End of configuration structure.                      */
 
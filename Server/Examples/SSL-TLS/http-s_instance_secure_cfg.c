@@ -256,6 +256,9 @@ const  HTTPs_CFG_FS_NONE  HTTPs_CfgFS_None_Secure = {
 *               for the FS API structure required for Network Applications.
 *               If HTTP Static File System is used as File System, the port is already available in
 *               uC-HTTP/Server/FS folder and the API structure is defined as 'HTTPs_FS_API_Static'.
+*
+*           (2) The static file system images hold the CRC-32 of each file, used as entity tag of the
+*               conditional requests (see 'http-s_cfg.h  HTTP SERVER CONDITIONAL REQUEST CONFIGURATION').
 *********************************************************************************************************
 */
 
@@ -265,6 +268,11 @@ const  HTTPs_CFG_FS_STATIC  HTTPs_CfgFS_Static_Secure = {
                                                                 /* Configure instance FS API pointer (see note #1):     */
    &HTTPs_FS_API_Static,
                                                                 /* MUST NOT be a NULL                                   */
+
+    /* CPU_BOOLEAN  (*FileETagGet)(void *, CPU_INT32U *)                                                                */
+                                                                /* Configure file entity tag getter (see note #2):      */
+    HTTPs_FS_FileETagGet
+                                                                /* DEF_NULL to derive tags from size & date only.       */
 };
 #endif
 
@@ -283,6 +291,11 @@ const  HTTPs_CFG_FS_STATIC  HTTPs_CfgFS_Static_Secure = {
 *               (a) It can be set as a null pointer (DEF_NULL), if the file system doesn't support
 *                   'set working folder' functionality but HTML documents and files must be located in the
 *                   default path used by the file system.
+*
+*           (3) A file system port MAY provide a transmit API that sends file data straight from the file
+*               to the connection socket (e.g. with sendfile() on a host port). See HTTPs_FS_TX_API in
+*               'http-s.h'. The server falls back to the buffered transfer when token parsing or chunked
+*               transfer needs the file data.
 *********************************************************************************************************
 */
 
@@ -296,8 +309,13 @@ const  HTTPs_CFG_FS_DYN  HTTPs_CfgFS_Dyn_Secure = {
 
     /* CPU_CHAR    *WorkingFolderPtr                                                                                    */
                                                                 /* Configure instance working folder (see note #2):     */
-    HTTPs_CFG_INSTANCE_SECURE_STR_FOLDER_ROOT
+    HTTPs_CFG_INSTANCE_SECURE_STR_FOLDER_ROOT,
                                                                 /* SHOULD be a string pointer                           */
+
+    /* const  HTTPs_FS_TX_API  *FS_TxAPI_Ptr                                                                            */
+                                                                /* Configure FS transmit API pointer (see note #3):     */
+    DEF_NULL
+                                                                /* DEF_NULL to always tx file data from the conn buf.   */
 };
 #endif
 
@@ -782,13 +800,16 @@ const  HTTPs_CFG  HTTPs_CfgInstance_Secure = {
 *                                  INSTANCE CONNECTION CONFIGURATION
 *
 * Note(s) : (1) (a) 'ConnNbrMax' is used to configure maximum number of connections that the web server will be able to serve
-*                   simultaneously.
+*                   simultaneously, up to 65535 connections per instance.
 *
 *               (b) Maximum number of connections must be configured following your requirements about the memory usage and
 *                   the number of connections:
 *
 *                   (1) Each connection requires memory space which is reserved at the instance start up. The memory
 *                       required by the web server is greatly affected by the number of connections configured.
+*                       An idle persistent connection holds sizeof(HTTPs_CONN) + 'BufLen' octets, plus the file path
+*                       buffer (file system maximum path length) and 'HostNameLenMax' octets when HTTPs_CFG_ABSOLUTE_URI_EN
+*                       is enabled. Other resources (headers, tokens, forms) are only held while a transaction is processed.
 *
 *                   (2) When a client downloads an items such as an html document, image, css file, javascript file, it
 *                       should open a new connection for each of these items. Also, most common web servers can open up to
@@ -814,10 +835,30 @@ const  HTTPs_CFG  HTTPs_CfgInstance_Secure = {
 *               (b) To allow the connection to stay open after HTTP transactions, 'HTTPs_CFG_PERSISTENT_CONN_EN' must be
 *                   set as 'DEF_ENABLED'.
 *                   See http-s_cfg.h section 'HTTP SERVER PERSISTENT CONNECTION CONFIGURATION' for further informations.
+*
+*           (5) (a) 'ConnReqHdrTimeout_s' is the maximum time for a client to send the request line and the header
+*                   fields, 'ConnReqBodyTimeout_s' the maximum time to send the request body and 'ConnIdleTimeout_s'
+*                   the maximum time a persistent connection can stay idle between two requests.
+*
+*               (b) Each deadline covers the whole phase and is not extended when data is received, so a slow client can't
+*                   hold a connection. When a deadline expires, the connection is closed without response.
+*
+*               (c) A timeout configured to 0 disables the deadline; only the inactivity timeout (see Note #2) applies.
+*
+*           (6) (a) 'ConnOverloadHighWater' is the number of connections in use, over all the workers, at which the
+*                   instance enters overload and 'ConnOverloadLowWater' the number at which it leaves overload. While
+*                   overloaded, new connections are answered with a '503 Service Unavailable' response carrying a
+*                   'Retry-After' header set to 'ConnOverloadRetryAfter_s' and are closed right away.
+*
+*               (b) When 'ConnOverloadEvictIdleEn' is enabled, an overloaded instance closes its least recently active
+*                   idle persistent connection to serve the new connection instead of rejecting it.
+*
+*               (c) 'ConnOverloadHighWater' configured to 0 disables the admission control. Otherwise, it MUST be lower
+*                   or equal to 'ConnNbrMax' and 'ConnOverloadLowWater' MUST be lower than 'ConnOverloadHighWater'.
 *--------------------------------------------------------------------------------------------------------
 */
 
-    /* CPU_INT08U    ConnNbrMax                                                                                         */
+    /* CPU_INT16U    ConnNbrMax                                                                                         */
                                                                 /* Configure maximum number of simultaneous ...         */
                                                                 /* connections (see Note #1):                           */
     15,
@@ -840,6 +881,48 @@ const  HTTPs_CFG  HTTPs_CfgInstance_Secure = {
                                                                 /*   DEF_DISABLED     Persistent Conn support DISABLED  */
                                                                 /*   DEF_ENABLED      Persistent Conn support ENABLED   */
 
+    /* CPU_INT16U    ConnReqHdrTimeout_s                                                                                */
+                                                                /* Configure request line & hdr rx timeout ...          */
+                                                                /* ... in integer seconds (see Note #5).                */
+    10,
+                                                                /* 0 to disable                                         */
+
+    /* CPU_INT16U    ConnReqBodyTimeout_s                                                                               */
+                                                                /* Configure request body rx timeout ...                */
+                                                                /* ... in integer seconds (see Note #5).                */
+    60,
+                                                                /* 0 to disable                                         */
+
+    /* CPU_INT16U    ConnIdleTimeout_s                                                                                  */
+                                                                /* Configure persistent conn idle timeout ...           */
+                                                                /* ... in integer seconds (see Note #5).                */
+    10,
+                                                                /* 0 to disable                                         */
+
+    /* CPU_INT16U    ConnOverloadHighWater                                                                              */
+                                                                /* Configure nbr of conns in use at which the ...       */
+                                                                /* ... instance enters overload (see Note #6):          */
+    15,
+                                                                /* 0 to disable, MUST be <= ConnNbrMax                  */
+
+    /* CPU_INT16U    ConnOverloadLowWater                                                                               */
+                                                                /* Configure nbr of conns in use at which the ...       */
+                                                                /* ... instance leaves overload (see Note #6):          */
+    12,
+                                                                /* MUST be < ConnOverloadHighWater                      */
+
+    /* CPU_INT16U    ConnOverloadRetryAfter_s                                                                           */
+                                                                /* Configure overload resp Retry-After delay ...        */
+                                                                /* ... in integer seconds (see Note #6).                */
+    5,
+
+    /* CPU_BOOLEAN   ConnOverloadEvictIdleEn                                                                            */
+                                                                /* Configure idle conn eviction in overload ...         */
+                                                                /* ... (see Note #6b):                                  */
+    DEF_ENABLED,
+                                                                /*   DEF_DISABLED     New conns rejected                */
+                                                                /*   DEF_ENABLED      Idle conns evicted for new conns  */
+
 
 /*
 *--------------------------------------------------------------------------------------------------------
@@ -1006,5 +1089,65 @@ const  HTTPs_CFG  HTTPs_CfgInstance_Secure = {
                                                               /* Pointer to Token Configuration Object (see note #1):   */
    &HTTPs_TokenCfg_Secure,
 
+
+/*
+*--------------------------------------------------------------------------------------------------------
+*                                STREAMING DEFLATE COMPRESSION CONFIGURATION
+*
+* Note(s) : (1) To enable the streaming compression of chunked responses, set the pointer to the Deflate
+*               configuration object. Set to DEF_NULL, if the responses are not compressed on the fly.
+*
+*               See HTTPs_DeflateCfg Declaration for more details.
+*--------------------------------------------------------------------------------------------------------
+*/
+
+    /* HTTPs_DEFLATE_CFG  *DeflateCfgPtr                                                                                */
+                                                                /* Pointer to Deflate Cfg Object (see note #1):         */
+    DEF_NULL,
+
+
+/*
+*--------------------------------------------------------------------------------------------------------
+*                                  INSTANCE SOCKET EVENT CONFIGURATION
+*
+* Note(s) : (1) The socket event backend keeps the sockets of the instance registered between two passes of the
+*               instance task and reports only the ready connections. Set to DEF_NULL to use the default
+*               backend based on NetSock_Sel() (HTTPsSock_EvtAPI_Sel).
+*
+*               Another backend (e.g. epoll on a host port) can be used by pointing to its HTTPs_SOCK_EVT_API
+*               structure.
+*--------------------------------------------------------------------------------------------------------
+*/
+
+    /* const  HTTPs_SOCK_EVT_API  *SockEvtAPI_Ptr                                                                       */
+                                                                /* Pointer to Socket Event Backend API (see note #1):   */
+    DEF_NULL,
+
+
+/*
+*--------------------------------------------------------------------------------------------------------
+*                                    INSTANCE WORKER CONFIGURATION
+*
+* Note(s) : (1) The connections of the instance can be shared between several worker tasks. The instance task
+*               is the primary worker: it owns the listen socket(s), accepts the connections and hands them off
+*               to the worker with the least load in a round-robin way. Each worker has its own connection
+*               pool of (ConnNbrMax / WorkerNbr) connections, rounded up.
+*
+*           (2) Number of worker MUST be lower or equal to ConnNbrMax. Set to 1 (or 0) to process all the
+*               connections in the instance task.
+*
+*           (3) Table of (WorkerNbr - 1) task configurations, one for each additional worker. Unused and can be
+*               set to DEF_NULL when only one worker is configured.
+*--------------------------------------------------------------------------------------------------------
+*/
+
+    /* CPU_INT08U  WorkerNbr                                                                                            */
+                                                                /* Number of worker tasks (see note #1 & #2):           */
+    1u,
+
+    /* const  NET_TASK_CFG  *WorkerTaskCfgTbl                                                                           */
+                                                                /* Pointer to additional worker task cfg (see note #3): */
+    DEF_NULL,
+
 };                                                              /* End of configuration structure.                      */
 
@@ -7,6 +7,11 @@ import io
 import sys
 import logging
 import argparse
+import struct
+import zlib
+import gzip
+import shutil
+import tempfile
 
 #    Specific imports
 from itertools import islice
@@ -85,6 +90,36 @@ CPU_BOOLEAN GeneratedFS_FileAdd() {{
 #    Template to add a file to the STATIC file system.
 createStaticFile     = "    {{{macro}_NAME, {name_gap}{macro}_CONTENT, {content_gap}{macro}_SIZE}},"
 
+#    Extensions of the pre-compressed file variants (see HTTPsResp_FileOpen()).
+CODED_EXT_GZIP       = ".gz"
+CODED_EXT_BR         = ".br"
+
+#    This section defines the STATIC file system image (see HTTPs_FS_AddImg()).
+#    The image is laid out as: header, hash slot table, file entry table, file names, file data.
+#    Every field is a 32-bit word in the byte order of the target CPU.
+IMAGE_FILE_NAME      = "generated_fs.bin"
+IMAGE_MAGIC          = b"uHFS"
+IMAGE_VERSION        = 1
+IMAGE_IX_NONE        = 0xFFFFFFFF
+IMAGE_HDR_FORMAT     = "4s7I"       # Magic, Ver, FileNbr, SlotNbr, SlotTblOffset, EntryTblOffset, Size, Rsvd
+IMAGE_ENTRY_FORMAT   = "6I"         # NameHash, NextIx, NameOffset, DataOffset, Size, ETag
+IMAGE_DATA_ALIGN     = 8
+
+#    Template of the add to STATIC file system from an image linked with the application.
+buildStaticFSImageTemplate='''
+#include  <Server/FS/Static/http-s_fs_static.h>
+#include  "generated_fs.h"
+#include  <lib_def.h>
+
+static  const  CPU_INT32U  GeneratedFS_Img[] = {{
+{words}
+}};
+
+CPU_BOOLEAN GeneratedFS_FileAdd() {{
+    return (HTTPs_FS_AddImg(GeneratedFS_Img, sizeof(GeneratedFS_Img)));
+}}
+'''
+
 #    This function reads a file by "n" bytes
 def readBytes(filename, n):
     with open(filename, "rb") as file:
@@ -180,12 +215,157 @@ def writeFile(p, s):
     # end with
 # end writeFile
 
+#    Computes the hash of a file name, as HTTPs_FS_CalcNameHash() does (FNV-1a on the lower case name).
+def imageNameHash(name):
+    h = 2166136261
+    for b in name.lower():
+        h ^= b
+        h  = (h * 16777619) & 0xFFFFFFFF
+    # end for
+    return h
+# end imageNameHash()
+
+#    Pads a bytearray up to the given alignment.
+def imagePad(blob, align):
+    blob.extend(b"\0" * ((align - (len(blob) % align)) % align))
+# end imagePad()
+
+#    Builds the STATIC file system image from the file list.
+def buildImage(file_list, endian):
+    #    Sorted directory: file names as stored by HTTPs_FS_AddFile() (no leading separator).
+    files = sorted([(relative_path.replace(os.sep, '\\').encode('utf-8'), source_path)
+                    for relative_path, source_path, destination_path in file_list])
+
+    file_nbr     = len(files)
+    slot_nbr     = max(file_nbr, 1)
+    hdr_size     = struct.calcsize(endian + IMAGE_HDR_FORMAT)
+    entry_size   = struct.calcsize(endian + IMAGE_ENTRY_FORMAT)
+    slot_offset  = hdr_size
+    entry_offset = slot_offset + (slot_nbr * 4)
+
+    #    File names, then file data.
+    blob         = bytearray(entry_offset + (file_nbr * entry_size))
+    name_offsets = []
+    for name, source_path in files:
+        name_offsets.append(len(blob))
+        blob.extend(name + b"\0")
+    # end for
 
+    slots   = [IMAGE_IX_NONE] * slot_nbr
+    entries = []
+    for ix, (name, source_path) in enumerate(files):
+        with open(source_path, "rb") as f:
+            data = f.read()
+        # end with
+
+        imagePad(blob, IMAGE_DATA_ALIGN)
+        data_offset = len(blob)
+        blob.extend(data)
+
+        name_hash = imageNameHash(name)
+        slot_ix   = name_hash % slot_nbr
+        entries.append((name_hash, slots[slot_ix], name_offsets[ix], data_offset, len(data), zlib.crc32(data) & 0xFFFFFFFF))
+        slots[slot_ix] = ix
+        logging.debug('%s : offset = %d, size = %d' % (name, data_offset, len(data)))
+    # end for
 
-def Generate(sourceDir, generateDir, fsType, exclude_template=False, force=False):
-    #    List of the generated headers
-    generatedHeaders = []
+    imagePad(blob, 4)
+
+    struct.pack_into(endian + IMAGE_HDR_FORMAT, blob, 0,
+                     IMAGE_MAGIC, IMAGE_VERSION, file_nbr, slot_nbr, slot_offset, entry_offset, len(blob), 0)
+    struct.pack_into(endian + "%dI" % slot_nbr, blob, slot_offset, *slots)
+    for ix, entry in enumerate(entries):
+        struct.pack_into(endian + IMAGE_ENTRY_FORMAT, blob, entry_offset + (ix * entry_size), *entry)
+    # end for
+
+    return bytes(blob)
+# end buildImage()
+
+#    Generates the STATIC file system image and, unless excluded, the C file linking it with the application.
+def GenerateImage(file_list, generateDir, bigEndian, exclude_template):
+    endian     = ">" if bigEndian else "<"
+    image      = buildImage(file_list, endian)
+    image_path = os.path.join(generateDir, IMAGE_FILE_NAME)
+
+    with open(image_path, "wb") as f:
+        f.write(image)
+    # end with
+    print(image_path)
 
+    if (exclude_template == False):
+        words     = struct.unpack(endian + "%dI" % (len(image) // 4), image)
+        wordBlock = ",\n".join(["    " + ", ".join(["0x{0:08x}u".format(w) for w in words[ix:ix + 8]])
+                                for ix in range(0, len(words), 8)])
+        writeFile(os.path.join(generateDir, "generated_fs.c"), buildStaticFSImageTemplate.format(words=wordBlock))
+        writeFile(os.path.join(generateDir, "generated_fs.h"), guardedFSHeaderTemplate.format(macro="GENERATED_FS", content=""));
+    # end if
+# end GenerateImage()
+
+
+
+#    Compresses data with gzip. The time stamp is cleared so that the output only depends on the data.
+def gzipCompress(data):
+    buf = io.BytesIO()
+    with gzip.GzipFile(fileobj=buf, mode="wb", compresslevel=9, mtime=0) as f:
+        f.write(data)
+    # end with
+    return buf.getvalue()
+# end gzipCompress()
+
+#    Returns the (extension, compress function) list of the requested content codings, brotli first.
+def codingsGet(useGzip, useBrotli):
+    codings = []
+    if (useBrotli == True):
+        try:
+            import brotli
+        except ImportError:
+            logging.error("fatal: --brotli requires the 'brotli' Python module.")
+            sys.exit(1)
+        # end try
+        codings.append((CODED_EXT_BR, lambda data: brotli.compress(data, quality=11)))
+    # end if
+
+    if (useGzip == True):
+        codings.append((CODED_EXT_GZIP, gzipCompress))
+    # end if
+
+    return codings
+# end codingsGet()
+
+#    Builds the pre-compressed variants of the files in a temporary folder. A variant is only kept when
+#    it is smaller than its file. Variants are named after their file, with the coding extension appended.
+def buildCodedVariants(file_list, codings, tempDir):
+    variants = []
+    for relative_path, source_path, destination_path in file_list:
+        with open(source_path, "rb") as f:
+            data = f.read()
+        # end with
+
+        for ext, compress in codings:
+            coded = compress(data)
+            if (len(coded) >= len(data)):
+                logging.debug('%s : %s variant not smaller, skipped' % (relative_path, ext))
+                continue
+            # end if
+
+            coded_relative_path    = relative_path + ext
+            coded_destination_path = FinalFileNameGet(createFSPath(coded_relative_path))
+            coded_source_path      = os.path.join(tempDir, coded_destination_path)
+            with open(coded_source_path, "wb") as f:
+                f.write(coded)
+            # end with
+
+            logging.debug('%s : %d -> %d' % (coded_relative_path, len(data), len(coded)))
+            variants.append((coded_relative_path, coded_source_path, coded_destination_path))
+        # end for
+    # end for
+
+    return variants
+# end buildCodedVariants()
+
+
+
+def Generate(sourceDir, generateDir, fsType, exclude_template=False, force=False, image=False, bigEndian=False, useGzip=False, useBrotli=False):
     #    GENERATION SECTION
 
     #    Create the generated directory if it doesn't exist
@@ -219,12 +399,38 @@ def Generate(sourceDir, generateDir, fsType, exclude_template=False, force=False
         file_list.append((relative_path, source_path, destination_path))
     # end if
 
+    # Add the pre-compressed variants, served by the HTTP server according to the Accept-Encoding header.
+    codings  = codingsGet(useGzip, useBrotli)
+    temp_dir = None
+    if (len(codings) > 0):
+        temp_dir   = tempfile.mkdtemp()
+        file_list += buildCodedVariants(file_list, codings, temp_dir)
+    # end if
+
+    try:
+        GenerateFiles(file_list, generateDir, fsType, exclude_template, force, image, bigEndian)
+    finally:
+        if (temp_dir != None):
+            shutil.rmtree(temp_dir)
+        # end if
+    # end try
+# end Generate()
+
+def GenerateFiles(file_list, generateDir, fsType, exclude_template, force, image, bigEndian):
+    #    List of the generated headers
+    generatedHeaders = []
+
     logging.debug('\n%s' % str(file_list))
 
     # Check for existing files. Do not overwrite file unless --force is specified.
+    if (image == True):
+        dest_file_list = [os.path.join(generateDir, IMAGE_FILE_NAME)]
+    else:
+        dest_file_list = [os.path.join(generateDir, destination_path + '.h') for relative_path, source_path, destination_path in file_list]
+    # end if
+
     existing_file_list = []
-    for relative_path, source_path, destination_path in file_list:
-        dest_file_path = os.path.join(generateDir, destination_path + '.h')
+    for dest_file_path in dest_file_list:
         if (os.path.exists(dest_file_path)):
             existing_file_list.append(dest_file_path)
             logging.debug('Adding %s to existing_file_list.' % dest_file_path)
@@ -252,6 +458,11 @@ def Generate(sourceDir, generateDir, fsType, exclude_template=False, force=False
         sys.exit(1)
     # end if
 
+    if (image == True):
+        GenerateImage(file_list, generateDir, bigEndian, exclude_template)
+        return
+    # end if
+
     #    generate the header files
     for relative_path, source_path, destination_path in file_list:
         #    remove destination files from the generated directory
@@ -295,7 +506,7 @@ def Generate(sourceDir, generateDir, fsType, exclude_template=False, force=False
         includeBlock = '\n'.join([includeTemplate.format(name=h.name) for h in generatedHeaders])
         writeFile(os.path.join(generateDir, "generated_fs.h"), guardedFSHeaderTemplate.format(macro="GENERATED_FS", content=includeBlock));
     # end if
-# end Generate()
+# end GenerateFiles()
 
 # If called from command line
 if __name__ == '__main__':
@@ -306,8 +517,12 @@ if __name__ == '__main__':
     #parser.add_argument("fsType",      choices=['static', 'dynamic'],    help="Type of file-system to be used.")
     parser.add_argument("--exclude-template", "-x", action='store_true', help="Exclude Static and Dynamic FS %s()." % TEMPLATE_FUNCTION_NAME)
     parser.add_argument("--force", "-f",            action='store_true', help="Overwrite generated files.")
+    parser.add_argument("--image", "-i",            action='store_true', help="Generate a single Static FS image (%s) instead of one header per file." % IMAGE_FILE_NAME)
+    parser.add_argument("--big-endian", "-b",       action='store_true', help="Generate the image for a big-endian target.")
+    parser.add_argument("--gzip", "-z",             action='store_true', help="Add a gzip ('%s') variant of each file, when smaller." % CODED_EXT_GZIP)
+    parser.add_argument("--brotli", "-r",           action='store_true', help="Add a brotli ('%s') variant of each file, when smaller. Requires the 'brotli' module." % CODED_EXT_BR)
     args = parser.parse_args()
 
     #Generate(args.source, args.generateDir, args.fsType, args.exclude_template, args.force)
-    Generate(args.source, args.generateDir, 'static', args.exclude_template, args.force)
+    Generate(args.source, args.generateDir, 'static', args.exclude_template, args.force, args.image, args.big_endian, args.gzip, args.brotli)
 # end if
@@ -38,6 +38,14 @@
 *            (3) Should be compatible with the following TCP/IP application versions (or more recent):
 *
 *                (a) uC/HTTPs V2.00.00
+*
+*            (4) Files are found by name through a case insensitive hash index built as files are added,
+*                and open files are taken from a free list, so opening a file does not depend on the
+*                number of files in the file system.
+*
+*            (5) Files can also be provided as a single file system image generated by GenerateFS.py
+*                (see HTTPs_FS_AddImg()). The image holds its own hash index, so it is used in place
+*                without registering its files.
 *********************************************************************************************************
 */
 
@@ -74,6 +82,16 @@
 #define  NET_FS_ENTRY_ATTRIB_HIDDEN             DEF_BIT_02      /* Entry is hidden from user-level processes.           */
 #define  NET_FS_ENTRY_ATTRIB_DIR                DEF_BIT_03      /* Entry is a directory.                                */
 
+                                                                /* Nbr of file name hash slots (see Note #4).           */
+#define  HTTPs_FS_HASH_SLOT_NBR                 HTTPs_FS_CFG_NBR_FILES
+#define  HTTPs_FS_HASH_IX_NONE                  DEF_INT_16U_MAX_VAL
+
+                                                                /* File system image (see Note #5).                     */
+#define  HTTPs_FS_IMG_MAGIC                     "uHFS"
+#define  HTTPs_FS_IMG_MAGIC_LEN                            4u
+#define  HTTPs_FS_IMG_VER                                  1u
+#define  HTTPs_FS_IMG_IX_NONE                   DEF_INT_32U_MAX_VAL
+
 
 /*
 *********************************************************************************************************
@@ -94,6 +112,9 @@ typedef  struct  https_fs_file_data {
     void               *DataPtr;                                /* Ptr to file data.                                    */
     CPU_INT32S          Size;                                   /* Size of file, in octets.                             */
     CPU_SIZE_T          NameSimilarity;                         /* Max similarity between name & prev file name.        */
+    CPU_INT32U          NameHash;                               /* Hash of file name.                                   */
+    CPU_INT16U          HashNextIx;                             /* Ix of next file data in same hash slot.              */
+    CPU_INT32U          ETag;                                   /* Entity tag of file data; 0 if none.                  */
 } HTTPs_FS_FILE_DATA;
 
 /*
@@ -102,10 +123,51 @@ typedef  struct  https_fs_file_data {
 *********************************************************************************************************
 */
 
-typedef  struct  https_fs_file {
+typedef  struct  https_fs_file  HTTPs_FS_FILE;
+
+struct  https_fs_file {
     HTTPs_FS_FILE_DATA  *FileDataPtr;                           /* Ptr to file info.                                    */
     CPU_INT32S           Pos;                                   /* File pos, in octets.                                 */
-} HTTPs_FS_FILE;
+    HTTPs_FS_FILE       *NextPtr;                               /* Ptr to next free file.                               */
+    HTTPs_FS_FILE_DATA   ImgFileData;                           /* Info of file opened from the image.                  */
+};
+
+
+/*
+*********************************************************************************************************
+*                                     FILE SYSTEM IMAGE DATA TYPES
+*
+* Note(s) : (1) The image is made of a header, a hash slot table, a file entry table, the file names & the
+*               file data. Offsets are from the beginning of the image; all fields are 32-bit words in the CPU
+*               byte order.
+*
+*           (2) Each hash slot holds the index of the first file entry of the slot & each entry the index of
+*               the next entry of the same slot, or HTTPs_FS_IMG_IX_NONE.
+*
+*           (3) The name hash is computed as in HTTPs_FS_CalcNameHash() & the entity tag is the CRC-32 of the
+*               file data.
+*********************************************************************************************************
+*/
+
+typedef  struct  https_fs_img_hdr {
+    CPU_CHAR            Magic[HTTPs_FS_IMG_MAGIC_LEN];          /* Image magic, HTTPs_FS_IMG_MAGIC.                     */
+    CPU_INT32U          Ver;                                    /* Image format version.                                */
+    CPU_INT32U          FileNbr;                                /* Nbr of file entries.                                 */
+    CPU_INT32U          SlotNbr;                                /* Nbr of hash slots.                                   */
+    CPU_INT32U          SlotTblOffset;                          /* Offset of hash slot tbl.                             */
+    CPU_INT32U          EntryTblOffset;                         /* Offset of file entry tbl.                            */
+    CPU_INT32U          Size;                                   /* Size of image, in octets.                            */
+    CPU_INT32U          Rsvd;
+} HTTPs_FS_IMG_HDR;
+
+typedef  struct  https_fs_img_entry {
+    CPU_INT32U          NameHash;                               /* Hash of file name (see Note #3).                     */
+    CPU_INT32U          NextIx;                                 /* Ix of next entry in same hash slot (see Note #2).    */
+    CPU_INT32U          NameOffset;                             /* Offset of file name.                                 */
+    CPU_INT32U          DataOffset;                             /* Offset of file data.                                 */
+    CPU_INT32U          Size;                                   /* Size of file, in octets.                             */
+    CPU_INT32U          ETag;                                   /* Entity tag of file data (see Note #3).               */
+} HTTPs_FS_IMG_ENTRY;
 
 
 /*
@@ -134,6 +196,12 @@ static  HTTPs_FS_FILE       HTTPs_FS_FileTbl[HTTPs_FS_CFG_NBR_FILES];       /* I
 
 static  HTTPs_FS_FILE_DATA  HTTPs_FS_FileDataTbl[HTTPs_FS_CFG_NBR_FILES];   /* Data about files on file system.         */
 
+static  HTTPs_FS_FILE      *HTTPs_FS_FileFreePtr;                           /* Ptr to first free file.                  */
+
+static  CPU_INT16U          HTTPs_FS_HashTbl[HTTPs_FS_HASH_SLOT_NBR];       /* Ix of first file data in each hash slot. */
+
+static  const  HTTPs_FS_IMG_HDR    *HTTPs_FS_ImgPtr;                        /* Ptr to file system image.                */
+
 static  HTTPs_FS_DIR        HTTPs_FS_DirTbl[HTTPs_FS_CFG_NBR_DIRS];         /* Info about open dirs.                    */
 
 static  CPU_INT16U          HTTPs_FS_FileAddedCnt;                          /* Nbr of files added.                      */
@@ -206,6 +274,12 @@ static  CPU_BOOLEAN   HTTPs_FS_FileDateTimeCreateGet(void                *p_file
 static  CPU_SIZE_T    HTTPs_FS_CalcSimilarity      (CPU_CHAR             *p_name_1,
                                                     CPU_CHAR             *p_name_2);
 
+static  CPU_INT32U    HTTPs_FS_CalcNameHash        (CPU_CHAR             *p_name);
+
+static  CPU_BOOLEAN   HTTPs_FS_ImgFileFind         (CPU_CHAR             *p_name,
+                                                    CPU_INT32U            hash,
+                                                    HTTPs_FS_FILE_DATA   *p_file_data);
+
 
 /*
 *********************************************************************************************************
@@ -390,11 +464,14 @@ CPU_BOOLEAN  HTTPs_FS_Init (void)
 
 
                                                                 /* -------------------- INIT FILES -------------------- */
-    for (i = 0u; i < HTTPs_FS_CFG_NBR_FILES; i++) {
-        p_file = &HTTPs_FS_FileTbl[i];
-
-        p_file->FileDataPtr = (HTTPs_FS_FILE_DATA *)0;
-        p_file->Pos         =  0u;
+    HTTPs_FS_FileFreePtr = (HTTPs_FS_FILE *)0;
+    for (i = HTTPs_FS_CFG_NBR_FILES; i > 0u; i--) {             /* Build free file list.                                */
+        p_file = &HTTPs_FS_FileTbl[i - 1u];
+
+        p_file->FileDataPtr  = (HTTPs_FS_FILE_DATA *)0;
+        p_file->Pos          =  0u;
+        p_file->NextPtr      =  HTTPs_FS_FileFreePtr;
+        HTTPs_FS_FileFreePtr =  p_file;
     }
 
     HTTPs_FS_FileAddedCnt = 0u;
@@ -409,8 +486,17 @@ CPU_BOOLEAN  HTTPs_FS_Init (void)
         p_file_data->DataPtr        = (void     *)0;
         p_file_data->Size           =  0u;
         p_file_data->NameSimilarity =  0u;
+        p_file_data->NameHash       =  0u;
+        p_file_data->HashNextIx     =  HTTPs_FS_HASH_IX_NONE;
+        p_file_data->ETag           =  0u;
     }
 
+    for (i = 0u; i < HTTPs_FS_HASH_SLOT_NBR; i++) {
+        HTTPs_FS_HashTbl[i] = HTTPs_FS_HASH_IX_NONE;
+    }
+
+    HTTPs_FS_ImgPtr = (const HTTPs_FS_IMG_HDR *)0;
+
 
 
                                                                 /* --------------------- INIT DIRS -------------------- */
@@ -463,6 +549,9 @@ CPU_BOOLEAN  HTTPs_FS_Init (void)
 *                   (c) MUST not end with a path separator character.
 *                   (d) MUST not duplicate the parent directory of a file already added.
 *                   (e) MUST not duplicate a file already added.
+*
+*               (2) The file data is linked in the hash slot of its name so that HTTPs_FS_FileOpen() only
+*                   compares the names of the files in that slot.
 *********************************************************************************************************
 */
 
@@ -478,6 +567,8 @@ CPU_BOOLEAN  HTTPs_FS_AddFile (CPU_CHAR    *p_name,
     CPU_SIZE_T           len;
     CPU_SIZE_T           similarity;
     CPU_SIZE_T           similarity_max;
+    CPU_INT32U           hash;
+    CPU_INT16U           slot_ix;
 
 
 #if (HTTPs_FS_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                /* ------------------ VALIDATE PTRS ------------------- */
@@ -539,15 +630,115 @@ CPU_BOOLEAN  HTTPs_FS_AddFile (CPU_CHAR    *p_name,
     }
 
     p_file_data = &HTTPs_FS_FileDataTbl[HTTPs_FS_FileAddedCnt];
-    HTTPs_FS_FileAddedCnt++;
 
 
 
                                                                 /* --------------------- ADD FILE --------------------- */
+    hash    = HTTPs_FS_CalcNameHash(p_filename);
+    slot_ix = (CPU_INT16U)(hash % HTTPs_FS_HASH_SLOT_NBR);
+
     p_file_data->NamePtr        = p_filename;                   /* Populate file data.                                  */
     p_file_data->DataPtr        = p_data;
     p_file_data->Size           = size;
     p_file_data->NameSimilarity = similarity_max;
+    p_file_data->NameHash       = hash;
+    p_file_data->HashNextIx     = HTTPs_FS_HashTbl[slot_ix];    /* Link file data in hash slot (see Note #2).           */
+    p_file_data->ETag           = 0u;                           /* No entity tag for files added at run-time.           */
+
+    HTTPs_FS_HashTbl[slot_ix]   = HTTPs_FS_FileAddedCnt;
+    HTTPs_FS_FileAddedCnt++;
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          HTTPs_FS_AddImg()
+*
+* Description : Add a file system image to the static file system.
+*
+* Argument(s) : p_img   Pointer to the image.
+*
+*               size    Size of the image, in octets.
+*
+* Return(s)   : DEF_OK,   if image added.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : Application.
+*
+*               This function is a HTTPs server application programming interface (API) function
+*               & MAY be called by application function(s).
+*
+* Note(s)     : (1) The image is generated by GenerateFS.py (see option '--image') & can be linked with the
+*                   application or loaded/mapped in memory from a file. It is used in place, so it :
+*
+*                   (a) MUST be aligned on a 32-bit word boundary.
+*                   (b) MUST be generated with the byte order of the CPU.
+*                   (c) MUST stay valid as long as the file system is used.
+*
+*               (2) Only the header & the tables bounds are validated, so adding an image does not depend on
+*                   the number of files it holds. Each file entry is validated when the file is opened (see
+*                   HTTPs_FS_ImgFileFind()).
+*
+*               (3) A single image can be added; adding another image replaces the previous one. Files
+*                   MUST NOT be open while the image is replaced.
+*
+*               (4) The files of the image are found before the files added with HTTPs_FS_AddFile(), but
+*                   are not listed by directory reads.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  HTTPs_FS_AddImg (const  void        *p_img,
+                                     CPU_INT32U   size)
+{
+    const  HTTPs_FS_IMG_HDR  *p_hdr;
+           CPU_INT16S         cmp_val;
+
+
+#if (HTTPs_FS_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                /* ------------------ VALIDATE PTRS ------------------- */
+    if (p_img == (const void *)0) {                             /* Validate NULL img.                                   */
+        return (DEF_FAIL);
+    }
+#endif
+
+                                                                /* ------------------ VALIDATE IMG HDR ---------------- */
+    if (((CPU_ADDR)p_img % sizeof(CPU_INT32U)) != 0u) {         /* Validate img alignment (see Note #1a).               */
+        return (DEF_FAIL);
+    }
+
+    if (size < sizeof(HTTPs_FS_IMG_HDR)) {
+        return (DEF_FAIL);
+    }
+
+    p_hdr   = (const HTTPs_FS_IMG_HDR *)p_img;
+    cmp_val =  Str_Cmp_N(p_hdr->Magic, HTTPs_FS_IMG_MAGIC, HTTPs_FS_IMG_MAGIC_LEN);
+    if (cmp_val != 0) {
+        return (DEF_FAIL);
+    }
+
+    if ((p_hdr->Ver  != HTTPs_FS_IMG_VER) ||                    /* Validate byte order & version (see Note #1b).        */
+        (p_hdr->Size >  size)) {
+        return (DEF_FAIL);
+    }
+
+                                                                /* ----------------- VALIDATE IMG TBLS ---------------- */
+    if ((p_hdr->SlotNbr                             == 0u) ||   /* Validate hash slot tbl (see Note #2).                */
+        ((p_hdr->SlotTblOffset % sizeof(CPU_INT32U)) != 0u) ||
+        ( p_hdr->SlotTblOffset                      >  p_hdr->Size) ||
+        ( p_hdr->SlotNbr > ((p_hdr->Size - p_hdr->SlotTblOffset) / sizeof(CPU_INT32U)))) {
+        return (DEF_FAIL);
+    }
+
+    if (((p_hdr->EntryTblOffset % sizeof(CPU_INT32U)) != 0u) || /* Validate file entry tbl.                             */
+        ( p_hdr->EntryTblOffset                      >  p_hdr->Size) ||
+        ( p_hdr->FileNbr > ((p_hdr->Size - p_hdr->EntryTblOffset) / sizeof(HTTPs_FS_IMG_ENTRY)))) {
+        return (DEF_FAIL);
+    }
+
+                                                                /* ---------------------- ADD IMG --------------------- */
+    HTTPs_FS_ImgPtr = p_hdr;                                    /* See Note #3.                                         */
 
     return (DEF_OK);
 }
@@ -595,6 +786,57 @@ CPU_BOOLEAN  HTTPs_FS_SetTime (NET_FS_DATE_TIME  *p_time)
 }
 
 
+/*
+*********************************************************************************************************
+*                                        HTTPs_FS_FileETagGet()
+*
+* Description : Get the entity tag of a file.
+*
+* Argument(s) : p_file  Pointer to a file.
+*
+*               p_etag  Pointer to variable that will receive the entity tag.
+*
+* Return(s)   : DEF_OK,   if entity tag gotten.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : Application (see 'http-s.h  HTTPs_CFG_FS_STATIC').
+*
+* Note(s)     : (1) The entity tag is the CRC-32 of the file data computed when the image is generated (see
+*                   HTTPs_FS_AddImg()). Files added with HTTPs_FS_AddFile() have no entity tag & the server
+*                   derives one from the file size & date/time.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  HTTPs_FS_FileETagGet (void        *p_file,
+                                   CPU_INT32U  *p_etag)
+{
+    HTTPs_FS_FILE_DATA  *p_file_data;
+    HTTPs_FS_FILE       *p_file_fs;
+
+
+#if (HTTPs_FS_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)                 /* ---------------- VALIDATE ARG PTRS ----------------- */
+    if (p_etag == (CPU_INT32U *)0) {                            /* Validate NULL entity tag ptr.                        */
+        return (DEF_FAIL);
+    }
+    if (p_file == (void *)0) {                                  /* Validate NULL file ptr.                              */
+        return (DEF_FAIL);
+    }
+#endif
+
+                                                                /* ------------------ GET ENTITY TAG ------------------ */
+    p_file_fs   = (HTTPs_FS_FILE *)p_file;
+    p_file_data =  p_file_fs->FileDataPtr;
+    if (p_file_data->ETag == 0u) {                              /* See Note #1.                                         */
+        return (DEF_FAIL);
+    }
+
+   *p_etag = p_file_data->ETag;
+
+    return (DEF_OK);
+}
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -1034,6 +1276,14 @@ static  CPU_BOOLEAN  HTTPs_FS_EntryTimeSet (CPU_CHAR          *p_name,
 * Caller(s)   : HTTPs_FS_API_Static.
 *
 * Note(s)     : (1) Read operations ONLY supported; file can ONLY be opened in a read mode.
+*
+*               (2) Only the files in the hash slot of the name are compared, & only when their name hash
+*                   matches (see HTTPs_FS_AddFile() Note #2).
+*
+*               (3) The file is taken from the free file list (see HTTPs_FS_FileClose()).
+*
+*               (4) The file system image is searched first (see HTTPs_FS_AddImg() Note #4). The information
+*                   of a file found in the image is kept in the file itself.
 *********************************************************************************************************
 */
 
@@ -1044,8 +1294,10 @@ static  void  *HTTPs_FS_FileOpen (CPU_CHAR            *p_name,
     CPU_INT16S          cmp_val;
     HTTPs_FS_FILE       *p_file;
     HTTPs_FS_FILE_DATA  *p_file_data;
+    HTTPs_FS_FILE_DATA   file_data_img;
     CPU_BOOLEAN         found;
-    CPU_INT32U          i;
+    CPU_INT32U          hash;
+    CPU_INT16U          file_data_ix;
     CPU_SR_ALLOC();
 
 
@@ -1087,16 +1339,28 @@ static  void  *HTTPs_FS_FileOpen (CPU_CHAR            *p_name,
 
 
                                                                 /* ------------------- FIND FILE DATA ----------------- */
-    found      =  DEF_NO;
-    p_file_data = &HTTPs_FS_FileDataTbl[0];
-    for (i = 0u; i < HTTPs_FS_FileAddedCnt; i++) {
-        cmp_val = Str_CmpIgnoreCase(p_file_data->NamePtr, p_name);
-        if (cmp_val == 0) {
-            found = DEF_YES;
-            break;
+    p_file_data  = (HTTPs_FS_FILE_DATA *)0;
+    hash         = HTTPs_FS_CalcNameHash(p_name);
+                                                                /* Search img first (see Note #4).                      */
+    found        = HTTPs_FS_ImgFileFind(p_name, hash, &file_data_img);
+    file_data_ix = HTTPs_FS_HASH_IX_NONE;
+    if (found == DEF_YES) {
+        p_file_data  = &file_data_img;
+    } else {
+        file_data_ix =  HTTPs_FS_HashTbl[hash % HTTPs_FS_HASH_SLOT_NBR];
+    }
+
+    while (file_data_ix != HTTPs_FS_HASH_IX_NONE) {             /* See Note #2.                                         */
+        p_file_data = &HTTPs_FS_FileDataTbl[file_data_ix];
+        if (p_file_data->NameHash == hash) {
+            cmp_val = Str_CmpIgnoreCase(p_file_data->NamePtr, p_name);
+            if (cmp_val == 0) {
+                found = DEF_YES;
+                break;
+            }
         }
 
-        p_file_data++;
+        file_data_ix = p_file_data->HashNextIx;
     }
 
     if (found == DEF_NO) {                                      /* If file data NOT found ...                           */
@@ -1105,30 +1369,27 @@ static  void  *HTTPs_FS_FileOpen (CPU_CHAR            *p_name,
 
 
 
-                                                                /* ------------------ FIND FREE FILE ------------------ */
-    found =  DEF_NO;
-    p_file = &HTTPs_FS_FileTbl[0];
-
+                                                                /* ------------------ GET FREE FILE ------------------- */
     CPU_CRITICAL_ENTER();
-    for (i = 0u; i < HTTPs_FS_CFG_NBR_FILES; i++) {
-        if (p_file->FileDataPtr == (HTTPs_FS_FILE_DATA *)0) {
-            found = DEF_YES;
-            break;
-        }
-
-        p_file++;
-    }
-
-    if (found == DEF_NO) {                                      /* If no free file found ...                            */
+    p_file = HTTPs_FS_FileFreePtr;                              /* See Note #3.                                         */
+    if (p_file == (HTTPs_FS_FILE *)0) {                         /* If no free file avail ...                            */
         CPU_CRITICAL_EXIT();
         return ((void *)0);                                     /* ... rtn NULL ptr.                                    */
     }
 
+    HTTPs_FS_FileFreePtr = p_file->NextPtr;
+
 
 
                                                                 /* -------------------- OPEN FILE --------------------- */
+    if (p_file_data == &file_data_img) {                        /* Keep img file info in file (see Note #4).            */
+        p_file->ImgFileData =  file_data_img;
+        p_file_data         = &p_file->ImgFileData;
+    }
+
     p_file->FileDataPtr = p_file_data;
     p_file->Pos         = 0u;
+    p_file->NextPtr     = (HTTPs_FS_FILE *)0;
     CPU_CRITICAL_EXIT();
 
     return ((void *)p_file);
@@ -1147,7 +1408,8 @@ static  void  *HTTPs_FS_FileOpen (CPU_CHAR            *p_name,
 *
 * Caller(s)   : Application.
 *
-* Note(s)     : none.
+* Note(s)     : (1) The file is returned to the free file list. A file already closed is ignored so that it
+*                   can't be linked twice in the list.
 *********************************************************************************************************
 */
 
@@ -1169,8 +1431,15 @@ static  void  HTTPs_FS_FileClose (void  *p_file)
 
                                                                 /* -------------------- CLOSE FILE -------------------- */
     CPU_CRITICAL_ENTER();
+    if (p_file_fs->FileDataPtr == (HTTPs_FS_FILE_DATA *)0) {    /* If file already closed ...                           */
+        CPU_CRITICAL_EXIT();
+        return;                                                 /* ... rtn (see Note #1).                               */
+    }
+
     p_file_fs->FileDataPtr = (HTTPs_FS_FILE_DATA *)0;
     p_file_fs->Pos         =  0u;
+    p_file_fs->NextPtr     =  HTTPs_FS_FileFreePtr;
+    HTTPs_FS_FileFreePtr   =  p_file_fs;
     CPU_CRITICAL_EXIT();
 }
 
@@ -1511,6 +1780,125 @@ static  CPU_SIZE_T  HTTPs_FS_CalcSimilarity (CPU_CHAR  *p_name_1,
 }
 
 
+/*
+*********************************************************************************************************
+*                                        HTTPs_FS_CalcNameHash()
+*
+* Description : Calculate the hash of a file name.
+*
+* Argument(s) : p_name      Pointer to file name.
+*
+* Return(s)   : Hash of the file name.
+*
+* Caller(s)   : HTTPs_FS_AddFile(),
+*               HTTPs_FS_FileOpen().
+*
+* Note(s)     : (1) The hash is case insensitive since file names are compared with Str_CmpIgnoreCase().
+*
+*               (2) Every character is hashed (FNV-1a) since the file names of a same directory share their
+*                   leading characters.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  HTTPs_FS_CalcNameHash (CPU_CHAR  *p_name)
+{
+    CPU_INT32U  hash;
+
+
+    hash = 2166136261u;
+    while (*p_name != ASCII_CHAR_NULL) {
+        hash ^= (CPU_INT08U)ASCII_TO_LOWER(*p_name);
+        hash *= 16777619u;
+        p_name++;
+    }
+
+    return (hash);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        HTTPs_FS_ImgFileFind()
+*
+* Description : Find a file in the file system image.
+*
+* Argument(s) : p_name          Name of the file.
+*
+*               hash            Hash of the file name.
+*
+*               p_file_data     Pointer to variable that will receive the file information.
+*
+* Return(s)   : DEF_YES, if file found.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : HTTPs_FS_FileOpen().
+*
+* Note(s)     : (1) The file entries are validated before they are used (see HTTPs_FS_AddImg() Note #2). The
+*                   number of entries walked is bounded by the number of files of the image so that a
+*                   corrupted slot chain can't loop.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  HTTPs_FS_ImgFileFind (CPU_CHAR            *p_name,
+                                           CPU_INT32U           hash,
+                                           HTTPs_FS_FILE_DATA  *p_file_data)
+{
+    const  HTTPs_FS_IMG_HDR    *p_hdr;
+    const  HTTPs_FS_IMG_ENTRY  *p_entry_tbl;
+    const  HTTPs_FS_IMG_ENTRY  *p_entry;
+    const  CPU_INT32U          *p_slot_tbl;
+    const  CPU_INT08U          *p_img;
+           CPU_INT32U           entry_ix;
+           CPU_INT32U           walk_cnt;
+           CPU_INT16S           cmp_val;
+
+
+    p_hdr = HTTPs_FS_ImgPtr;
+    if (p_hdr == (const HTTPs_FS_IMG_HDR *)0) {                 /* If no img added ...                                  */
+        return (DEF_NO);                                        /* ... file not found.                                  */
+    }
+
+    p_img       = (const CPU_INT08U         *)p_hdr;
+    p_slot_tbl  = (const CPU_INT32U         *)(p_img + p_hdr->SlotTblOffset);
+    p_entry_tbl = (const HTTPs_FS_IMG_ENTRY *)(p_img + p_hdr->EntryTblOffset);
+
+    entry_ix    =  p_slot_tbl[hash % p_hdr->SlotNbr];
+    walk_cnt    =  0u;
+    while ((entry_ix <  p_hdr->FileNbr) &&                      /* See Note #1.                                         */
+           (walk_cnt <  p_hdr->FileNbr)) {
+        p_entry = &p_entry_tbl[entry_ix];
+        if ((p_entry->NameHash   == hash) &&
+            (p_entry->NameOffset <  p_hdr->Size)) {
+            cmp_val = Str_CmpIgnoreCase_N((CPU_CHAR *)(p_img + p_entry->NameOffset),
+                                           p_name,
+                                           p_hdr->Size - p_entry->NameOffset);
+            if (cmp_val == 0) {
+                if ((p_entry->DataOffset > p_hdr->Size) ||      /* Validate file data bounds.                           */
+                    (p_entry->Size       > p_hdr->Size - p_entry->DataOffset)) {
+                    return (DEF_NO);
+                }
+
+                p_file_data->NamePtr        = (CPU_CHAR *)(p_img + p_entry->NameOffset);
+                p_file_data->DataPtr        = (void     *)(p_img + p_entry->DataOffset);
+                p_file_data->Size           = (CPU_INT32S) p_entry->Size;
+                p_file_data->NameSimilarity =  0u;
+                p_file_data->NameHash       =  hash;
+                p_file_data->HashNextIx     =  HTTPs_FS_HASH_IX_NONE;
+                p_file_data->ETag           =  p_entry->ETag;
+
+                return (DEF_YES);
+            }
+        }
+
+        entry_ix = p_entry->NextIx;
+        walk_cnt++;
+    }
+
+    return (DEF_NO);
+}
+
+
 /*
 *********************************************************************************************************
 *                                   HTTPs_FS_FileDateTimeCreateGet()
@@ -68,13 +68,19 @@ extern  const  NET_FS_API  HTTPs_FS_API_Static;
 *********************************************************************************************************
 */
 
-CPU_BOOLEAN  HTTPs_FS_Init     (void);
+CPU_BOOLEAN  HTTPs_FS_Init        (void);
 
-CPU_BOOLEAN  HTTPs_FS_AddFile  (CPU_CHAR          *p_name,
-                                void              *p_data,
-                                CPU_INT32U         size);
+CPU_BOOLEAN  HTTPs_FS_AddFile     (CPU_CHAR          *p_name,
+                                   void              *p_data,
+                                   CPU_INT32U         size);
 
-CPU_BOOLEAN  HTTPs_FS_SetTime  (NET_FS_DATE_TIME  *p_time);
+CPU_BOOLEAN  HTTPs_FS_AddImg      (const  void       *p_img,
+                                   CPU_INT32U         size);
+
+CPU_BOOLEAN  HTTPs_FS_SetTime     (NET_FS_DATE_TIME  *p_time);
+
+CPU_BOOLEAN  HTTPs_FS_FileETagGet (void              *p_file,
+                                   CPU_INT32U        *p_etag);
 
 
 
@@ -41,6 +41,7 @@
 #include  "http-s_sock.h"
 #include  "http-s_req.h"
 #include  "http-s_resp.h"
+#include  "http-s_deflate.h"
 #include  <Source/net_cfg_net.h>
 
 #ifdef  NET_IPv4_MODULE_EN
@@ -73,6 +74,38 @@ const  HTTP_DICT  HTTPs_DictionaryTokenInternal[] = {
 CPU_SIZE_T  HTTPs_DictionarySizeTokenInternal = sizeof(HTTPs_DictionaryTokenInternal);
 
 
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  void  HTTPs_InstanceObjInit       (HTTPs_INSTANCE  *p_instance,
+                                           HTTPs_ERR       *p_err);
+
+static  void  HTTPs_InstanceWorkerInit    (HTTPs_INSTANCE  *p_instance,
+                                           HTTPs_ERR       *p_err);
+
+static  void  HTTPs_InstanceWorkerStop    (HTTPs_INSTANCE  *p_worker,
+                                           CPU_BOOLEAN      graceful_stop_en,
+                                           HTTPs_ERR       *p_err);
+
+static  void  HTTPs_InstanceWorkerRelease (HTTPs_INSTANCE  *p_instance,
+                                           CPU_INT08U       worker_nbr);
+
+static  void  HTTPs_InstanceStartAbort    (HTTPs_INSTANCE  *p_instance,
+                                           CPU_INT08U       worker_nbr);
+
+#if ((HTTPs_CFG_CTR_STAT_EN == DEF_ENABLED) || \
+     (HTTPs_CFG_CTR_ERR_EN  == DEF_ENABLED))
+static  void  HTTPs_InstanceCtrAdd        (       CPU_INT32U  *p_dst,
+                                           const  CPU_INT32U  *p_src,
+                                                  CPU_SIZE_T   nbr);
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                             HTTPs_Init()
@@ -129,6 +162,8 @@ void  HTTPs_Init (MEM_SEG    *p_mem_seg,
     }
     CPU_CRITICAL_EXIT();
 
+    HTTP_Dict_Init();                                           /* Build hdr field dictionary idx.                      */
+
     HTTPsMem_InstanceInit(p_mem_seg, p_err);
     if (*p_err != HTTPs_ERR_NONE) {
          return;
@@ -154,6 +189,7 @@ void  HTTPs_Init (MEM_SEG    *p_mem_seg,
 *                   (d) Get HTTPs server instance.
 *                   (f) Initialize instance OS object.
 *                   (g) Initialize connection pool.
+*                   (h) Initialize instance workers.
 *
 *
 * Argument(s) : p_cfg       Pointer to the instance configuration object.
@@ -173,6 +209,8 @@ void  HTTPs_Init (MEM_SEG    *p_mem_seg,
 *                                                                           NULL pointer.
 *
 *                               HTTPs_ERR_CFG_INVALID_NBR_CONN          Invalid number of connection.
+*                               HTTPs_ERR_CFG_INVALID_NBR_WORKER        Invalid number of worker.
+*                               HTTPs_ERR_CFG_INVALID_CONN_OVERLOAD     Invalid connection overload marks.
 *                               HTTPs_ERR_CFG_INVALID_DFLT_FILE         Default file is a null pointer.
 *                               HTTPs_ERR_CFG_INVALID_SECURE_EN         Invalid secure configuration.
 *                               HTTPs_ERR_CFG_INVALID_HOST_LEN          Invalid host length.
@@ -180,6 +218,8 @@ void  HTTPs_Init (MEM_SEG    *p_mem_seg,
 *                               HTTPs_ERR_CFG_INVALID_FS_SEP_CHAR       Invalid file system separator character.
 *                               HTTPs_ERR_CFG_INVALID_TOKEN_EN          Invalid token configuration.
 *                               HTTPs_ERR_CFG_INVALID_TOKEN_PARAM       Invalid token parameter.
+*                               HTTPs_ERR_CFG_INVALID_DEFLATE_EN        Invalid deflate configuration.
+*                               HTTPs_ERR_CFG_INVALID_DEFLATE_PARAM     Invalid deflate parameter.
 *                               HTTPs_ERR_CFG_INVALID_QUERY_STR_EN      Invalid Query String configuration.
 *                               HTTPs_ERR_CFG_INVALID_QUERY_STR_PARAM   Invalid Query String parameter.
 *                               HTTPs_ERR_CFG_INVALID_FORM_EN           Invalid Form configuration.
@@ -201,6 +241,13 @@ void  HTTPs_Init (MEM_SEG    *p_mem_seg,
 *                               ---------------------- RETURNED BY HTTPsMem_ConnPoolInit() -----------------------
 *                               See HTTPsMem_ConnPoolInit() for additional return error codes.
 *
+*                               ------------------ RETURNED BY SOCKET EVENT BACKEND Init() ---------------------
+*                               See HTTPsSock_EvtSelInit() or the configured backend for additional return error
+*                               codes.
+*
+*                               ----------------------- RETURNED BY HTTPsMem_WorkerInit() ------------------------
+*                               See HTTPsMem_WorkerInit() for additional return error codes.
+*
 * Return(s)   : Pointer to the instance handler, if NO error(s).
 *
 *               NULL pointer,                    otherwise.
@@ -210,7 +257,15 @@ void  HTTPs_Init (MEM_SEG    *p_mem_seg,
 *               This function is a HTTPs server application programming interface (API) function
 *               & MAY be called by application function(s).
 *
-* Note(s)     : none.
+* Note(s)     : (2) When 'WorkerNbr' is greater than 1 in the instance configuration, the instance is made of
+*                   several workers, each one running its own task with its own connection list, pools &
+*                   lock. The returned instance is the primary worker: it owns the listen socket(s) & hands
+*                   the accepted connections to the other workers. The connections of the configuration are
+*                   shared between the workers.
+*
+*               (3) Each worker is seen as an instance by the hook functions. The instance init hook is
+*                   therefore called once per worker so that instance data is never shared between tasks.
+*                   Statistic & error counters are also kept per worker.
 *********************************************************************************************************
 */
 
@@ -225,11 +280,17 @@ HTTPs_INSTANCE  *HTTPs_InstanceInit (const  HTTPs_CFG      *p_cfg,
            CPU_BOOLEAN      init_active;
            CPU_BOOLEAN      hook_def;
            CPU_BOOLEAN      result;
-           KAL_ERR          kal_err;
+           CPU_INT08U       worker_ix;
 #if ((HTTPs_CFG_ARG_CHK_EXT_EN == DEF_ENABLED) && \
      (HTTPs_CFG_FS_PRESENT_EN  == DEF_ENABLED))
            CPU_INT32U       path_len_max;
            CPU_CHAR         path_sep_char;
+#endif
+#if ((HTTPs_CFG_ARG_CHK_EXT_EN == DEF_ENABLED) && \
+     (HTTPs_CFG_DEFLATE_EN     == DEF_ENABLED))
+           CPU_INT32U       data_len_max;
+           CPU_INT16U       win_len;
+           CPU_INT16U       hash_len;
 #endif
     CPU_SR_ALLOC();
 
@@ -341,6 +402,26 @@ HTTPs_INSTANCE  *HTTPs_InstanceInit (const  HTTPs_CFG      *p_cfg,
             return (DEF_NULL);
         }
 
+        if (p_cfg->WorkerNbr > 1u) {                            /* Validate nbr worker.                                 */
+            if (p_cfg->WorkerTaskCfgTbl == DEF_NULL) {
+               *p_err = HTTPs_ERR_CFG_INVALID_NBR_WORKER;
+                return (DEF_NULL);
+            }
+
+            if (p_cfg->WorkerNbr > p_cfg->ConnNbrMax) {
+               *p_err = HTTPs_ERR_CFG_INVALID_NBR_WORKER;
+                return (DEF_NULL);
+            }
+        }
+
+        if (p_cfg->ConnOverloadHighWater > 0u) {                /* Validate overload marks.                             */
+            if ((p_cfg->ConnOverloadHighWater >  p_cfg->ConnNbrMax) ||
+                (p_cfg->ConnOverloadLowWater  >= p_cfg->ConnOverloadHighWater)) {
+               *p_err = HTTPs_ERR_CFG_INVALID_CONN_OVERLOAD;
+                return (DEF_NULL);
+            }
+        }
+
         if (p_cfg->BufLen < HTTPs_BUF_LEN_MIN) {                /* Validate buf len.                                    */
            *p_err = HTTPs_ERR_CFG_INVALID_BUF_LEN;
             return (DEF_NULL);
@@ -501,6 +582,40 @@ HTTPs_INSTANCE  *HTTPs_InstanceInit (const  HTTPs_CFG      *p_cfg,
 #endif  /* HTTPs_CFG_TOKEN_PARSE_EN */
         }
 
+        if (p_cfg->DeflateCfgPtr != DEF_NULL) {                 /* Validate deflate param.                              */
+#if (HTTPs_CFG_DEFLATE_EN == DEF_ENABLED)
+            win_len  = p_cfg->DeflateCfgPtr->WinLen;
+            hash_len = p_cfg->DeflateCfgPtr->HashTblLen;
+                                                                /* Validate win len & hash tbl len as powers of 2.      */
+            if ((win_len <  HTTPs_DEFLATE_WIN_LEN_MIN) ||
+                (win_len >  HTTPs_DEFLATE_WIN_LEN_MAX) ||
+               ((win_len & (win_len - 1u)) != 0u)) {
+               *p_err = HTTPs_ERR_CFG_INVALID_DEFLATE_PARAM;
+                return (DEF_NULL);
+            }
+
+            if ((hash_len <  HTTPs_DEFLATE_HASH_TBL_LEN_MIN) ||
+                (hash_len >  HTTPs_DEFLATE_HASH_TBL_LEN_MAX) ||
+               ((hash_len & (hash_len - 1u)) != 0u)) {
+               *p_err = HTTPs_ERR_CFG_INVALID_DEFLATE_PARAM;
+                return (DEF_NULL);
+            }
+
+            data_len_max = p_cfg->BufLen;
+            if (p_cfg->TokenCfgPtr != DEF_NULL) {
+                data_len_max += p_cfg->TokenCfgPtr->ValLenMax;
+            }
+                                                                /* Compressed chunk must fit in a tx data len.          */
+            if ((HTTPs_DEFLATE_OUT_LEN_MAX(data_len_max) + HTTPs_DEFLATE_CHUNK_OVERHEAD_LEN) > DEF_INT_16U_MAX_VAL) {
+               *p_err = HTTPs_ERR_CFG_INVALID_DEFLATE_PARAM;
+                return (DEF_NULL);
+            }
+#else
+           *p_err = HTTPs_ERR_CFG_INVALID_DEFLATE_EN;           /* Validate deflate en param.                           */
+            return (DEF_NULL);
+#endif  /* HTTPs_CFG_DEFLATE_EN */
+        }
+
         if (p_cfg->QueryStrCfgPtr != DEF_NULL) {
 #if (HTTPs_CFG_QUERY_STR_EN == DEF_ENABLED)
 
@@ -576,68 +691,30 @@ HTTPs_INSTANCE  *HTTPs_InstanceInit (const  HTTPs_CFG      *p_cfg,
         }
 
                                                                 /* ---------- INITIALIZE INSTANCE PARAMETERS ---------- */
-        p_instance->CfgPtr         = p_cfg;
-        p_instance->TaskCfgPtr     = p_task_cfg;
-        p_instance->Started        = DEF_NO;
-        p_instance->SelAbortReq    = DEF_NO;
-
-
-        switch (p_cfg->FS_Type) {
-            case HTTPs_FS_TYPE_NONE:
-                 break;
-
-            case HTTPs_FS_TYPE_STATIC:
-#if (HTTPs_CFG_FS_PRESENT_EN == DEF_ENABLED)
-                 p_fs_api = ((HTTPs_CFG_FS_STATIC *)p_cfg->FS_CfgPtr)->FS_API_Ptr;
-                 p_instance->FS_PathLenMax  = p_fs_api->CfgPathGetLenMax();
-                 p_instance->FS_PathSepChar = p_fs_api->CfgPathGetSepChar();
-#endif
-                 break;
-
-
-            case HTTPs_FS_TYPE_DYN:
-#if (HTTPs_CFG_FS_PRESENT_EN == DEF_ENABLED)
-                 p_fs_api = ((HTTPs_CFG_FS_DYN *)p_cfg->FS_CfgPtr)->FS_API_Ptr;
-                 p_instance->FS_PathLenMax  = p_fs_api->CfgPathGetLenMax();
-                 p_instance->FS_PathSepChar = p_fs_api->CfgPathGetSepChar();
-#endif
-                 break;
-
-            default:
-                *p_err = HTTPs_ERR_CFG_INVALID_FS_TYPE;
-                 return (DEF_NULL);
-        }
-
-
-        p_instance->OS_LockObj = HTTPsTask_LockCreate(p_err);
-        if (*p_err != HTTPs_ERR_NONE){
-             p_instance->OS_TaskObjPtr = (HTTPs_OS_TASK_OBJ *)DEF_NULL;
-             HTTPsMem_InstanceRelease(p_instance);
-             return (DEF_NULL);
+        p_instance->CfgPtr          = p_cfg;
+        p_instance->TaskCfgPtr      = p_task_cfg;
+        p_instance->Started         = DEF_NO;
+        p_instance->SelAbortReq     = DEF_NO;
+        p_instance->WorkerParentPtr = DEF_NULL;
+
+        if (p_cfg->WorkerNbr > 1u) {                            /* See Note #2.                                         */
+            p_instance->WorkerNbr = p_cfg->WorkerNbr;
+        } else {
+            p_instance->WorkerNbr = 1u;
         }
+                                                                /* Share conns between workers.                         */
+        p_instance->ConnNbrMax = (p_cfg->ConnNbrMax + p_instance->WorkerNbr - 1u) / p_instance->WorkerNbr;
 
+        HTTPsSock_ConnOverloadInit(p_instance);                 /* Build overload resp.                                 */
 
-        p_instance->ConnSelAbortLockObj = KAL_LockCreate ("HTTPs Conn Sel Abort Mtx",
-                                                           DEF_NULL,
-                                                          &kal_err);
-
-        if (kal_err != RTOS_ERR_NONE) {
-           *p_err = HTTPs_ERR_TASK_LOCK_CREATE;
-            HTTPsMem_InstanceRelease(p_instance);
-            return (DEF_NULL);
-        }
-
-                                                                /* ------------------- INIT OS OBJ -------------------- */
-        HTTPsTask_InstanceObjInit(p_instance, p_err);
+        HTTPs_InstanceObjInit(p_instance, p_err);
         if (*p_err != HTTPs_ERR_NONE) {
              HTTPsMem_InstanceRelease(p_instance);
              return (DEF_NULL);
         }
 
-
-                                                                /* ------------------ INIT CONN POOL ------------------ */
-        HTTPsMem_ConnPoolInit(p_instance,
-                               p_err);
+                                                                /* ------------------- INIT WORKERS ------------------- */
+        HTTPs_InstanceWorkerInit(p_instance, p_err);
         if (*p_err != HTTPs_ERR_NONE) {
              HTTPsMem_InstanceRelease(p_instance);
              return (DEF_NULL);
@@ -647,12 +724,16 @@ HTTPs_INSTANCE  *HTTPs_InstanceInit (const  HTTPs_CFG      *p_cfg,
         if (hook_def == DEF_YES) {
                                                                 /* If Instance conn objs init handler is not null ...   */
                                                                 /* ... call Instance conn objs init handler.            */
-            result = p_cfg->HooksPtr->OnInstanceInitHook(p_instance,
-                                                         p_cfg->Hooks_CfgPtr);
-            if (result != DEF_OK) {
-                HTTPsMem_InstanceRelease(p_instance);
-               *p_err = HTTPs_ERR_INIT_INSTANCE_HOOK_FAULT;
-                return (DEF_NULL);
+                                                                /* See Note #3.                                         */
+            for (worker_ix = 0u; worker_ix < p_instance->WorkerNbr; worker_ix++) {
+                result = p_cfg->HooksPtr->OnInstanceInitHook(p_instance->WorkerTbl[worker_ix],
+                                                             p_cfg->Hooks_CfgPtr);
+                if (result != DEF_OK) {
+                    HTTPs_InstanceWorkerRelease(p_instance, p_instance->WorkerNbr);
+                    HTTPsMem_InstanceRelease(p_instance);
+                   *p_err = HTTPs_ERR_INIT_INSTANCE_HOOK_FAULT;
+                    return (DEF_NULL);
+                }
             }
         }
 
@@ -681,6 +762,7 @@ HTTPs_INSTANCE  *HTTPs_InstanceInit (const  HTTPs_CFG      *p_cfg,
 *                   (a) Validate return error pointer.
 *                   (b) Initialize instance listen socket.
 *                   (c) Create and start HTTP server instance task.
+*                   (d) Create and start the task of each additional worker.
 *
 * Argument(s) : p_instance  Pointer to specific HTTP server instance handler.
 *
@@ -705,23 +787,26 @@ HTTPs_INSTANCE  *HTTPs_InstanceInit (const  HTTPs_CFG      *p_cfg,
 *               This function is a HTTPs server application programming interface (API) function
 *               & MAY be called by application function(s).
 *
-* Note(s)     : none.
+* Note(s)     : (2) When the task of an additional worker can't be created, the tasks already started are
+*                   stopped, so that the instance is left as it was before the call.
 *********************************************************************************************************
 */
 
 void  HTTPs_InstanceStart (HTTPs_INSTANCE  *p_instance,
                            HTTPs_ERR       *p_err)
 {
-    const  HTTPs_CFG    *p_cfg;
+    const  HTTPs_CFG       *p_cfg;
 #ifdef   NET_IPv4_MODULE_EN
-           NET_SOCK_ID   sock_listen_ipv4;
+           NET_SOCK_ID      sock_listen_ipv4;
 #endif
 #ifdef   NET_IPv6_MODULE_EN
-           NET_SOCK_ID   sock_listen_ipv6;
+           NET_SOCK_ID      sock_listen_ipv6;
 #ifdef NET_IPv4_MODULE_EN
-           NET_ERR       err;
+           NET_ERR          err;
 #endif
 #endif
+           HTTPs_INSTANCE  *p_worker;
+           CPU_INT08U       worker_ix;
            CPU_SR_ALLOC();
 
 
@@ -815,6 +900,19 @@ void  HTTPs_InstanceStart (HTTPs_INSTANCE  *p_instance,
          return;
     }
 
+                                                                /* ------------- START ADDITIONAL WORKERS ------------- */
+    for (worker_ix = 1u; worker_ix < p_instance->WorkerNbr; worker_ix++) {
+        p_worker              = p_instance->WorkerTbl[worker_ix];
+        p_worker->SelAbortReq = DEF_NO;
+
+        HTTPsTask_InstanceTaskCreate(p_worker, p_err);
+        if (*p_err != HTTPs_ERR_NONE) {
+             HTTPsTask_LockRelease(p_instance->OS_LockObj);     /* Release instance lock.                               */
+             HTTPs_InstanceStartAbort(p_instance, worker_ix);   /* See Note #2.                                         */
+             return;
+        }
+    }
+
     CPU_CRITICAL_ENTER();
     ++HTTPs_InstanceRunningNbr;
     CPU_CRITICAL_EXIT();
@@ -836,6 +934,7 @@ void  HTTPs_InstanceStart (HTTPs_INSTANCE  *p_instance,
 *                   (c) Reset any idle connections.
 *                   (d) Signal instance to stop the task.
 *                   (e) Wait for completion of the stopping routine.
+*                   (f) Stop each additional worker.
 *
 * Argument(s) : p_instance        Pointer to Instance handler.
 *
@@ -868,6 +967,9 @@ void  HTTPs_InstanceStart (HTTPs_INSTANCE  *p_instance,
 *                                     ------------------------ RETURNED BY NetSock_SelAbort() -----------------------
 *                                     See NetSock_SelAbort() for additional return error codes.
 *
+*                                     -------------------- RETURNED BY HTTPs_InstanceWorkerStop() -------------------
+*                                     See HTTPs_InstanceWorkerStop() for additional return error codes.
+*
 * Return(s)   : none.
 *
 * Caller(s)   : Application.
@@ -884,11 +986,12 @@ void  HTTPs_InstanceStop (HTTPs_INSTANCE  *p_instance,
                           HTTPs_ERR       *p_err)
 {
     HTTPs_SOCK_SEL   sock_sel;
-    CPU_INT08U       conns;
+    CPU_INT16U       conns;
     HTTPs_CONN      *p_https_conn;
     NET_SOCK_ID      sock_id;
     NET_ERR          net_err;
     NET_ERR          net_err_ipv6;
+    CPU_INT08U       worker_ix;
 
     CPU_SR_ALLOC();
 
@@ -1008,6 +1111,8 @@ void  HTTPs_InstanceStop (HTTPs_INSTANCE  *p_instance,
          return;
     }
 
+    HTTPsSock_InstanceWake(p_instance);                         /* Wake up instance task waiting for sock evts.         */
+
     HTTPsTask_LockRelease(p_instance->OS_LockObj);              /* Release Instance lock before pending.                */
 
                                                                 /* --------------- WAIT STOP COMPLETED ---------------- */
@@ -1031,8 +1136,218 @@ void  HTTPs_InstanceStop (HTTPs_INSTANCE  *p_instance,
 
     HTTPsTask_LockRelease(p_instance->OS_LockObj);              /* Release Instance lock.                               */
 
+                                                                /* ------------- STOP ADDITIONAL WORKERS -------------- */
+    for (worker_ix = 1u; worker_ix < p_instance->WorkerNbr; worker_ix++) {
+        HTTPs_InstanceWorkerStop(p_instance->WorkerTbl[worker_ix],
+                                 graceful_stop_en,
+                                 p_err);
+        if (*p_err != HTTPs_ERR_NONE) {
+             return;
+        }
+    }
+
+   *p_err = HTTPs_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                        HTTPs_InstanceWakeUp()
+*
+* Description : Wake up a HTTPs server instance waiting for socket events.
+*
+* Argument(s) : p_instance  Pointer to the instance handler passed to the hook functions.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               HTTPs_ERR_NONE                  Instance woken up.
+*                               HTTPs_ERR_NULL_PTR              Null instance pointer passed.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+*               This function is an application interface (API) function & MAY be called by application
+*               function(s).
+*
+* Note(s)     : (1) When the request ready poll hook returns DEF_NO, the connection stops being processed
+*                   until it is polled again. The application SHOULD call this function, from any task, as
+*                   soon as the request processing is completed. Otherwise the connection is only polled
+*                   again when the instance task wait times out, i.e. up to one second later.
+*
+*               (2) The instance handler passed to the hook functions MUST be used, since each worker of
+*                   the instance processes its own connections.
+*********************************************************************************************************
+*/
+
+void  HTTPs_InstanceWakeUp (HTTPs_INSTANCE  *p_instance,
+                            HTTPs_ERR       *p_err)
+{
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(;);
+    }
+
+#if (HTTPs_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_instance == DEF_NULL) {
+       *p_err = HTTPs_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    if (p_instance->Started != DEF_YES) {
+       *p_err = HTTPs_ERR_NONE;
+        return;
+    }
+
+    HTTPsSock_InstanceWake(p_instance);
+
+   *p_err = HTTPs_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                       HTTPs_InstanceStatsGet()
+*
+* Description : Get the statistic counters of an instance, summed over all its workers.
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*
+*               p_stats     Pointer to the structure that will receive the counters.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               HTTPs_ERR_NONE                  Counters returned.
+*                               HTTPs_ERR_NULL_PTR              Null pointer passed.
+*
+*                               ------------ RETURNED BY HTTPsTask_LockAcquire() ------------
+*                               See HTTPsTask_LockAcquire() for additional return error codes.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+*               This function is an application interface (API) function & MAY be called by application
+*               function(s).
+*
+* Note(s)     : (1) Each worker counts its own events in its instance structure. The counters read directly
+*                   from the instance structure returned by HTTPs_InstanceInit() only cover the primary
+*                   worker.
+*********************************************************************************************************
+*/
+#if (HTTPs_CFG_CTR_STAT_EN == DEF_ENABLED)
+void  HTTPs_InstanceStatsGet (HTTPs_INSTANCE        *p_instance,
+                              HTTPs_INSTANCE_STATS  *p_stats,
+                              HTTPs_ERR             *p_err)
+{
+    HTTPs_INSTANCE  *p_worker;
+    CPU_INT08U       worker_ix;
+
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(;);
+    }
+
+#if (HTTPs_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if ((p_instance == DEF_NULL) ||
+        (p_stats    == DEF_NULL)) {
+       *p_err = HTTPs_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    Mem_Clr(p_stats, sizeof(HTTPs_INSTANCE_STATS));
+
+    for (worker_ix = 0u; worker_ix < p_instance->WorkerNbr; worker_ix++) {
+        p_worker = p_instance->WorkerTbl[worker_ix];
+                                                                /* Acquire worker lock.                                 */
+        HTTPsTask_LockAcquire(p_worker->OS_LockObj, p_err);
+        if (*p_err != HTTPs_ERR_NONE) {
+            return;
+        }
+                                                                /* See Note #1.                                         */
+        HTTPs_InstanceCtrAdd((CPU_INT32U *)p_stats,
+                             (CPU_INT32U *)&p_worker->StatsCtr,
+                              sizeof(HTTPs_INSTANCE_STATS) / sizeof(CPU_INT32U));
+
+        HTTPsTask_LockRelease(p_worker->OS_LockObj);
+    }
+
    *p_err = HTTPs_ERR_NONE;
 }
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        HTTPs_InstanceErrsGet()
+*
+* Description : Get the error counters of an instance, summed over all its workers.
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*
+*               p_errs      Pointer to the structure that will receive the counters.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               HTTPs_ERR_NONE                  Counters returned.
+*                               HTTPs_ERR_NULL_PTR              Null pointer passed.
+*
+*                               ------------ RETURNED BY HTTPsTask_LockAcquire() ------------
+*                               See HTTPsTask_LockAcquire() for additional return error codes.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Application.
+*
+*               This function is an application interface (API) function & MAY be called by application
+*               function(s).
+*
+* Note(s)     : (1) See HTTPs_InstanceStatsGet() Note #1.
+*********************************************************************************************************
+*/
+#if (HTTPs_CFG_CTR_ERR_EN == DEF_ENABLED)
+void  HTTPs_InstanceErrsGet (HTTPs_INSTANCE       *p_instance,
+                             HTTPs_INSTANCE_ERRS  *p_errs,
+                             HTTPs_ERR            *p_err)
+{
+    HTTPs_INSTANCE  *p_worker;
+    CPU_INT08U       worker_ix;
+
+                                                                /* --------------- VALIDATE RTN ERR PTR --------------- */
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(;);
+    }
+
+#if (HTTPs_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if ((p_instance == DEF_NULL) ||
+        (p_errs     == DEF_NULL)) {
+       *p_err = HTTPs_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    Mem_Clr(p_errs, sizeof(HTTPs_INSTANCE_ERRS));
+
+    for (worker_ix = 0u; worker_ix < p_instance->WorkerNbr; worker_ix++) {
+        p_worker = p_instance->WorkerTbl[worker_ix];
+                                                                /* Acquire worker lock.                                 */
+        HTTPsTask_LockAcquire(p_worker->OS_LockObj, p_err);
+        if (*p_err != HTTPs_ERR_NONE) {
+            return;
+        }
+
+        HTTPs_InstanceCtrAdd((CPU_INT32U *)p_errs,
+                             (CPU_INT32U *)&p_worker->ErrsCtr,
+                              sizeof(HTTPs_INSTANCE_ERRS) / sizeof(CPU_INT32U));
+
+        HTTPsTask_LockRelease(p_worker->OS_LockObj);
+    }
+
+   *p_err = HTTPs_ERR_NONE;
+}
+#endif
 
 
 /*
@@ -1270,6 +1585,10 @@ exit:
 *                   used. In that case, the function can be used with the parameter 'p_data' set to DEF_NULL.
 *                   This will tell the server to use the hook function 'p_cfg->p_hooks->OnRespChunkHook' to
 *                   retrieve the data to put in the HTTP response.
+*
+*               (4) When the data is transmitted without token replacement, the server transmits it straight
+*                   from the memory pointed by 'p_data'. That memory MUST therefore remain valid and unchanged
+*                   until the response is completed (see 'OnTransCompleteHook').
 *********************************************************************************************************
 */
 
@@ -1413,3 +1732,471 @@ exit:
     return;
 }
 
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        HTTPs_InstanceObjInit()
+*
+* Description : (1) Initialize the objects of an instance worker :
+*
+*                   (a) Get file system parameters.
+*                   (b) Create instance locks.
+*                   (c) Initialize instance OS object.
+*                   (d) Initialize connection pool.
+*                   (e) Initialize socket event backend.
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceInit().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               HTTPs_ERR_NONE                  Instance objects successfully initialized.
+*                               HTTPs_ERR_CFG_INVALID_FS_TYPE   Invalid file system type.
+*                               HTTPs_ERR_TASK_LOCK_CREATE      Lock creation failed.
+*
+*                               ----------------------- RETURNED BY HTTPsTask_LockCreate() -----------------------
+*                               See HTTPsTask_LockCreate() for additional return error codes.
+*
+*                               --------------------- RETURNED BY HTTPsTask_InstanceObjInit() --------------------
+*                               See HTTPsTask_InstanceObjInit() for additional return error codes.
+*
+*                               ---------------------- RETURNED BY HTTPsMem_ConnPoolInit() -----------------------
+*                               See HTTPsMem_ConnPoolInit() for additional return error codes.
+*
+*                               ------------------ RETURNED BY SOCKET EVENT BACKEND Init() ---------------------
+*                               See HTTPsSock_EvtSelInit() or the configured backend for additional return error
+*                               codes.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPs_InstanceInit(),
+*               HTTPs_InstanceWorkerInit().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  HTTPs_InstanceObjInit (HTTPs_INSTANCE  *p_instance,
+                                     HTTPs_ERR       *p_err)
+{
+#if (HTTPs_CFG_FS_PRESENT_EN == DEF_ENABLED)
+    const  NET_FS_API  *p_fs_api;
+#endif
+    const  HTTPs_CFG   *p_cfg;
+           KAL_ERR      kal_err;
+
+
+    p_cfg = p_instance->CfgPtr;
+
+    switch (p_cfg->FS_Type) {
+        case HTTPs_FS_TYPE_NONE:
+             break;
+
+        case HTTPs_FS_TYPE_STATIC:
+#if (HTTPs_CFG_FS_PRESENT_EN == DEF_ENABLED)
+             p_fs_api = ((HTTPs_CFG_FS_STATIC *)p_cfg->FS_CfgPtr)->FS_API_Ptr;
+             p_instance->FS_PathLenMax  = p_fs_api->CfgPathGetLenMax();
+             p_instance->FS_PathSepChar = p_fs_api->CfgPathGetSepChar();
+#endif
+             break;
+
+
+        case HTTPs_FS_TYPE_DYN:
+#if (HTTPs_CFG_FS_PRESENT_EN == DEF_ENABLED)
+             p_fs_api = ((HTTPs_CFG_FS_DYN *)p_cfg->FS_CfgPtr)->FS_API_Ptr;
+             p_instance->FS_PathLenMax  = p_fs_api->CfgPathGetLenMax();
+             p_instance->FS_PathSepChar = p_fs_api->CfgPathGetSepChar();
+#endif
+             break;
+
+        default:
+            *p_err = HTTPs_ERR_CFG_INVALID_FS_TYPE;
+             return;
+    }
+
+
+    p_instance->OS_LockObj = HTTPsTask_LockCreate(p_err);
+    if (*p_err != HTTPs_ERR_NONE){
+         p_instance->OS_TaskObjPtr = (HTTPs_OS_TASK_OBJ *)DEF_NULL;
+         return;
+    }
+
+
+    p_instance->ConnSelAbortLockObj = KAL_LockCreate ("HTTPs Conn Sel Abort Mtx",
+                                                       DEF_NULL,
+                                                      &kal_err);
+
+    if (kal_err != RTOS_ERR_NONE) {
+       *p_err = HTTPs_ERR_TASK_LOCK_CREATE;
+        return;
+    }
+
+                                                                /* ------------------- INIT OS OBJ -------------------- */
+    HTTPsTask_InstanceObjInit(p_instance, p_err);
+    if (*p_err != HTTPs_ERR_NONE) {
+         return;
+    }
+
+
+                                                                /* ------------------ INIT CONN POOL ------------------ */
+    HTTPsMem_ConnPoolInit(p_instance,
+                          p_err);
+    if (*p_err != HTTPs_ERR_NONE) {
+         return;
+    }
+
+                                                                /* ------------- INIT SOCK EVENT BACKEND -------------- */
+    if (p_cfg->SockEvtAPI_Ptr != DEF_NULL) {
+        p_instance->SockEvtAPI_Ptr = p_cfg->SockEvtAPI_Ptr;
+    } else {
+        p_instance->SockEvtAPI_Ptr = &HTTPsSock_EvtAPI_Sel;
+    }
+
+    p_instance->SockEvtAPI_Ptr->Init(p_instance, p_err);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      HTTPs_InstanceWorkerInit()
+*
+* Description : (1) Initialize the workers of an instance :
+*
+*                   (a) Acquire worker table of the primary worker.
+*                   (b) For each additional worker :
+*                       (1) Get HTTPs server instance.
+*                       (2) Initialize worker parameters.
+*                       (3) Initialize worker objects.
+*                       (4) Acquire worker connection handoff queue.
+*
+* Argument(s) : p_instance  Pointer to the primary instance.
+*               ----------  Argument validated in HTTPs_InstanceInit().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               HTTPs_ERR_NONE                  Workers successfully initialized.
+*
+*                               ---------------------- RETURNED BY HTTPsMem_InstanceGet() ------------------------
+*                               See HTTPsMem_InstanceGet() for additional return error codes.
+*
+*                               ----------------------- RETURNED BY HTTPsMem_WorkerInit() ------------------------
+*                               See HTTPsMem_WorkerInit() for additional return error codes.
+*
+*                               --------------------- RETURNED BY HTTPs_InstanceObjInit() ----------------------
+*                               See HTTPs_InstanceObjInit() for additional return error codes.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPs_InstanceInit().
+*
+* Note(s)     : (2) Each additional worker runs with its own task configuration taken from the
+*                   'WorkerTaskCfgTbl' table of the instance configuration.
+*
+*               (3) If a worker can't be initialized, the workers already initialized are released. See
+*                   HTTPs_InstanceWorkerRelease().
+*********************************************************************************************************
+*/
+
+static  void  HTTPs_InstanceWorkerInit (HTTPs_INSTANCE  *p_instance,
+                                        HTTPs_ERR       *p_err)
+{
+    const  HTTPs_CFG       *p_cfg;
+           HTTPs_INSTANCE  *p_worker;
+           CPU_INT08U       worker_ix;
+
+
+    p_cfg = p_instance->CfgPtr;
+                                                                /* --------------- ACQUIRE WORKER TBL ----------------- */
+    HTTPsMem_WorkerInit(p_instance, p_err);
+    if (*p_err != HTTPs_ERR_NONE) {
+         return;
+    }
+
+    for (worker_ix = 1u; worker_ix < p_instance->WorkerNbr; worker_ix++) {
+                                                                /* ------------------- GET WORKER --------------------- */
+        p_worker = HTTPsMem_InstanceGet(p_err);
+        if (p_worker == DEF_NULL) {
+            HTTPs_InstanceWorkerRelease(p_instance, worker_ix);
+            return;
+        }
+
+                                                                /* -------------- INIT WORKER PARAMETERS -------------- */
+        p_worker->CfgPtr          =  p_cfg;
+                                                                /* See Note #2.                                         */
+        p_worker->TaskCfgPtr      = &p_cfg->WorkerTaskCfgTbl[worker_ix - 1u];
+        p_worker->Started         =  DEF_NO;
+        p_worker->SelAbortReq     =  DEF_NO;
+        p_worker->WorkerParentPtr =  p_instance;
+        p_worker->WorkerNbr       =  1u;
+        p_worker->ConnNbrMax      =  p_instance->ConnNbrMax;
+
+        HTTPs_InstanceObjInit(p_worker, p_err);
+        if (*p_err != HTTPs_ERR_NONE) {
+             HTTPsMem_InstanceRelease(p_worker);
+             HTTPs_InstanceWorkerRelease(p_instance, worker_ix);
+             return;
+        }
+
+                                                                /* -------------- ACQUIRE CONN HANDOFF Q -------------- */
+        HTTPsMem_WorkerInit(p_worker, p_err);
+        if (*p_err != HTTPs_ERR_NONE) {
+             HTTPsMem_InstanceRelease(p_worker);
+             HTTPs_InstanceWorkerRelease(p_instance, worker_ix);
+             return;
+        }
+
+        p_instance->WorkerTbl[worker_ix] = p_worker;
+    }
+
+   *p_err = HTTPs_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                     HTTPs_InstanceWorkerRelease()
+*
+* Description : Release the additional workers of an instance that failed to initialize.
+*
+* Argument(s) : p_instance  Pointer to the instance (primary worker).
+*               ----------  Argument validated in HTTPs_InstanceInit().
+*
+*               worker_nbr  Number of workers initialized, including the primary worker.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPs_InstanceInit(),
+*               HTTPs_InstanceWorkerInit().
+*
+* Note(s)     : (1) The OS objects of each worker are deleted & the worker block is returned to the instance
+*                   pool. The task stack, the connection pools & the handoff queue are allocated from a
+*                   memory segment & can't be freed.
+*********************************************************************************************************
+*/
+
+static  void  HTTPs_InstanceWorkerRelease (HTTPs_INSTANCE  *p_instance,
+                                           CPU_INT08U       worker_nbr)
+{
+    HTTPs_INSTANCE  *p_worker;
+    CPU_INT08U       worker_ix;
+    KAL_ERR          kal_err;
+
+
+    for (worker_ix = 1u; worker_ix < worker_nbr; worker_ix++) {
+        p_worker = p_instance->WorkerTbl[worker_ix];
+
+        HTTPsTask_InstanceObjDel(p_worker);
+
+        KAL_LockDel(p_worker->ConnSelAbortLockObj, &kal_err);
+       (void)kal_err;                                           /* Ignore err(s).                                       */
+
+        HTTPsMem_InstanceRelease(p_worker);
+
+        p_instance->WorkerTbl[worker_ix] = DEF_NULL;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                      HTTPs_InstanceStartAbort()
+*
+* Description : Stop the workers of an instance that failed to start.
+*
+* Argument(s) : p_instance  Pointer to the instance (primary worker).
+*               ----------  Argument validated in HTTPs_InstanceStart().
+*
+*               worker_nbr  Number of workers started, including the primary worker.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPs_InstanceStart().
+*
+* Note(s)     : (1) The primary worker is stopped first, so that no more connections are handed off. It
+*                   closes the listen socket(s) while stopping.
+*
+*               (2) The primary worker may have handed off connections to a worker that was not started.
+*                   The sockets left in the handoff queue of each worker are closed.
+*
+*               (3) The instance lock MUST NOT be held by the caller.
+*********************************************************************************************************
+*/
+
+static  void  HTTPs_InstanceStartAbort (HTTPs_INSTANCE  *p_instance,
+                                        CPU_INT08U       worker_nbr)
+{
+    HTTPs_INSTANCE  *p_worker;
+    CPU_INT08U       worker_ix;
+    HTTPs_ERR        err;
+
+
+    HTTPs_InstanceWorkerStop(p_instance, DEF_NO, &err);         /* See Note #1.                                         */
+
+    for (worker_ix = 1u; worker_ix < p_instance->WorkerNbr; worker_ix++) {
+        p_worker = p_instance->WorkerTbl[worker_ix];
+        if (worker_ix < worker_nbr) {
+            HTTPs_InstanceWorkerStop(p_worker, DEF_NO, &err);
+        }
+        HTTPsSock_WorkerConnGet(p_worker, DEF_YES);             /* See Note #2.                                         */
+    }
+
+   (void)err;                                                   /* Ignore err(s).                                       */
+}
+
+
+/*
+*********************************************************************************************************
+*                                        HTTPs_InstanceCtrAdd()
+*
+* Description : Add a set of counters of a worker to the counters of the instance.
+*
+* Argument(s) : p_dst   Pointer to the first counter of the sums.
+*
+*               p_src   Pointer to the first counter of the worker.
+*
+*               nbr     Number of counters.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPs_InstanceErrsGet(),
+*               HTTPs_InstanceStatsGet().
+*
+* Note(s)     : (1) The statistic & error counter structures only hold CPU_INT32U counters.
+*********************************************************************************************************
+*/
+#if ((HTTPs_CFG_CTR_STAT_EN == DEF_ENABLED) || \
+     (HTTPs_CFG_CTR_ERR_EN  == DEF_ENABLED))
+static  void  HTTPs_InstanceCtrAdd (       CPU_INT32U  *p_dst,
+                                    const  CPU_INT32U  *p_src,
+                                           CPU_SIZE_T   nbr)
+{
+    CPU_SIZE_T  ix;
+
+
+    for (ix = 0u; ix < nbr; ix++) {
+        p_dst[ix] += p_src[ix];
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      HTTPs_InstanceWorkerStop()
+*
+* Description : (1) Stop a worker of an instance:
+*
+*                   (a) Abort worker pending, or reset worker connections if stop is not graceful.
+*                   (b) Signal worker to stop the task.
+*                   (c) Wait for completion of the stopping routine.
+*                   (d) Delete worker task.
+*
+* Argument(s) : p_worker          Pointer to the worker instance.
+*               --------          Argument validated in HTTPs_InstanceInit().
+*
+*               graceful_stop_en  Boolean that determines whether the worker will wait for established idle
+*                                 connections to time out. See HTTPs_InstanceStop().
+*
+*               p_err             Pointer to variable that will receive the return error code from this function :
+*
+*                                     HTTPs_ERR_NONE    Worker stopped.
+*
+*                                     --------------------- RETURNED BY HTTPsTask_LockAcquire() ---------------------
+*                                     See HTTPsTask_LockAcquire() for additional return error codes.
+*
+*                                     ---------------- RETURNED BY HTTPsTask_InstanceStopReqSignal() ----------------
+*                                     See HTTPsTask_InstanceStopReqSignal() for additional return error codes.
+*
+*                                     ----------- RETURNED BY HTTPsTask_InstanceStopCompletedPending() --------------
+*                                     See HTTPsTask_InstanceStopCompletedPending() for additional return error codes.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPs_InstanceStartAbort(),
+*               HTTPs_InstanceStop().
+*
+* Note(s)     : (2) The primary worker MUST be stopped first so that no more connections are handed off.
+*
+*               (3) A worker without connection may pend on its signal. See HTTPsSock_ConnSel() Note #4.
+*
+*               (4) The primary worker is only stopped by this function when the instance fails to start.
+*                   Otherwise, it is stopped by HTTPs_InstanceStop().
+*********************************************************************************************************
+*/
+
+static  void  HTTPs_InstanceWorkerStop (HTTPs_INSTANCE  *p_worker,
+                                        CPU_BOOLEAN      graceful_stop_en,
+                                        HTTPs_ERR       *p_err)
+{
+    HTTPs_CONN  *p_conn;
+    HTTPs_CONN  *p_conn_next;
+    NET_ERR      net_err;
+
+                                                                /* Acquire worker lock.                                 */
+    HTTPsTask_LockAcquire(p_worker->OS_LockObj, p_err);
+    if (*p_err != HTTPs_ERR_NONE) {
+        return;
+    }
+
+    if (p_worker->Started != DEF_YES) {
+        HTTPsTask_LockRelease(p_worker->OS_LockObj);
+       *p_err = HTTPs_ERR_NONE;
+        return;
+    }
+
+    if (p_worker->ConnActiveCtr == 0u) {                        /* Prevent worker from pending on its signal again.     */
+        HTTPsTask_LockAcquire(p_worker->ConnSelAbortLockObj, p_err);
+        if (*p_err != HTTPs_ERR_NONE) {
+            HTTPsTask_LockRelease(p_worker->OS_LockObj);
+            return;
+        }
+        p_worker->SelAbortReq = DEF_TRUE;
+        HTTPsTask_LockRelease(p_worker->ConnSelAbortLockObj);
+
+    } else if (graceful_stop_en != DEF_TRUE) {
+        p_conn = p_worker->ConnFirstPtr;
+        while (p_conn != DEF_NULL) {
+            p_conn_next = p_conn->ConnNextPtr;
+            NetSock_Close(p_conn->SockID, &net_err);            /* Close HTTP conn socket.                              */
+            if (net_err == NET_SOCK_ERR_NONE) {                 /* Release conn resources.                              */
+                HTTPsMem_ConnRelease(p_worker, p_conn);
+            }
+            p_conn = p_conn_next;
+        }
+    }
+                                                                /* -------------- SIGNAL WORKER TO STOP --------------- */
+    HTTPsTask_InstanceStopReqSignal(p_worker, p_err);
+    if (*p_err != HTTPs_ERR_NONE) {
+         HTTPsTask_LockRelease(p_worker->OS_LockObj);
+         return;
+    }
+
+    HTTPsSock_InstanceWake(p_worker);                           /* See Note #3.                                         */
+
+    HTTPsTask_LockRelease(p_worker->OS_LockObj);                /* Release worker lock before pending.                  */
+
+                                                                /* --------------- WAIT STOP COMPLETED ---------------- */
+    HTTPsTask_InstanceStopCompletedPending(p_worker, p_err);
+    if (*p_err != HTTPs_ERR_NONE) {
+         return;
+    }
+
+    HTTPsTask_LockAcquire(p_worker->OS_LockObj, p_err);
+    if (*p_err != HTTPs_ERR_NONE) {
+         return;
+    }
+                                                                /* ------------------ DEL WORKER TASK ----------------- */
+    HTTPsTask_InstanceTaskDel(p_worker);
+
+    HTTPsTask_LockRelease(p_worker->OS_LockObj);                /* Release worker lock.                                 */
+
+   *p_err = HTTPs_ERR_NONE;
+}
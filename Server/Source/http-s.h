@@ -236,6 +236,33 @@
 #endif
 
 
+#ifndef  HTTPs_CFG_CONTENT_CODING_EN
+    #error  "HTTPs_CFG_CONTENT_CODING_EN not #define'd in 'http-s_cfg.h'"
+#elif  ((HTTPs_CFG_CONTENT_CODING_EN != DEF_ENABLED ) && \
+        (HTTPs_CFG_CONTENT_CODING_EN != DEF_DISABLED))
+    #error  "HTTPs_CFG_CONTENT_CODING_EN illegally #define'd in 'http-s_cfg.h'. MUST be DEF_DISABLED or DEF_ENABLED"
+#endif
+
+
+#ifndef  HTTPs_CFG_DEFLATE_EN
+    #error  "HTTPs_CFG_DEFLATE_EN not #define'd in 'http-s_cfg.h'"
+#elif  ((HTTPs_CFG_DEFLATE_EN != DEF_ENABLED ) && \
+        (HTTPs_CFG_DEFLATE_EN != DEF_DISABLED))
+    #error  "HTTPs_CFG_DEFLATE_EN illegally #define'd in 'http-s_cfg.h'. MUST be DEF_DISABLED or DEF_ENABLED"
+#elif  ((HTTPs_CFG_DEFLATE_EN        == DEF_ENABLED) && \
+        (HTTPs_CFG_CONTENT_CODING_EN != DEF_ENABLED))
+    #error  "HTTPs_CFG_DEFLATE_EN illegally #define'd in 'http-s_cfg.h'. MUST be DEF_DISABLED without content coding"
+#endif
+
+
+#ifndef  HTTPs_CFG_COND_REQ_EN
+    #error  "HTTPs_CFG_COND_REQ_EN not #define'd in 'http-s_cfg.h'"
+#elif  ((HTTPs_CFG_COND_REQ_EN != DEF_ENABLED ) && \
+        (HTTPs_CFG_COND_REQ_EN != DEF_DISABLED))
+    #error  "HTTPs_CFG_COND_REQ_EN illegally #define'd in 'http-s_cfg.h'. MUST be DEF_DISABLED or DEF_ENABLED"
+#endif
+
+
 #ifndef  HTTPs_CFG_QUERY_STR_EN
     #error  "HTTPs_CFG_QUERY_STR_EN not #define'd in 'http-s_cfg.h'"
 #elif  ((HTTPs_CFG_QUERY_STR_EN != DEF_ENABLED ) && \
@@ -337,6 +364,10 @@
 */
 
 #define  HTTPs_FORM_BOUNDARY_STR_LEN_MAX                     72u
+                                                                /* Boundary srch skip tbl len (one entry per octet).    */
+#define  HTTPs_FORM_BOUNDARY_SKIP_TBL_LEN                   256u
+                                                                /* Boundary blk holds the str & the skip tbl.           */
+#define  HTTPs_FORM_BOUNDARY_BLK_LEN                       (HTTPs_FORM_BOUNDARY_STR_LEN_MAX + HTTPs_FORM_BOUNDARY_SKIP_TBL_LEN)
 
 
 /*
@@ -349,6 +380,66 @@
 #define  HTTPs_HTML_DFLT_ERR_STR_NAME                       "default.html"
 
 
+/*
+*********************************************************************************************************
+*                                    CONTENT CODING FILE DEFINES
+*********************************************************************************************************
+*/
+                                                                /* Ext appended to the path of pre-compressed files.    */
+#define  HTTPs_STR_FILE_EXT_GZIP                            ".gz"
+#define  HTTPs_STR_FILE_EXT_BR                              ".br"
+
+#define  HTTPs_STR_FILE_EXT_CODING_LEN                       3u
+
+
+/*
+*********************************************************************************************************
+*                                   CONDITIONAL REQUEST DEFINES
+*
+* Note(s) : (1) The entity tags are formed of the hex tag & the hex file size between double quotes, e.g.
+*               '"1c291ca300000a3f"'.
+*
+*           (2) A client may hold a tag for each variant of a file: identity, gzip & br.
+*********************************************************************************************************
+*/
+                                                                /* Nbr of hex digits of the tag & of the size.          */
+#define  HTTPs_ETAG_HEX_DIG_LEN                               8u
+                                                                /* Len of entity tag, with quotes (see Note #1).        */
+#define  HTTPs_ETAG_STR_LEN                                 ((2u * HTTPs_ETAG_HEX_DIG_LEN) + 2u)
+                                                                /* Nbr of tags kept from If-None-Match (see Note #2).   */
+#define  HTTPs_COND_REQ_TAG_NBR_MAX                           3u
+
+
+/*
+*********************************************************************************************************
+*                                     CONNECTION TIMER DEFINES
+*********************************************************************************************************
+*/
+                                                                /* Nbr of slots of the conn tmr wheel (power of 2).     */
+#define  HTTPs_CONN_TMR_WHEEL_SLOT_NBR                       64u
+
+
+/*
+*********************************************************************************************************
+*                                     CONNECTION OVERLOAD DEFINES
+*********************************************************************************************************
+*/
+                                                                /* Resp to a conn rejected in overload, up to the ...   */
+                                                                /* ... Retry-After val.                                 */
+#define  HTTPs_CONN_OVERLOAD_RESP_STR_HDR                    HTTP_STR_PROTOCOL_VER_1_1                  " "            \
+                                                             HTTP_STR_STATUS_CODE_SERVICE_UNAVAILABLE   " "            \
+                                                             HTTP_STR_REASON_PHRASE_SERVICE_UNAVAILABLE STR_CR_LF      \
+                                                             HTTP_STR_HDR_FIELD_CONTENT_LEN             ": 0"          \
+                                                             STR_CR_LF                                                 \
+                                                             HTTP_STR_HDR_FIELD_CONN                    ": "           \
+                                                             HTTP_STR_HDR_FIELD_CONN_CLOSE              STR_CR_LF      \
+                                                             HTTP_STR_HDR_FIELD_RETRY_AFTER             ": "
+
+#define  HTTPs_CONN_OVERLOAD_RESP_LEN_MAX                   ((sizeof(HTTPs_CONN_OVERLOAD_RESP_STR_HDR) - 1u) + \
+                                                               DEF_INT_16U_NBR_DIG_MAX                       + \
+                                                              (2u * STR_CR_LF_LEN))
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -390,6 +481,7 @@ typedef enum https_err {
     HTTPs_ERR_INIT_POOL_REQ_HDR_STR,
     HTTPs_ERR_INIT_POOL_RESP_HDR,
     HTTPs_ERR_INIT_POOL_RESP_HDR_STR,
+    HTTPs_ERR_INIT_POOL_DEFLATE,
     HTTPs_ERR_INIT_INSTANCE_HOOK_FAULT,
 
     HTTPs_ERR_POOL_BLK_FREE_FAULT,
@@ -401,8 +493,12 @@ typedef enum https_err {
     HTTPs_ERR_SOCK_LISTEN,
     HTTPs_ERR_SOCK_SET_OPT_BLOCK,
     HTTPs_ERR_SOCK_SET_OPT_SECURE,
+    HTTPs_ERR_SOCK_EVT_INIT,
+    HTTPs_ERR_SOCK_EVT_WAIT,
 
     HTTPs_ERR_CFG_INVALID_NBR_CONN,
+    HTTPs_ERR_CFG_INVALID_NBR_WORKER,
+    HTTPs_ERR_CFG_INVALID_CONN_OVERLOAD,
     HTTPs_ERR_CFG_INVALID_DFLT_RESOURCE,
     HTTPs_ERR_CFG_INVALID_DFLT_FILE,
     HTTPs_ERR_CFG_INVALID_SOCK_SEL,
@@ -426,6 +522,8 @@ typedef enum https_err {
     HTTPs_ERR_CFG_INVALID_FORM_EN,
     HTTPs_ERR_CFG_INVALID_FORM_MULTIPART_EN,
     HTTPs_ERR_CFG_INVALID_FORM_PARAM,
+    HTTPs_ERR_CFG_INVALID_DEFLATE_EN,
+    HTTPs_ERR_CFG_INVALID_DEFLATE_PARAM,
     HTTPs_ERR_CFG_INVALID_BUF_LEN,
     HTTPs_ERR_CFG_INVALID_ERR_PAGE_LEN,
 
@@ -543,7 +641,9 @@ typedef enum https_conn_state {
     HTTPs_CONN_STATE_RESP_STATUS_LINE,
     HTTPs_CONN_STATE_RESP_HDR,
     HTTPs_CONN_STATE_RESP_HDR_CONTENT_TYPE,
+    HTTPs_CONN_STATE_RESP_HDR_CONTENT_CODING,
     HTTPs_CONN_STATE_RESP_HDR_FILE_TRANSFER,
+    HTTPs_CONN_STATE_RESP_HDR_VALIDATOR,
     HTTPs_CONN_STATE_RESP_HDR_LOCATION,
     HTTPs_CONN_STATE_RESP_HDR_CONN,
     HTTPs_CONN_STATE_RESP_HDR_LIST,
@@ -642,6 +742,9 @@ typedef  CPU_INT08U  HTTPs_FLAGS;
 #define  HTTPs_FLAG_SOCK_RDY_RD                     DEF_BIT_00
 #define  HTTPs_FLAG_SOCK_RDY_WR                     DEF_BIT_01
 #define  HTTPs_FLAG_SOCK_RDY_ERR                    DEF_BIT_02
+#define  HTTPs_FLAG_SOCK_EVT_QUEUED                 DEF_BIT_03  /* Flag indicating Conn is in the instance rdy list.    */
+#define  HTTPs_FLAG_SOCK_EVT_POLL                   DEF_BIT_04  /* Flag indicating Conn waits for the app to be rdy.    */
+#define  HTTPs_FLAG_SOCK_EVT_TMR                    DEF_BIT_05  /* Flag indicating Conn is in the instance tmr wheel.   */
 
                                                                 /* CONN & TRANSACTION FLAGS */
 #define  HTTPs_FLAG_CONN_PERSISTENT                 DEF_BIT_00  /* Flag indicating if Connection is persistent.         */
@@ -650,6 +753,25 @@ typedef  CPU_INT08U  HTTPs_FLAGS;
 #define  HTTPs_FLAG_RESP_LOCATION                   DEF_BIT_03  /* Flag indicating Location hdr requirement in resp.    */
 #define  HTTPs_FLAG_RESP_CHUNKED                    DEF_BIT_04
 #define  HTTPs_FLAG_RESP_CHUNKED_HOOK               DEF_BIT_05
+#define  HTTPs_FLAG_RESP_FILE_TX                    DEF_BIT_06  /* Flag indicating file data is tx'd by the FS.         */
+
+                                                                /* CONTENT CODING FLAGS     */
+#define  HTTPs_FLAG_CONTENT_CODING_REQ_GZIP         DEF_BIT_00  /* Flag indicating gzip is accepted by the client.      */
+#define  HTTPs_FLAG_CONTENT_CODING_REQ_BR           DEF_BIT_01  /* Flag indicating br   is accepted by the client.      */
+#define  HTTPs_FLAG_CONTENT_CODING_RESP_GZIP        DEF_BIT_02  /* Flag indicating the gzip file variant is tx'd.       */
+#define  HTTPs_FLAG_CONTENT_CODING_RESP_BR          DEF_BIT_03  /* Flag indicating the br   file variant is tx'd.       */
+#define  HTTPs_FLAG_CONTENT_CODING_RESP_VARY        DEF_BIT_04  /* Flag indicating Vary hdr requirement in resp.        */
+
+#define  HTTPs_FLAG_CONTENT_CODING_REQ_ALL         (HTTPs_FLAG_CONTENT_CODING_REQ_GZIP | \
+                                                    HTTPs_FLAG_CONTENT_CODING_REQ_BR)
+
+                                                                /* CONDITIONAL REQUEST FLAGS */
+#define  HTTPs_FLAG_COND_REQ_NONE_MATCH             DEF_BIT_00  /* Flag indicating If-None-Match hdr was rx'd.          */
+#define  HTTPs_FLAG_COND_REQ_NONE_MATCH_ANY         DEF_BIT_01  /* Flag indicating If-None-Match is '*'.                */
+#define  HTTPs_FLAG_COND_REQ_NONE_MATCH_TAG         DEF_BIT_02  /* Flag indicating server entity tag(s) were rx'd.      */
+#define  HTTPs_FLAG_COND_REQ_MODIFIED_SINCE         DEF_BIT_03  /* Flag indicating a valid If-Modified-Since was rx'd.  */
+#define  HTTPs_FLAG_COND_RESP_ETAG                  DEF_BIT_04  /* Flag indicating ETag hdr requirement in resp.        */
+#define  HTTPs_FLAG_COND_RESP_LAST_MODIFIED         DEF_BIT_05  /* Flag indicating Last-Modified hdr requirement.       */
 
 
 /*
@@ -662,9 +784,22 @@ typedef  struct  https_os_task_obj {
     KAL_TASK_HANDLE  TaskHandle;
     KAL_SEM_HANDLE   SemStopReq;
     KAL_SEM_HANDLE   SemStopCompleted;
+    KAL_SEM_HANDLE   SemWorkerSignal;
 } HTTPs_OS_TASK_OBJ;
 
 
+/*
+*********************************************************************************************************
+*                                  HTTP SERVER WORKER HANDOFF DATA TYPE
+*********************************************************************************************************
+*/
+
+typedef  struct  https_worker_handoff {
+    NET_SOCK_ID      SockID;                                    /* Accepted conn sock ID.                               */
+    NET_SOCK_ADDR    ClientAddr;                                /* Client addr returned by NetSock_Accept().            */
+} HTTPs_WORKER_HANDOFF;
+
+
 /*
 *********************************************************************************************************
 *                                           SECURE DATA TYPE
@@ -694,6 +829,30 @@ typedef  struct  https_token_ctrl {
     CPU_INT16U   TxLen;
 } HTTPs_TOKEN_CTRL;
 
+
+/*
+*********************************************************************************************************
+*                                      DEFLATE CONTEXT DATA TYPE
+*
+* Note(s) : (1) The context, the hash table, the window & the output buffer share a single pool block
+*               (see HTTPsMem_DeflateGet()).
+*********************************************************************************************************
+*/
+
+typedef  struct  https_deflate_ctx {
+    CPU_INT16U   *HashTblPtr;                                   /* Ptr to the last pos of each hashed 3-octet seq.     */
+    CPU_INT08U   *WinPtr;                                       /* Ptr to the ring buf of the last octets compressed.  */
+    CPU_CHAR     *OutBufPtr;                                    /* Ptr to the buf receiving the compressed chunk.      */
+    CPU_INT16U    OutLenMax;                                    /* Max len of compressed data per chunk.               */
+    CPU_INT16U    WinMask;                                      /* Win len - 1.                                        */
+    CPU_INT08U    HashShift;                                    /* Shift applied to the hash to index the tbl.         */
+    CPU_BOOLEAN   HdrTxd;                                       /* Gzip hdr already wr.                                */
+    CPU_INT08U    BitCnt;                                       /* Nbr of pending bits in BitBuf.                      */
+    CPU_INT32U    BitBuf;                                       /* Pending bits not yet wr to the output.              */
+    CPU_INT32U    CRC;                                          /* CRC-32 of the uncompressed data.                    */
+    CPU_INT32U    Pos;                                          /* Nbr of octets compressed.                           */
+} HTTPs_DEFLATE_CTX;
+
 /*
 *********************************************************************************************************
 *                                      HTTP INTERNAL TOKEN DATA TYPE
@@ -740,35 +899,65 @@ typedef  enum  HTTPs_hdr_type {
 } HTTPs_HDR_TYPE;
 
 
+/*
+*********************************************************************************************************
+*                                       CONNECTION TIMER PHASE
+*********************************************************************************************************
+*/
+
+typedef  enum  HTTPs_conn_tmr_phase {
+    HTTPs_CONN_TMR_PHASE_NONE,                                  /* No deadline (app processing or resp tx).             */
+    HTTPs_CONN_TMR_PHASE_REQ_HDR,                               /* Request line & hdrs must be rxd before deadline.     */
+    HTTPs_CONN_TMR_PHASE_REQ_BODY,                              /* Request body must be rxd before deadline.            */
+    HTTPs_CONN_TMR_PHASE_IDLE                                   /* Next req must start before deadline.                 */
+} HTTPs_CONN_TMR_PHASE;
+
+
 /*
 *********************************************************************************************************
 *                                        CONNECTIONS DATA TYPE
+*
+* Note(s) : (1) The fields read by the instance task on every pass (socket state & ready flags, connection
+*               state & flags and the forward list links) are grouped at the start of the structure, ordered
+*               by decreasing alignment (pointers, enumerations, socket ID & flags) so that no padding is
+*               inserted between them on 32-bit or 64-bit targets, as long as enumerations have the size of
+*               an int. Connections are allocated cache line aligned (see 'http-s_mem.c
+*               HTTPsMem_ConnPoolInit()  Note #5'), so walking the connection, ready & poll lists only
+*               touches the first cache line of each connection; the per-transaction fields below are only
+*               loaded once the connection is actually processed.
+*
+*               (a) The previous connection links are only used to unlink a connection in constant time & are
+*                   kept with the cold fields.
 *********************************************************************************************************
 */
 
 typedef  struct  HTTPs_Conn  HTTPs_CONN;
 
 struct  HTTPs_Conn {
+                                                                /* ------------ HOT FIELDS (see Note #1) ------------- */
+    HTTPs_CONN               *ConnNextPtr;                      /* Pointer to next connection.                          */
+    HTTPs_CONN               *ConnRdyNextPtr;                   /* Pointer to next connection ready to be processed.    */
+    HTTPs_CONN               *ConnPollNextPtr;                  /* Pointer to next connection waiting for the app.      */
 
-    NET_SOCK_ID               SockID;                           /* Connection's Socket ID.                              */
     HTTPs_SOCK_STATE          SockState;                        /* Connection's Socket State.                           */
+    HTTPs_CONN_STATE          State;                            /* Connection State.                                    */
+    HTTP_PROTOCOL_VER         ProtocolVer;                      /* HTTP version received in request message.            */
+
+    NET_SOCK_ID               SockID;                           /* Connection's Socket ID.                              */
     HTTPs_FLAGS               SockFlags;                        /* Connection's Socket Ready flags.                     */
+    HTTPs_FLAGS               SockEvtInterest;                  /* Socket events registered with the event backend.     */
+    HTTPs_FLAGS               Flags;                            /* Connection and Transaction flags.                    */
 
+                                                                /* ----------------- COLD TXN FIELDS ----------------- */
     NET_SOCK_ADDR             ClientAddr;                       /* Client socket information.                           */
 
     HTTPs_ERR                 ErrCode;                          /* Error code when internal error occurs.               */
 
-    HTTPs_CONN_STATE          State;                            /* Connection State.                                    */
-
-    HTTPs_FLAGS               Flags;                            /* Connection and Transaction flags.                    */
-
     HTTP_METHOD               Method;                           /* HTTP method received in request message.             */
     HTTP_CONTENT_TYPE         ReqContentType;                   /* Content-Type received in request message.            */
     CPU_INT32U                ReqContentLen;                    /* Content-Length received in request message.          */
     CPU_INT32U                ReqContentLenRxd;                 /* Length of Content-Length read.                       */
 
-    HTTP_PROTOCOL_VER         ProtocolVer;                      /* HTTP version received in request message.            */
-
     CPU_CHAR                 *PathPtr;                          /* Pointer to the URI requested by client               */
     CPU_SIZE_T                PathLenMax;                       /* Maximum file name length.                            */
 
@@ -781,6 +970,26 @@ struct  HTTPs_Conn {
     HTTP_CONTENT_TYPE         RespContentType;                  /* Content-Type of file to send                         */
     HTTPs_BODY_DATA_TYPE      RespBodyDataType;                 /* Type of the data of the body (FS, Static, None).     */
 
+#if (HTTPs_CFG_CONTENT_CODING_EN == DEF_ENABLED)
+    HTTPs_FLAGS               ContentCodingFlags;               /* Codings accepted by the client & used in the resp.   */
+#endif
+
+#if (HTTPs_CFG_DEFLATE_EN == DEF_ENABLED)
+    HTTPs_DEFLATE_CTX        *DeflateCtxPtr;                    /* Ptr to the ctx compressing the chunked resp body.    */
+#endif
+
+#if (HTTPs_CFG_COND_REQ_EN == DEF_ENABLED)
+    HTTPs_FLAGS               CondFlags;                        /* Validators rx'd in the req & tx'd in the resp.       */
+                                                                /* Entity tags rx'd in If-None-Match.                   */
+    CPU_INT32U                CondReqTagTbl[HTTPs_COND_REQ_TAG_NBR_MAX];
+                                                                /* Size part of the entity tags rx'd in If-None-Match.  */
+    CPU_INT32U                CondReqTagSizeTbl[HTTPs_COND_REQ_TAG_NBR_MAX];
+    CPU_INT08U                CondReqTagNbr;                    /* Nbr of entity tags rx'd in If-None-Match.            */
+    CPU_INT32U                CondReqTS;                        /* Date rx'd in If-Modified-Since (see 'http.h').       */
+    CPU_INT32U                CondRespTag;                      /* Entity tag of the file tx'd.                         */
+    CPU_INT32U                CondRespTS;                       /* Modification date of the file tx'd.                  */
+#endif
+
 #if ((HTTPs_CFG_HDR_RX_EN == DEF_ENABLED) || \
      (HTTPs_CFG_HDR_TX_EN == DEF_ENABLED))
     HTTP_HDR_BLK            *HdrListPtr;                        /* Pointer to list of additional headers.               */
@@ -811,14 +1020,19 @@ struct  HTTPs_Conn {
 #if (HTTPs_CFG_FORM_MULTIPART_EN == DEF_ENABLED)
     CPU_CHAR                 *FormBoundaryPtr;                  /* Ptr to the boundary for Multipart Form parsing.      */
     CPU_INT08U                FormBoundaryLen;
+    CPU_INT08U               *FormBoundarySkipTblPtr;           /* Ptr to the boundary srch skip tbl.                   */
 #endif
 #endif
 
     CPU_CHAR                 *BufPtr;                           /* Ptr to conn buf.                                     */
     CPU_INT16U                BufLen;                           /* Conn buf len.                                        */
 
+    CPU_INT08U               *TxnArenaPtr;                      /* Ptr to txn arena, DEF_NULL if pools are used.        */
+    CPU_SIZE_T                TxnArenaLenUsed;                  /* Len of txn arena allocated by the cur txn.           */
+
     CPU_CHAR                 *RxBufPtr;                         /* Ptr where to receive buf.                            */
     CPU_INT16U                RxBufLenRem;                      /* Rem data in the rx buffer.                           */
+    CPU_INT16U                RxBufScanLen;                     /* Len of rx data srch'd for the end of cur token.      */
     CPU_INT32U                RxDataLen;                        /* Len of data rxd.                                     */
 
     CPU_CHAR                 *TxBufPtr;                         /* Ptr to buf to tx.                                    */
@@ -827,8 +1041,15 @@ struct  HTTPs_Conn {
     void                     *ConnDataPtr;                      /* Ptr for user conn data.                              */
     CPU_INT32U                ConnDataType;                     /* Type for user conn data.                             */
 
+    HTTPs_CONN_TMR_PHASE      TmrPhase;                         /* Cur txn phase timed by the conn tmr.                 */
+    CPU_INT32U                TmrDeadline_ms;                   /* Deadline of the cur phase.                           */
+    CPU_INT08U                TmrSlotIx;                        /* Ix of the tmr wheel slot holding the conn.           */
+    HTTPs_CONN               *TmrPrevPtr;                       /* Pointer to previous connection in tmr wheel slot.    */
+    HTTPs_CONN               *TmrNextPtr;                       /* Pointer to next     connection in tmr wheel slot.    */
+
     HTTPs_CONN               *ConnPrevPtr;                      /* Pointer to previous connection.                      */
-    HTTPs_CONN               *ConnNextPtr;                      /* Pointer to next connection.                          */
+    HTTPs_CONN               *ConnRdyPrevPtr;                   /* Pointer to prev connection ready to be processed.    */
+    HTTPs_CONN               *ConnPollPrevPtr;                  /* Pointer to prev connection waiting for the app.      */
 };
 
 
@@ -928,6 +1149,48 @@ typedef  struct  https_Hook_Cfg {
 } HTTPs_HOOK_CFG;
 
 
+/*
+*********************************************************************************************************
+*                                 SOCKET EVENT BACKEND API DATA TYPE
+*
+* Note(s) : (1) The socket event backend keeps the set of sockets the instance is interested in between
+*               two passes of the instance task. Interests are only updated when a connection changes its
+*               socket state, so a pass only costs the number of sockets that are actually ready.
+*
+*           (2) 'ConnSet()' receives the socket events of interest as a combination of the socket ready
+*               flags (HTTPs_FLAG_SOCK_RDY_RD, HTTPs_FLAG_SOCK_RDY_WR & HTTPs_FLAG_SOCK_RDY_ERR).
+*               HTTPs_FLAG_NONE removes the connection's socket from the backend.
+*
+*           (3) 'Wait()' MUST report each ready socket to the instance with HTTPsSock_EvtConnRdy() or
+*               HTTPsSock_EvtListenRdy(). A NULL timeout pointer means wait indefinitely.
+*
+*           (4) 'Wake()' is called from another task to make a pending 'Wait()' return before its timeout,
+*               e.g. when the instance is stopped or when the application is ready to resume a connection.
+*               'Wait()' MUST NOT start waiting once the instance 'WakeReq' is set, & both functions MUST
+*               access their shared state under the instance 'ConnSelAbortLockObj'.
+*********************************************************************************************************
+*/
+
+typedef  struct  https_sock_evt_api {
+    void          (*Init)     (HTTPs_INSTANCE    *p_instance,   /* Init backend data for the instance.                  */
+                               HTTPs_ERR         *p_err);
+
+    void          (*ListenSet)(HTTPs_INSTANCE    *p_instance,   /* Add or remove a listen socket.                       */
+                               NET_SOCK_ID        sock_id,
+                               CPU_BOOLEAN        en);
+
+    void          (*ConnSet)  (HTTPs_INSTANCE    *p_instance,   /* Set conn socket events of interest (see Note #2).    */
+                               HTTPs_CONN        *p_conn,
+                               HTTPs_FLAGS        interest);
+
+    NET_SOCK_QTY  (*Wait)     (HTTPs_INSTANCE    *p_instance,   /* Wait & report ready sockets (see Note #3).           */
+                               NET_SOCK_TIMEOUT  *p_timeout,
+                               HTTPs_ERR         *p_err);
+
+    void          (*Wake)     (HTTPs_INSTANCE    *p_instance);  /* Abort a pending wait (see Note #4).                  */
+} HTTPs_SOCK_EVT_API;
+
+
 /*
 *********************************************************************************************************
 *                                     HEADER CONFIGURATION DATA TYPE
@@ -989,6 +1252,19 @@ typedef  struct  https_token_cfg {
 } HTTPs_TOKEN_CFG;
 
 
+/*
+*********************************************************************************************************
+*                                    DEFLATE CONFIGURATION DATA TYPE
+*********************************************************************************************************
+*/
+
+typedef  struct  https_deflate_cfg {
+    CPU_INT16U    NbrPerInstanceMax;
+    CPU_INT16U    WinLen;
+    CPU_INT16U    HashTblLen;
+} HTTPs_DEFLATE_CFG;
+
+
 /*
 *********************************************************************************************************
 *                                        FS CONFIGURATION DATA TYPE
@@ -1006,12 +1282,44 @@ typedef  struct  https_cfg_fs_none {
 } HTTPs_CFG_FS_NONE;
 
 typedef  struct  https_cfg_fs_static {
-    const  NET_FS_API  *FS_API_Ptr;
+    const  NET_FS_API   *FS_API_Ptr;
+           CPU_BOOLEAN (*FileETagGet)(void        *p_file,      /* Optional; DEF_NULL if the FS has no entity tags.     */
+                                      CPU_INT32U  *p_etag);
 } HTTPs_CFG_FS_STATIC;
 
+/*
+*********************************************************************************************************
+*                                 FILE SYSTEM TRANSMIT API DATA TYPE
+*
+* Note(s) : (1) The file system transmit API is an optional extension of a dynamic file system (see
+*               HTTPs_CFG_FS_DYN) that transmits file data straight from a file to a connection socket,
+*               e.g. with sendfile() on a host port, instead of reading it in the connection buffer.
+*
+*           (2) 'FileTx()' MUST NOT block. It transmits at most 'len_max' octets from the current position
+*               of the file, advances the file position by the number of octets transmitted and returns
+*               that number. The error code follows the socket transmit functions :
+*
+*                   NET_SOCK_ERR_NONE           Data transmitted; zero octets if the socket is not ready.
+*                   NET_SOCK_ERR_CLOSED         Connection closed by peer.
+*                   Any other error             Fatal error; the connection is closed.
+*
+*           (3) The server uses the buffered transfer when the file data must be modified (token
+*               parsing or chunked transfer) or when the header section is still in the connection
+*               buffer.
+*********************************************************************************************************
+*/
+
+typedef  struct  https_fs_tx_api {
+    CPU_SIZE_T    (*FileTx)   (void              *p_file,       /* Tx file data to the socket (see Note #2).            */
+                               NET_SOCK_ID        sock_id,
+                               CPU_SIZE_T         len_max,
+                               NET_ERR           *p_err);
+} HTTPs_FS_TX_API;
+
 typedef  struct  https_cfg_fs_dyn {
-    const  NET_FS_API  *FS_API_Ptr;
-           CPU_CHAR    *WorkingFolderNamePtr;
+    const  NET_FS_API       *FS_API_Ptr;
+           CPU_CHAR         *WorkingFolderNamePtr;
+    const  HTTPs_FS_TX_API  *FS_TxAPI_Ptr;                      /* Optional; DEF_NULL if not supported by the FS.       */
 } HTTPs_CFG_FS_DYN;
 
 
@@ -1048,10 +1356,17 @@ typedef  struct  https_cfg {
 *--------------------------------------------------------------------------------------------------------
 */
 
-           CPU_INT08U            ConnNbrMax;
+           CPU_INT16U            ConnNbrMax;
            CPU_INT16U            ConnInactivityTimeout_s;
            CPU_INT16U            BufLen;
            CPU_BOOLEAN           ConnPersistentEn;
+           CPU_INT16U            ConnReqHdrTimeout_s;
+           CPU_INT16U            ConnReqBodyTimeout_s;
+           CPU_INT16U            ConnIdleTimeout_s;
+           CPU_INT16U            ConnOverloadHighWater;
+           CPU_INT16U            ConnOverloadLowWater;
+           CPU_INT16U            ConnOverloadRetryAfter_s;
+           CPU_BOOLEAN           ConnOverloadEvictIdleEn;
 
 /*
 *--------------------------------------------------------------------------------------------------------
@@ -1118,6 +1433,34 @@ typedef  struct  https_cfg {
     const  HTTPs_TOKEN_CFG      *TokenCfgPtr;
 
 
+/*
+*--------------------------------------------------------------------------------------------------------
+*                                STREAMING DEFLATE COMPRESSION CONFIGURATION
+*--------------------------------------------------------------------------------------------------------
+*/
+
+    const  HTTPs_DEFLATE_CFG    *DeflateCfgPtr;
+
+
+/*
+*--------------------------------------------------------------------------------------------------------
+*                                  INSTANCE SOCKET EVENT CONFIGURATION
+*--------------------------------------------------------------------------------------------------------
+*/
+
+    const  HTTPs_SOCK_EVT_API   *SockEvtAPI_Ptr;
+
+
+/*
+*--------------------------------------------------------------------------------------------------------
+*                                    INSTANCE WORKER CONFIGURATION
+*--------------------------------------------------------------------------------------------------------
+*/
+
+           CPU_INT08U            WorkerNbr;
+    const  NET_TASK_CFG         *WorkerTaskCfgTbl;
+
+
 } HTTPs_CFG;                                                    /* End of configuration structure.                      */
 
 
@@ -1132,10 +1475,18 @@ typedef  struct  HTTPs_InstanceStats {
     CPU_INT32U  Conn_StatClosedCtr;
     CPU_INT32U  Conn_StatAcquiredCtr;
     CPU_INT32U  Conn_StatReleasedCtr;
+    CPU_INT32U  Conn_StatTimeoutReqHdrCtr;
+    CPU_INT32U  Conn_StatTimeoutReqBodyCtr;
+    CPU_INT32U  Conn_StatTimeoutIdleCtr;
+    CPU_INT32U  Conn_StatOverloadEnterCtr;
+    CPU_INT32U  Conn_StatOverloadExitCtr;
+    CPU_INT32U  Conn_StatOverloadRejectedCtr;
+    CPU_INT32U  Conn_StatOverloadEvictedCtr;
 
     CPU_INT32U  Sock_StatListenCloseCtr;
     CPU_INT32U  Sock_StatOctetRxdCtr;
     CPU_INT32U  Sock_StatOctetTxdCtr;
+    CPU_INT32U  Sock_StatOctetRxMovedCtr;
 
     CPU_INT32U  FS_StatOpenedCtr;
     CPU_INT32U  FS_StatClosedCtr;
@@ -1155,6 +1506,13 @@ typedef  struct  HTTPs_InstanceStats {
     CPU_INT32U  Resp_StatTokenFoundCtr;
 #endif
 
+#if (HTTPs_CFG_DEFLATE_EN == DEF_ENABLED)
+    CPU_INT32U  Resp_StatDeflateAcquiredCtr;
+    CPU_INT32U  Resp_StatDeflateReleaseCtr;
+    CPU_INT32U  Resp_StatDeflateOctetInCtr;
+    CPU_INT32U  Resp_StatDeflateOctetOutCtr;
+#endif
+
 #if ((HTTPs_CFG_FORM_EN      == DEF_ENABLED) || \
      (HTTPs_CFG_QUERY_STR_EN == DEF_ENABLED))
     CPU_INT32U  Req_StatKeyValAcquiredCtr;
@@ -1175,6 +1533,7 @@ typedef  struct  HTTPs_InstanceStats {
 
     CPU_INT32U  Req_StatRxdCtr;
     CPU_INT32U  Req_StatProcessedCtr;
+    CPU_INT32U  Req_StatPipelinedCtr;
     CPU_INT32U  Req_StatMethodGetRxdCtr;
     CPU_INT32U  Req_StatMethodHeadRxdCtr;
     CPU_INT32U  Req_StatMethodPostRxdCtr;
@@ -1283,6 +1642,7 @@ typedef  struct  HTTPs_InstanceErrs {
     CPU_INT32U  Req_ErrBodyPostFormCtr;
     CPU_INT32U  Req_ErrBodyFormNotEn;
     CPU_INT32U  Req_ErrBodyFormMultipartNotEn;
+    CPU_INT32U  Req_ErrPipelineDiscardCtr;
 
 #if ((HTTPs_CFG_QUERY_STR_EN == DEF_ENABLED) || \
      (HTTPs_CFG_FORM_EN      == DEF_ENABLED))
@@ -1375,6 +1735,16 @@ typedef  struct  HTTPs_InstanceErrs {
     CPU_INT32U  Resp_ErrTokenTypeInvalidCtr;
 #endif
 
+#if (HTTPs_CFG_DEFLATE_EN == DEF_ENABLED)
+    CPU_INT32U  Resp_ErrDeflatePoolMemSpaceCtr;
+    CPU_INT32U  Resp_ErrDeflatePoolEmptyCtr;
+    CPU_INT32U  Resp_ErrDeflatePoolLibGetCtr;
+    CPU_INT32U  Resp_ErrDeflatePoolLibFreeCtr;
+
+    CPU_INT32U  Resp_ErrDeflateCloseNotEmptyCtr;
+    CPU_INT32U  Resp_ErrDeflateClrNotEmptyCtr;
+#endif
+
     CPU_INT32U  Resp_ErrBodyTypeInvalidCtr;
     CPU_INT32U  Resp_ErrPathInvalidCtr;
     CPU_INT32U  Resp_ErrContentTypeInvalidCtr;
@@ -1452,37 +1822,26 @@ struct  HTTPs_Instance {
 #endif
 
            MEM_DYN_POOL           PoolConn;
-           MEM_DYN_POOL           PoolBuf;
-           MEM_DYN_POOL           PoolPath;
 
-#if (HTTPs_CFG_ABSOLUTE_URI_EN == DEF_ENABLED)
-           MEM_DYN_POOL           PoolHost;
-#endif
+           CPU_SIZE_T             TxnArenaLen;
 
 #if (HTTPs_CFG_TOKEN_PARSE_EN == DEF_ENABLED)
            MEM_DYN_POOL           PoolTokenCtrl;
            MEM_DYN_POOL           PoolTokenVal;
 #endif
 
-
-#if ((HTTPs_CFG_FORM_EN      == DEF_ENABLED) || \
-     (HTTPs_CFG_QUERY_STR_EN == DEF_ENABLED))
-           MEM_DYN_POOL           PoolKeyVal;
+#if (HTTPs_CFG_DEFLATE_EN == DEF_ENABLED)
+           MEM_DYN_POOL           PoolDeflate;
+           CPU_INT16U             DeflateOutLenMax;
 #endif
 
+
 #if (HTTPs_CFG_FORM_EN == DEF_ENABLED)
-           MEM_DYN_POOL           PoolFormKeyStr;
-           MEM_DYN_POOL           PoolFormValStr;
+           MEM_DYN_POOL           PoolFormKeyVal;
 #endif
 
 #if (HTTPs_CFG_QUERY_STR_EN == DEF_ENABLED)
-           MEM_DYN_POOL           PoolQueryStrKeyStr;
-           MEM_DYN_POOL           PoolQueryStrValStr;
-#endif
-
-#if ((HTTPs_CFG_FORM_EN           == DEF_ENABLED) || \
-     (HTTPs_CFG_FORM_MULTIPART_EN == DEF_ENABLED))
-           MEM_DYN_POOL           PoolFormBoundary;
+           MEM_DYN_POOL           PoolQueryStrKeyVal;
 #endif
 
 
@@ -1499,7 +1858,38 @@ struct  HTTPs_Instance {
            HTTPs_CONN            *ConnFirstPtr;
            HTTPs_CONN            *ConnLastPtr;
 
-           CPU_INT08U             ConnActiveCtr;
+           CPU_INT16U             ConnActiveCtr;
+
+    const  HTTPs_SOCK_EVT_API    *SockEvtAPI_Ptr;
+           void                  *SockEvtDataPtr;
+           CPU_BOOLEAN            SockListenEvtEn;
+
+           HTTPs_CONN            *ConnRdyFirstPtr;
+           HTTPs_CONN            *ConnRdyLastPtr;
+           NET_SOCK_QTY           ConnRdyCtr;
+           HTTPs_CONN            *ConnPollFirstPtr;
+           NET_SOCK_QTY           ConnPollCtr;
+
+           HTTPs_CONN            *ConnTmrWheel[HTTPs_CONN_TMR_WHEEL_SLOT_NBR];
+           CPU_INT32U             ConnTmrWheelTS_ms;
+           CPU_INT08U             ConnTmrWheelSlotIx;
+           NET_SOCK_QTY           ConnTmrCtr;
+
+           CPU_BOOLEAN            ConnOverloadActive;
+           CPU_CHAR               ConnOverloadRespBuf[HTTPs_CONN_OVERLOAD_RESP_LEN_MAX + 1u];
+           CPU_INT16U             ConnOverloadRespLen;
+
+           CPU_INT16U             ConnNbrMax;
+
+           HTTPs_INSTANCE        *WorkerParentPtr;
+           HTTPs_INSTANCE       **WorkerTbl;
+           CPU_INT08U             WorkerNbr;
+           CPU_INT08U             WorkerIxNext;
+
+           HTTPs_WORKER_HANDOFF  *WorkerQ;
+           CPU_INT16U             WorkerQ_IxIn;
+           CPU_INT16U             WorkerQ_IxOut;
+           CPU_INT16U             WorkerQ_Ctr;
 
 #if (HTTPs_CFG_DBG_INFO_EN == DEF_ENABLED)
            HTTPs_INSTANCE        *InstancePrevPtr;
@@ -1514,6 +1904,7 @@ struct  HTTPs_Instance {
            HTTPs_INSTANCE_ERRS    ErrsCtr;
 #endif
            CPU_BOOLEAN            SelAbortReq;
+           CPU_BOOLEAN            WakeReq;
 };
 
 
@@ -1636,6 +2027,21 @@ void             HTTPs_InstanceStop               (       HTTPs_INSTANCE
                                                           CPU_BOOLEAN            graceful_stop_en,
                                                           HTTPs_ERR             *p_err);
 
+void             HTTPs_InstanceWakeUp             (       HTTPs_INSTANCE        *p_instance,
+                                                          HTTPs_ERR             *p_err);
+
+#if (HTTPs_CFG_CTR_STAT_EN == DEF_ENABLED)
+void             HTTPs_InstanceStatsGet           (       HTTPs_INSTANCE        *p_instance,
+                                                          HTTPs_INSTANCE_STATS  *p_stats,
+                                                          HTTPs_ERR             *p_err);
+#endif
+
+#if (HTTPs_CFG_CTR_ERR_EN == DEF_ENABLED)
+void             HTTPs_InstanceErrsGet            (       HTTPs_INSTANCE        *p_instance,
+                                                          HTTPs_INSTANCE_ERRS   *p_errs,
+                                                          HTTPs_ERR             *p_err);
+#endif
+
 
 HTTP_HDR_BLK    *HTTPs_RespHdrGet                 (const  HTTPs_INSTANCE        *p_instance,
                                                           HTTPs_CONN            *p_conn,
@@ -50,6 +50,8 @@
 *********************************************************************************************************
 */
 
+#define  HTTPs_CONN_PROCESS_WORK_MAX                        16u /* Max states run per conn per pass.                    */
+
 
 /*
 *********************************************************************************************************
@@ -70,10 +72,12 @@ static  void  HTTPsConn_ErrInternal (HTTPs_INSTANCE  *p_instance,
 *********************************************************************************************************
 *                                          HTTPsConn_Process()
 *
-* Description : (1) Process each accepted connection:
+* Description : (1) Process each connection ready:
 *
-*                   (a) Receive, transmit, process data or close connection, if the connection is ready.
+*                   (a) Receive, transmit, process data or close connection.
 *                   (b) Update connection state, parse received data or prepare data to transmit.
+*                   (c) Update connection deadline.
+*                   (d) Update connection socket events.
 *
 * Argument(s) : p_instance  Pointer to the instance.
 *               ----------  Argument validated in HTTPs_InstanceStart().
@@ -82,44 +86,75 @@ static  void  HTTPsConn_ErrInternal (HTTPs_INSTANCE  *p_instance,
 *
 * Caller(s)   : HTTPs_InstanceTaskHandler().
 *
-* Note(s)     : none.
+* Note(s)     : (1) Only the connections queued in the instance ready list by HTTPsSock_ConnSel() are
+*                   processed. See HTTPsSock_ConnEvtUpdate().
+*
+*               (2) Connections queued again while processing are kept for the next pass, so a connection
+*                   that does not wait for any socket event can't monopolize the instance task.
+*
+*               (3) A connection is run through its states until it is blocked on the socket :
+*
+*                   (a) States that require no socket operation are chained in the same pass instead of
+*                       waiting for another HTTPsSock_ConnSel() round trip. A state that makes no progress
+*                       (e.g. polling the application) ends the pass.
+*
+*                   (b) The socket is non-blocking, so data ready to transmit is transmitted right away. The
+*                       connection waits for the socket only when the data could not be entirely
+*                       transmitted or when more data must be received.
+*
+*                   (c) The number of states run per pass is limited by HTTPs_CONN_PROCESS_WORK_MAX so that
+*                       one connection cannot starve the other ready connections.
+*
+*               (4) A connection for which the application is still processing the request does not keep
+*                   the instance task busy. It is polled again as soon as the application calls
+*                   HTTPs_InstanceWakeUp(). See HTTPsSock_ConnEvtPoll().
+*
+*               (5) When the next request of a persistent connection was already received with the previous
+*                   one (i.e. pipelined requests), it is parsed right away instead of waiting for the socket
+*                   to be readable again. See HTTPsReq_PipelineSave().
+*
+*               (6) The request header, request body & persistent connection idle phases each have their own
+*                   deadline, armed when the connection enters the phase. The idle phase is set explicitly
+*                   when the transaction completes since the whole transaction may have been processed in a
+*                   single pass. See HTTPsSock_ConnTmrSet().
 *********************************************************************************************************
 */
 
 void  HTTPsConn_Process (HTTPs_INSTANCE  *p_instance)
 {
-    const  HTTPs_CFG    *p_cfg;
-           HTTPs_CONN   *p_conn;
-           HTTPs_CONN   *p_conn_next;
-           NET_ERR       net_err;
-           CPU_BOOLEAN   done;
-           CPU_BOOLEAN   hook_def;
-           CPU_BOOLEAN   process;
-           CPU_BOOLEAN   rdy_rd;
-           CPU_BOOLEAN   rdy_wr;
-           CPU_BOOLEAN   rdy_err;
+    const  HTTPs_CFG         *p_cfg;
+           HTTPs_CONN        *p_conn;
+           NET_ERR            net_err;
+           CPU_BOOLEAN        done;
+           CPU_BOOLEAN        hook_def;
+           CPU_BOOLEAN        process;
+           CPU_BOOLEAN        closed;
+           CPU_BOOLEAN        run;
+           NET_SOCK_QTY       nbr_rdy;
+           CPU_INT08U         work_ctr;
+           HTTPs_CONN_STATE   state_prev;
 #if (HTTPs_CFG_PERSISTENT_CONN_EN == DEF_ENABLED)
-           CPU_BOOLEAN   persistent;
+           CPU_BOOLEAN        persistent;
 #endif
 
 
-    p_cfg  = p_instance->CfgPtr;
-    p_conn = p_instance->ConnFirstPtr;
-
+    p_cfg   = p_instance->CfgPtr;
+    nbr_rdy = p_instance->ConnRdyCtr;                           /* See Note #2.                                         */
 
+    while (nbr_rdy > 0u) {                                      /* For each rdy conn.                                   */
+        nbr_rdy--;
 
-    while (p_conn != DEF_NULL) {                                /* For each accepted conn.                              */
-
-        rdy_rd  = DEF_BIT_IS_SET(p_conn->SockFlags, HTTPs_FLAG_SOCK_RDY_RD);
-        rdy_wr  = DEF_BIT_IS_SET(p_conn->SockFlags, HTTPs_FLAG_SOCK_RDY_WR);
-        rdy_err = DEF_BIT_IS_SET(p_conn->SockFlags, HTTPs_FLAG_SOCK_RDY_ERR);
-
-        p_conn_next = p_conn->ConnNextPtr;                      /* Req'd since cur conn can be closed.                  */
+        p_conn = HTTPsSock_ConnRdyGet(p_instance);
+        if (p_conn == DEF_NULL) {
+            break;
+        }
 
-        if ((rdy_rd  == DEF_YES) ||                             /* If conn sock rdy.                                    */
-            (rdy_wr  == DEF_YES) ||
-            (rdy_err == DEF_YES)) {
+        closed   = DEF_NO;
+        work_ctr = 0u;
 
+        do {                                                    /* Run conn until it must wait for sock (see Note #3).  */
+            state_prev = p_conn->State;
+            work_ctr++;
 
                                                                 /* ---------------- CONN SOCK PROCESS ----------------- */
             switch (p_conn->SockState) {
@@ -149,6 +184,7 @@ void  HTTPsConn_Process (HTTPs_INSTANCE  *p_instance)
                 default:
                      HTTPsConn_Close(p_instance, p_conn);
                      process = DEF_NO;
+                     closed  = DEF_YES;
                      break;
             }
 
@@ -201,7 +237,9 @@ void  HTTPsConn_Process (HTTPs_INSTANCE  *p_instance)
                     case HTTPs_CONN_STATE_RESP_STATUS_LINE:
                     case HTTPs_CONN_STATE_RESP_HDR:
                     case HTTPs_CONN_STATE_RESP_HDR_CONTENT_TYPE:
+                    case HTTPs_CONN_STATE_RESP_HDR_CONTENT_CODING:
                     case HTTPs_CONN_STATE_RESP_HDR_FILE_TRANSFER:
+                    case HTTPs_CONN_STATE_RESP_HDR_VALIDATOR:
                     case HTTPs_CONN_STATE_RESP_HDR_LOCATION:
                     case HTTPs_CONN_STATE_RESP_HDR_CONN:
                     case HTTPs_CONN_STATE_RESP_HDR_LIST:
@@ -227,7 +265,14 @@ void  HTTPsConn_Process (HTTPs_INSTANCE  *p_instance)
                          if ((p_cfg->ConnPersistentEn == DEF_ENABLED) &&
                              (persistent              == DEF_YES)    ) {
                               HTTPsMem_ConnClr(p_instance, p_conn);
-                              p_conn->SockState = HTTPs_SOCK_STATE_RX;
+                              HTTPsSock_ConnTmrSet(p_instance, /* Wait for next req (see Note #6).                      */
+                                                   p_conn,
+                                                   HTTPs_CONN_TMR_PHASE_IDLE);
+                              if (p_conn->RxBufLenRem > 0u) {  /* Parse next req already rxd (see Note #5).             */
+                                  p_conn->SockState = HTTPs_SOCK_STATE_NONE;
+                              } else {
+                                  p_conn->SockState = HTTPs_SOCK_STATE_RX;
+                              }
                               p_conn->State     = HTTPs_CONN_STATE_REQ_INIT;
                          } else {
                               p_conn->SockState = HTTPs_SOCK_STATE_CLOSE;
@@ -262,13 +307,86 @@ void  HTTPsConn_Process (HTTPs_INSTANCE  *p_instance)
                          break;
                 }
             }
-        }
 
-        p_conn = p_conn_next;                                   /* Move to next accepted conn.                          */
+                                                                /* ------------------ CHK CONN BLOCKED ---------------- */
+            run = DEF_NO;
+            if ((closed   == DEF_NO) &&
+                (process  == DEF_YES) &&
+                (work_ctr <  HTTPs_CONN_PROCESS_WORK_MAX)) {
+                switch (p_conn->SockState) {
+                    case HTTPs_SOCK_STATE_NONE:                 /* No sock op: continue if conn state progressed.       */
+                         if (p_conn->State != state_prev) {
+                             run = DEF_YES;
+                         }
+                         break;
+
+
+                    case HTTPs_SOCK_STATE_TX:                   /* Try to tx now (see Note #3b).                        */
+                    case HTTPs_SOCK_STATE_ERR:
+                    case HTTPs_SOCK_STATE_CLOSE:
+                         run = DEF_YES;
+                         break;
+
+
+                    case HTTPs_SOCK_STATE_RX:                   /* Wait for rx data.                                    */
+                    default:
+                         break;
+                }
+            }
+        } while (run == DEF_YES);
+
+                                                                /* ------------- UPDATE CONN SOCK EVENTS -------------- */
+        if (closed == DEF_NO) {
+            HTTPsSock_ConnTmrUpdate(p_instance, p_conn);        /* Update conn deadline (see Note #6).                  */
+
+            if ((p_conn->State     == HTTPs_CONN_STATE_REQ_READY_POLL) &&
+                (p_conn->State     == state_prev)                     &&
+                (p_conn->SockState == HTTPs_SOCK_STATE_NONE)) {
+                HTTPsSock_ConnEvtPoll(p_instance, p_conn);      /* Wait for the app (see Note #4).                      */
+            } else {
+                HTTPsSock_ConnEvtUpdate(p_instance, p_conn);
+            }
+        }
     }
 }
 
 
+/*
+*********************************************************************************************************
+*                                           HTTPsConn_Evict()
+*
+* Description : Close an idle persistent connection to make room for a new connection.
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceStart().
+*
+*               p_conn      Pointer to the connection to close.
+*               ------      Argument validated in HTTPsSock_ConnAdmit().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPsSock_ConnAdmit().
+*
+* Note(s)     : (1) The connection must belong to the instance & be waiting for its next request; it is closed
+*                   the same way as a connection closed by the peer, including the connection close hook.
+*
+*               (2) Evicted connections are counted apart from the other closed connections.
+*********************************************************************************************************
+*/
+
+void  HTTPsConn_Evict (HTTPs_INSTANCE  *p_instance,
+                       HTTPs_CONN      *p_conn)
+{
+    HTTPs_INSTANCE_STATS  *p_ctr_stats;
+
+
+    HTTPs_SET_PTR_STATS(p_ctr_stats, p_instance);
+
+    HTTPsConn_Close(p_instance, p_conn);
+    HTTPs_STATS_INC(p_ctr_stats->Conn_StatOverloadEvictedCtr);  /* See Note #2.                                         */
+}
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -296,7 +414,8 @@ void  HTTPsConn_Process (HTTPs_INSTANCE  *p_instance)
 *
 * Return(s)   : none.
 *
-* Caller(s)   : HTTPsConn_Process().
+* Caller(s)   : HTTPsConn_Process(),
+*               HTTPsConn_Evict().
 *
 * Note(s)     : none.
 *********************************************************************************************************
@@ -319,6 +438,13 @@ static  void  HTTPsConn_Close (HTTPs_INSTANCE  *p_instance,
     }
 #endif
 
+#if (HTTPs_CFG_DEFLATE_EN == DEF_ENABLED)
+    if (p_conn->DeflateCtxPtr != DEF_NULL) {
+        HTTPsMem_DeflateRelease(p_instance, p_conn);
+        HTTPs_ERR_INC(p_ctr_err->Resp_ErrDeflateCloseNotEmptyCtr);
+    }
+#endif
+
 #if (HTTPs_CFG_QUERY_STR_EN == DEF_ENABLED)
     HTTPsMem_QueryStrKeyValBlkReleaseAll(p_instance, p_conn);
 #endif
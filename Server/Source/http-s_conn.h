@@ -62,6 +62,9 @@
 
 void  HTTPsConn_Process (HTTPs_INSTANCE  *p_instance);
 
+void  HTTPsConn_Evict   (HTTPs_INSTANCE  *p_instance,
+                         HTTPs_CONN      *p_conn);
+
 
 /*
 *********************************************************************************************************
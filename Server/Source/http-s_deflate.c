@@ -0,0 +1,705 @@
+/*
+*********************************************************************************************************
+*                                               uC/HTTP
+*                                     Hypertext Transfer Protocol
+*
+*                    Copyright 2004-2021 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                  HTTP SERVER STREAMING DEFLATE MODULE
+*
+* Filename : http-s_deflate.c
+* Version  : V3.01.01
+*********************************************************************************************************
+* Note(s)  : (1) This module compresses the body of a response as a single gzip member (RFC #1952) holding
+*                a deflate stream (RFC #1951) built on the fly, one chunk at a time:
+*
+*                (a) Repeated strings are found with a single probe hash table of the last position of each
+*                    3-octet sequence, within a window of the last octets compressed. No lazy matching is
+*                    done & only the position where a literal or a match starts is inserted in the table.
+*
+*                (b) Literals & matches are coded with the fixed Huffman codes (RFC #1951, Section 3.2.6),
+*                    so no frequency statistics need to be buffered & each chunk is coded as soon as it is
+*                    received.
+*
+*                (c) Each chunk is coded in its own block, closed & followed by an empty stored block, i.e. a
+*                    sync flush. The chunk then ends on an octet boundary & can be decoded as soon as it is
+*                    received, for at most 7 octets of overhead per chunk.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                             INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define    MICRIUM_SOURCE
+#define    HTTPs_DEFLATE_MODULE
+
+#include  "http-s_deflate.h"
+
+#if (HTTPs_CFG_DEFLATE_EN == DEF_ENABLED)
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  HTTPs_DEFLATE_MATCH_LEN_MIN                       3u
+#define  HTTPs_DEFLATE_MATCH_LEN_MAX                     258u
+
+#define  HTTPs_DEFLATE_LEN_CODE_NBR                       29u
+#define  HTTPs_DEFLATE_DIST_CODE_NBR                      30u
+
+#define  HTTPs_DEFLATE_SYM_EOB                           256u
+#define  HTTPs_DEFLATE_SYM_LEN_BASE                      257u
+
+#define  HTTPs_DEFLATE_BLK_HDR_LEN                         3u
+#define  HTTPs_DEFLATE_BLK_HDR_FIXED                       2u   /* BFINAL = 0, BTYPE = 01 (fixed Huffman codes).        */
+#define  HTTPs_DEFLATE_BLK_HDR_FIXED_FINAL                 3u   /* BFINAL = 1, BTYPE = 01 (fixed Huffman codes).        */
+#define  HTTPs_DEFLATE_BLK_HDR_STORED                      0u   /* BFINAL = 0, BTYPE = 00 (stored).                     */
+#define  HTTPs_DEFLATE_BLK_STORED_LEN_EMPTY       0xFFFF0000u   /* LEN = 0 & NLEN = ~LEN, little endian.                */
+
+#define  HTTPs_DEFLATE_DIST_CODE_LEN                       5u
+
+#define  HTTPs_DEFLATE_HASH_MULT                  0x9E3779B1u
+#define  HTTPs_DEFLATE_CRC_INIT                   0xFFFFFFFFu
+
+#define  HTTPs_DEFLATE_GZIP_HDR_LEN                       10u
+
+                                                                /* Reverse the bit order of an octet.                   */
+#define  HTTPs_DEFLATE_BIT_REV8(val)                ((CPU_INT32U)(((CPU_INT32U)HTTPsDeflate_BitRevTbl[(val) & 0x0Fu] << 4u) | \
+                                                                              HTTPsDeflate_BitRevTbl[((val) >> 4u) & 0x0Fu]))
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                        LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+                                                                /* Gzip hdr: deflate, no flags, no mtime, unknown OS.   */
+static  const  CPU_INT08U  HTTPsDeflate_GzipHdrTbl[HTTPs_DEFLATE_GZIP_HDR_LEN] = {
+    0x1Fu, 0x8Bu, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xFFu
+};
+
+                                                                /* Base len & nbr of extra bits of each len code.       */
+static  const  CPU_INT16U  HTTPsDeflate_LenBaseTbl[HTTPs_DEFLATE_LEN_CODE_NBR] = {
+      3u,   4u,   5u,   6u,   7u,   8u,   9u,  10u,  11u,  13u,
+     15u,  17u,  19u,  23u,  27u,  31u,  35u,  43u,  51u,  59u,
+     67u,  83u,  99u, 115u, 131u, 163u, 195u, 227u, 258u
+};
+
+static  const  CPU_INT08U  HTTPsDeflate_LenExtraTbl[HTTPs_DEFLATE_LEN_CODE_NBR] = {
+      0u,   0u,   0u,   0u,   0u,   0u,   0u,   0u,   1u,   1u,
+      1u,   1u,   2u,   2u,   2u,   2u,   3u,   3u,   3u,   3u,
+      4u,   4u,   4u,   4u,   5u,   5u,   5u,   5u,   0u
+};
+
+                                                                /* Base dist & nbr of extra bits of each dist code.     */
+static  const  CPU_INT16U  HTTPsDeflate_DistBaseTbl[HTTPs_DEFLATE_DIST_CODE_NBR] = {
+        1u,     2u,     3u,     4u,     5u,     7u,     9u,    13u,    17u,    25u,
+       33u,    49u,    65u,    97u,   129u,   193u,   257u,   385u,   513u,   769u,
+     1025u,  1537u,  2049u,  3073u,  4097u,  6145u,  8193u, 12289u, 16385u, 24577u
+};
+
+static  const  CPU_INT08U  HTTPsDeflate_DistExtraTbl[HTTPs_DEFLATE_DIST_CODE_NBR] = {
+      0u,   0u,   0u,   0u,   1u,   1u,   2u,   2u,   3u,   3u,
+      4u,   4u,   5u,   5u,   6u,   6u,   7u,   7u,   8u,   8u,
+      9u,   9u,  10u,  10u,  11u,  11u,  12u,  12u,  13u,  13u
+};
+
+                                                                /* Bit order reversal of each nibble.                   */
+static  const  CPU_INT08U  HTTPsDeflate_BitRevTbl[16] = {
+    0x0u, 0x8u, 0x4u, 0xCu, 0x2u, 0xAu, 0x6u, 0xEu,
+    0x1u, 0x9u, 0x5u, 0xDu, 0x3u, 0xBu, 0x7u, 0xFu
+};
+
+                                                                /* CRC-32 (reflected 0x04C11DB7) of each nibble.        */
+static  const  CPU_INT32U  HTTPsDeflate_CRC_Tbl[16] = {
+    0x00000000u, 0x1DB71064u, 0x3B6E20C8u, 0x26D930ACu,
+    0x76DC4190u, 0x6B6B51F4u, 0x4DB26158u, 0x5005713Cu,
+    0xEDB88320u, 0xF00F9344u, 0xD6D6A3E8u, 0xCB61B38Cu,
+    0x9B64C2B0u, 0x86D3D2D4u, 0xA00AE278u, 0xBDBDF21Cu
+};
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U  *HTTPsDeflate_HdrWr       (       HTTPs_DEFLATE_CTX  *p_ctx,
+                                                      CPU_INT08U         *p_out);
+
+static  CPU_INT08U  *HTTPsDeflate_SyncWr      (       HTTPs_DEFLATE_CTX  *p_ctx,
+                                                      CPU_INT08U         *p_out);
+
+static  CPU_INT08U  *HTTPsDeflate_SymWr       (       HTTPs_DEFLATE_CTX  *p_ctx,
+                                                      CPU_INT08U         *p_out,
+                                                      CPU_INT16U          sym);
+
+static  CPU_INT08U  *HTTPsDeflate_MatchWr     (       HTTPs_DEFLATE_CTX  *p_ctx,
+                                                      CPU_INT08U         *p_out,
+                                                      CPU_INT16U          len,
+                                                      CPU_INT16U          dist);
+
+static  CPU_INT08U  *HTTPsDeflate_BitsWr      (       HTTPs_DEFLATE_CTX  *p_ctx,
+                                                      CPU_INT08U         *p_out,
+                                                      CPU_INT32U          bits,
+                                                      CPU_INT08U          nbr_bits);
+
+static  CPU_INT16U   HTTPsDeflate_MatchLenGet (       HTTPs_DEFLATE_CTX  *p_ctx,
+                                               const  CPU_INT08U         *p_data,
+                                                      CPU_SIZE_T          len_max,
+                                                      CPU_INT16U          dist);
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           GLOBAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                         HTTPsDeflate_Start()
+*
+* Description : Start the compression of a new response body.
+*
+* Argument(s) : p_ctx       Pointer to the deflate context.
+*               -----       Argument validated in HTTPsMem_DeflateGet().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPsMem_DeflateGet().
+*
+*               This function is an INTERNAL HTTP server function & MUST NOT be called by application
+*               function(s).
+*
+* Note(s)     : (1) The hash table is not cleared. An entry left by a previous body can only point inside
+*                   the octets of the current body already in the window, since a candidate is discarded
+*                   when its distance is greater than the number of octets compressed. The octets are then
+*                   compared before the match is used.
+*********************************************************************************************************
+*/
+
+void  HTTPsDeflate_Start (HTTPs_DEFLATE_CTX  *p_ctx)
+{
+    p_ctx->HdrTxd = DEF_NO;
+    p_ctx->BitCnt = 0u;
+    p_ctx->BitBuf = 0u;
+    p_ctx->CRC    = HTTPs_DEFLATE_CRC_INIT;
+    p_ctx->Pos    = 0u;                                         /* Invalidates the hash tbl entries (see Note #1).      */
+}
+
+
+/*
+*********************************************************************************************************
+*                                           HTTPsDeflate_Wr()
+*
+* Description : (1) Compress a part of the response body:
+*
+*                   (a) Write the gzip header, if not already done.
+*                   (b) Update the CRC-32 of the uncompressed data.
+*                   (c) Open a block & code each octet as a literal or as the start of a match.
+*                   (d) Copy the octets in the window.
+*                   (e) Close the block & flush the stream to an octet boundary (see 'Note #1c').
+*
+* Argument(s) : p_ctx       Pointer to the deflate context.
+*               -----       Argument validated in HTTPsMem_DeflateGet().
+*
+*               p_data      Pointer to the data to compress.
+*
+*               data_len    Length of the data to compress.
+*
+*               p_out       Pointer to the buffer that will receive the compressed data. The buffer MUST be
+*                           at least HTTPs_DEFLATE_OUT_LEN_MAX(data_len) long.
+*
+* Return(s)   : Length of the compressed data written in the buffer.
+*
+* Caller(s)   : HTTPsResp_DeflateChunkWr().
+*
+*               This function is an INTERNAL HTTP server function & MUST NOT be called by application
+*               function(s).
+*
+* Note(s)     : (2) A match cannot extend past the end of the data. The octets preceding the data are read
+*                   from the window & the following ones from the data itself, so that a match can overlap
+*                   the octets it copies.
+*
+*               (3) The hash table holds the 16 low order bits of the positions. The distance computed
+*                   from an entry is only used when it designates an octet present in the window.
+*********************************************************************************************************
+*/
+
+CPU_SIZE_T  HTTPsDeflate_Wr (       HTTPs_DEFLATE_CTX  *p_ctx,
+                             const  CPU_INT08U         *p_data,
+                                    CPU_SIZE_T          data_len,
+                                    CPU_INT08U         *p_out)
+{
+    CPU_INT08U  *p_wr;
+    CPU_SIZE_T   ix;
+    CPU_SIZE_T   len_rem;
+    CPU_INT32U   crc;
+    CPU_INT32U   hash;
+    CPU_INT32U   win_len;
+    CPU_INT16U   dist;
+    CPU_INT16U   match_len;
+    CPU_INT16U   i;
+
+
+    if (data_len == 0u) {
+        return (0u);
+    }
+
+    p_wr = p_out;
+                                                                /* ----------------- WR GZIP HDR ---------------------- */
+    if (p_ctx->HdrTxd == DEF_NO) {
+        p_wr = HTTPsDeflate_HdrWr(p_ctx, p_wr);
+    }
+
+                                                                /* ------------------- UPDATE CRC --------------------- */
+    crc = p_ctx->CRC;
+    for (ix = 0u; ix < data_len; ix++) {
+        crc ^= p_data[ix];
+        crc  = (crc >> 4u) ^ HTTPsDeflate_CRC_Tbl[crc & 0x0Fu];
+        crc  = (crc >> 4u) ^ HTTPsDeflate_CRC_Tbl[crc & 0x0Fu];
+    }
+    p_ctx->CRC = crc;
+
+                                                                /* ------------------- CODE DATA ---------------------- */
+    p_wr    = HTTPsDeflate_BitsWr(p_ctx, p_wr, HTTPs_DEFLATE_BLK_HDR_FIXED, HTTPs_DEFLATE_BLK_HDR_LEN);
+    win_len = (CPU_INT32U)p_ctx->WinMask + 1u;
+    ix      =  0u;
+    while (ix < data_len) {
+        len_rem   = data_len - ix;
+        match_len = 0u;
+
+        if (len_rem >= HTTPs_DEFLATE_MATCH_LEN_MIN) {           /* Find the last pos of the next 3 octets.              */
+            hash  = ((CPU_INT32U)p_data[ix]              ) |
+                    ((CPU_INT32U)p_data[ix + 1u] <<  8u) |
+                    ((CPU_INT32U)p_data[ix + 2u] << 16u);
+            hash  = (hash * HTTPs_DEFLATE_HASH_MULT) >> p_ctx->HashShift;
+            dist  = (CPU_INT16U)((CPU_INT16U)p_ctx->Pos - p_ctx->HashTblPtr[hash]);
+            p_ctx->HashTblPtr[hash] = (CPU_INT16U)p_ctx->Pos;
+
+            if ((dist >  0u)      &&                            /* Validate the candidate pos (see Note #3).            */
+                (dist <= win_len) &&
+                (dist <= p_ctx->Pos)) {
+                match_len = HTTPsDeflate_MatchLenGet(p_ctx,
+                                                    &p_data[ix],
+                                                     DEF_MIN(len_rem, HTTPs_DEFLATE_MATCH_LEN_MAX),
+                                                     dist);
+            }
+        }
+
+        if (match_len >= HTTPs_DEFLATE_MATCH_LEN_MIN) {
+            p_wr = HTTPsDeflate_MatchWr(p_ctx, p_wr, match_len, dist);
+        } else {
+            match_len = 1u;
+            p_wr      = HTTPsDeflate_SymWr(p_ctx, p_wr, p_data[ix]);
+        }
+                                                                /* ---------------- COPY DATA IN WIN ------------------ */
+        for (i = 0u; i < match_len; i++) {
+            p_ctx->WinPtr[p_ctx->Pos & p_ctx->WinMask] = p_data[ix];
+            p_ctx->Pos++;
+            ix++;
+        }
+    }
+                                                                /* ------------------ FLUSH STREAM -------------------- */
+    p_wr = HTTPsDeflate_SymWr(p_ctx, p_wr, HTTPs_DEFLATE_SYM_EOB);
+    p_wr = HTTPsDeflate_SyncWr(p_ctx, p_wr);
+
+    return ((CPU_SIZE_T)(p_wr - p_out));
+}
+
+
+/*
+*********************************************************************************************************
+*                                         HTTPsDeflate_Finish()
+*
+* Description : (1) Terminate the compressed response body:
+*
+*                   (a) Write the gzip header, if the body is empty.
+*                   (b) Add an empty final block (see Note #2).
+*                   (c) Pad the last octet.
+*                   (d) Write the gzip trailer: CRC-32 & length of the uncompressed data.
+*
+* Argument(s) : p_ctx       Pointer to the deflate context.
+*               -----       Argument validated in HTTPsMem_DeflateGet().
+*
+*               p_out       Pointer to the buffer that will receive the compressed data. The buffer MUST be
+*                           at least HTTPs_DEFLATE_OUT_OVERHEAD_LEN long.
+*
+* Return(s)   : Length of the data written in the buffer.
+*
+* Caller(s)   : HTTPsResp_DeflateChunkWr().
+*
+*               This function is an INTERNAL HTTP server function & MUST NOT be called by application
+*               function(s).
+*
+* Note(s)     : (2) The last chunk is only known once it is already sent, so every block holding data is
+*                   closed by HTTPsDeflate_Wr() & the stream is ended by an empty block having the final bit
+*                   set.
+*********************************************************************************************************
+*/
+
+CPU_SIZE_T  HTTPsDeflate_Finish (HTTPs_DEFLATE_CTX  *p_ctx,
+                                 CPU_INT08U         *p_out)
+{
+    CPU_INT08U  *p_wr;
+    CPU_INT32U   crc;
+    CPU_INT08U   i;
+
+
+    p_wr = p_out;
+
+    if (p_ctx->HdrTxd == DEF_NO) {
+        p_wr = HTTPsDeflate_HdrWr(p_ctx, p_wr);
+    }
+                                                                /* --------------- CLOSE DEFLATE STREAM --------------- */
+    p_wr = HTTPsDeflate_BitsWr(p_ctx, p_wr, HTTPs_DEFLATE_BLK_HDR_FIXED_FINAL, HTTPs_DEFLATE_BLK_HDR_LEN);
+    p_wr = HTTPsDeflate_SymWr(p_ctx, p_wr, HTTPs_DEFLATE_SYM_EOB);
+
+    if (p_ctx->BitCnt > 0u) {                                   /* Pad the last octet.                                  */
+        p_wr = HTTPsDeflate_BitsWr(p_ctx, p_wr, 0u, DEF_OCTET_NBR_BITS - p_ctx->BitCnt);
+    }
+
+                                                                /* ----------------- WR GZIP TRAILER ------------------ */
+    crc = p_ctx->CRC ^ HTTPs_DEFLATE_CRC_INIT;
+    for (i = 0u; i < sizeof(CPU_INT32U); i++) {                 /* CRC-32 & len are little endian.                      */
+       *p_wr++ = (CPU_INT08U)(crc         >> (i * DEF_OCTET_NBR_BITS));
+    }
+    for (i = 0u; i < sizeof(CPU_INT32U); i++) {
+       *p_wr++ = (CPU_INT08U)(p_ctx->Pos >> (i * DEF_OCTET_NBR_BITS));
+    }
+
+    return ((CPU_SIZE_T)(p_wr - p_out));
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                         HTTPsDeflate_HdrWr()
+*
+* Description : Write the gzip header.
+*
+* Argument(s) : p_ctx       Pointer to the deflate context.
+*
+*               p_out       Pointer to where to write.
+*
+* Return(s)   : Pointer to the end of the data written.
+*
+* Caller(s)   : HTTPsDeflate_Wr(),
+*               HTTPsDeflate_Finish().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U  *HTTPsDeflate_HdrWr (HTTPs_DEFLATE_CTX  *p_ctx,
+                                         CPU_INT08U         *p_out)
+{
+    CPU_INT08U  *p_wr;
+
+
+    Mem_Copy(p_out, HTTPsDeflate_GzipHdrTbl, HTTPs_DEFLATE_GZIP_HDR_LEN);
+    p_wr = p_out + HTTPs_DEFLATE_GZIP_HDR_LEN;
+
+    p_ctx->HdrTxd = DEF_YES;
+
+    return (p_wr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         HTTPsDeflate_SyncWr()
+*
+* Description : Write an empty stored block, which pads the stream to an octet boundary.
+*
+* Argument(s) : p_ctx       Pointer to the deflate context.
+*
+*               p_out       Pointer to where to write.
+*
+* Return(s)   : Pointer to the end of the data written.
+*
+* Caller(s)   : HTTPsDeflate_Wr().
+*
+* Note(s)     : (1) RFC #1951, Section 3.2.4 : the LEN & NLEN fields of a stored block start on the next
+*                   octet boundary, so the bits following the block header are skipped.
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U  *HTTPsDeflate_SyncWr (HTTPs_DEFLATE_CTX  *p_ctx,
+                                          CPU_INT08U         *p_out)
+{
+    CPU_INT08U  *p_wr;
+
+
+    p_wr = HTTPsDeflate_BitsWr(p_ctx, p_out, HTTPs_DEFLATE_BLK_HDR_STORED, HTTPs_DEFLATE_BLK_HDR_LEN);
+
+    if (p_ctx->BitCnt > 0u) {                                   /* See Note #1.                                         */
+        p_wr = HTTPsDeflate_BitsWr(p_ctx, p_wr, 0u, DEF_OCTET_NBR_BITS - p_ctx->BitCnt);
+    }
+
+    p_wr = HTTPsDeflate_BitsWr(p_ctx, p_wr, HTTPs_DEFLATE_BLK_STORED_LEN_EMPTY & 0xFFFFu, 16u);
+    p_wr = HTTPsDeflate_BitsWr(p_ctx, p_wr, HTTPs_DEFLATE_BLK_STORED_LEN_EMPTY >> 16u,    16u);
+
+    return (p_wr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         HTTPsDeflate_SymWr()
+*
+* Description : Write a literal/length symbol with its fixed Huffman code.
+*
+* Argument(s) : p_ctx       Pointer to the deflate context.
+*
+*               p_out       Pointer to where to write.
+*
+*               sym         Symbol to write (0 to 287).
+*
+* Return(s)   : Pointer to the end of the data written.
+*
+* Caller(s)   : HTTPsDeflate_Wr(),
+*               HTTPsDeflate_Finish(),
+*               HTTPsDeflate_MatchWr().
+*
+* Note(s)     : (1) RFC #1951, Section 3.2.6 defines the fixed Huffman codes:
+*
+*                       Lit Value    Bits        Codes
+*                       ---------    ----        -----
+*                         0 - 143     8          00110000 through 10111111
+*                       144 - 255     9         110010000 through 111111111
+*                       256 - 279     7           0000000 through 0010111
+*                       280 - 287     8          11000000 through 11000111
+*
+*               (2) Huffman codes are packed starting with their most significant bit, i.e. bit reversed
+*                   compared to the other fields of the stream.
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U  *HTTPsDeflate_SymWr (HTTPs_DEFLATE_CTX  *p_ctx,
+                                         CPU_INT08U         *p_out,
+                                         CPU_INT16U          sym)
+{
+    CPU_INT32U  code;
+    CPU_INT08U  code_len;
+
+                                                                /* Get the bit reversed code (see Notes #1 & #2).       */
+    if (sym < 144u) {
+        code     =  HTTPs_DEFLATE_BIT_REV8(0x30u + sym);
+        code_len =  8u;
+    } else if (sym < 256u) {
+        code     = (HTTPs_DEFLATE_BIT_REV8(0x90u + (sym - 144u)) << 1u) | 1u;
+        code_len =  9u;
+    } else if (sym < 280u) {
+        code     =  HTTPs_DEFLATE_BIT_REV8(sym - 256u) >> 1u;
+        code_len =  7u;
+    } else {
+        code     =  HTTPs_DEFLATE_BIT_REV8(0xC0u + (sym - 280u));
+        code_len =  8u;
+    }
+
+    return (HTTPsDeflate_BitsWr(p_ctx, p_out, code, code_len));
+}
+
+
+/*
+*********************************************************************************************************
+*                                        HTTPsDeflate_MatchWr()
+*
+* Description : Write a match as a length code & a distance code followed by their extra bits.
+*
+* Argument(s) : p_ctx       Pointer to the deflate context.
+*
+*               p_out       Pointer to where to write.
+*
+*               len         Length of the match (3 to 258).
+*
+*               dist        Distance of the match (1 to 32768).
+*
+* Return(s)   : Pointer to the end of the data written.
+*
+* Caller(s)   : HTTPsDeflate_Wr().
+*
+* Note(s)     : (1) Distance codes are 5-bit fixed codes, also packed starting with their most significant
+*                   bit.
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U  *HTTPsDeflate_MatchWr (HTTPs_DEFLATE_CTX  *p_ctx,
+                                           CPU_INT08U         *p_out,
+                                           CPU_INT16U          len,
+                                           CPU_INT16U          dist)
+{
+    CPU_INT08U  *p_wr;
+    CPU_INT16U   code;
+
+                                                                /* -------------------- WR LEN ------------------------ */
+    code = 0u;
+    while ((code + 1u                          <  HTTPs_DEFLATE_LEN_CODE_NBR) &&
+           (HTTPsDeflate_LenBaseTbl[code + 1u] <= len)) {
+        code++;
+    }
+    p_wr = HTTPsDeflate_SymWr(p_ctx, p_out, HTTPs_DEFLATE_SYM_LEN_BASE + code);
+    p_wr = HTTPsDeflate_BitsWr(p_ctx,
+                               p_wr,
+                               len - HTTPsDeflate_LenBaseTbl[code],
+                               HTTPsDeflate_LenExtraTbl[code]);
+
+                                                                /* -------------------- WR DIST ----------------------- */
+    code = 0u;
+    while ((code + 1u                           <  HTTPs_DEFLATE_DIST_CODE_NBR) &&
+           (HTTPsDeflate_DistBaseTbl[code + 1u] <= dist)) {
+        code++;
+    }                                                           /* See Note #1.                                         */
+    p_wr = HTTPsDeflate_BitsWr(p_ctx,
+                               p_wr,
+                               HTTPs_DEFLATE_BIT_REV8(code) >> (DEF_OCTET_NBR_BITS - HTTPs_DEFLATE_DIST_CODE_LEN),
+                               HTTPs_DEFLATE_DIST_CODE_LEN);
+    p_wr = HTTPsDeflate_BitsWr(p_ctx,
+                               p_wr,
+                               dist - HTTPsDeflate_DistBaseTbl[code],
+                               HTTPsDeflate_DistExtraTbl[code]);
+
+    return (p_wr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         HTTPsDeflate_BitsWr()
+*
+* Description : Append bits to the stream, least significant bit first, & write the complete octets.
+*
+* Argument(s) : p_ctx       Pointer to the deflate context.
+*
+*               p_out       Pointer to where to write.
+*
+*               bits        Bits to append.
+*
+*               nbr_bits    Number of bits to append (16 max).
+*
+* Return(s)   : Pointer to the end of the data written.
+*
+* Caller(s)   : various.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U  *HTTPsDeflate_BitsWr (HTTPs_DEFLATE_CTX  *p_ctx,
+                                          CPU_INT08U         *p_out,
+                                          CPU_INT32U          bits,
+                                          CPU_INT08U          nbr_bits)
+{
+    p_ctx->BitBuf |= bits << p_ctx->BitCnt;
+    p_ctx->BitCnt += nbr_bits;
+
+    while (p_ctx->BitCnt >= DEF_OCTET_NBR_BITS) {
+       *p_out++        = (CPU_INT08U)p_ctx->BitBuf;
+        p_ctx->BitBuf >>= DEF_OCTET_NBR_BITS;
+        p_ctx->BitCnt  -= DEF_OCTET_NBR_BITS;
+    }
+
+    return (p_out);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      HTTPsDeflate_MatchLenGet()
+*
+* Description : Get the length of the string matching the data at a given distance.
+*
+* Argument(s) : p_ctx       Pointer to the deflate context.
+*
+*               p_data      Pointer to the data to match.
+*
+*               len_max     Maximum length of the match.
+*
+*               dist        Distance of the candidate string.
+*
+* Return(s)   : Length of the match.
+*
+* Caller(s)   : HTTPsDeflate_Wr().
+*
+* Note(s)     : (1) See HTTPsDeflate_Wr() Note #2.
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U  HTTPsDeflate_MatchLenGet (       HTTPs_DEFLATE_CTX  *p_ctx,
+                                              const  CPU_INT08U         *p_data,
+                                                     CPU_SIZE_T          len_max,
+                                                     CPU_INT16U          dist)
+{
+    CPU_INT32U  pos;
+    CPU_INT16U  len;
+    CPU_INT08U  octet;
+
+
+    pos = p_ctx->Pos - dist;
+    len = 0u;
+    while (len < len_max) {
+        if (len < dist) {                                       /* Octet in the win (see Note #1).                      */
+            octet = p_ctx->WinPtr[(pos + len) & p_ctx->WinMask];
+        } else {                                                /* Octet in the data.                                   */
+            octet = p_data[len - dist];
+        }
+
+        if (octet != p_data[len]) {
+            break;
+        }
+        len++;
+    }
+
+    return (len);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                         MODULE END
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#endif  /* HTTPs_CFG_DEFLATE_EN */
@@ -0,0 +1,111 @@
+/*
+*********************************************************************************************************
+*                                               uC/HTTP
+*                                     Hypertext Transfer Protocol
+*
+*                    Copyright 2004-2021 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                  HTTP SERVER STREAMING DEFLATE MODULE
+*
+* Filename : http-s_deflate.h
+* Version  : V3.01.01
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                               MODULE
+*
+* Note(s) : (1) This main network protocol suite header file is protected from multiple pre-processor
+*               inclusion through use of the HTTPs module present pre-processor macro definition.
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#ifndef  HTTPs_DEFLATE_MODULE_PRESENT                           /* See Note #1.                                         */
+#define  HTTPs_DEFLATE_MODULE_PRESENT
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                         INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#include  <cpu.h>
+#include  <cpu_core.h>
+
+#include  "http-s.h"
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                               DEFINES
+*
+* Note(s) : (1) Literals are coded on at most 9 bits & matches on less than 9 bits per octet. The overhead
+*               covers the gzip header & trailer, the block headers, the end of block codes & the empty
+*               stored block ending each chunk.
+*
+*           (2) The chunk overhead covers the chunk size (4 hex digits max), the two CRLF of the chunk &
+*               the last chunk ("0" CRLF CRLF).
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  HTTPs_DEFLATE_WIN_LEN_MIN                       256u
+#define  HTTPs_DEFLATE_WIN_LEN_MAX                     32768u
+#define  HTTPs_DEFLATE_HASH_TBL_LEN_MIN                  256u
+#define  HTTPs_DEFLATE_HASH_TBL_LEN_MAX                32768u
+
+#define  HTTPs_DEFLATE_OUT_OVERHEAD_LEN                   24u   /* See Note #1.                                         */
+#define  HTTPs_DEFLATE_OUT_LEN_MAX(data_len)         ((((data_len) * 9u) / 8u) + HTTPs_DEFLATE_OUT_OVERHEAD_LEN)
+
+#define  HTTPs_DEFLATE_CHUNK_OVERHEAD_LEN                 13u   /* See Note #2.                                         */
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#if (HTTPs_CFG_DEFLATE_EN == DEF_ENABLED)
+void         HTTPsDeflate_Start   (       HTTPs_DEFLATE_CTX  *p_ctx);
+
+CPU_SIZE_T   HTTPsDeflate_Wr      (       HTTPs_DEFLATE_CTX  *p_ctx,
+                                   const  CPU_INT08U         *p_data,
+                                          CPU_SIZE_T          data_len,
+                                          CPU_INT08U         *p_out);
+
+CPU_SIZE_T   HTTPsDeflate_Finish  (       HTTPs_DEFLATE_CTX  *p_ctx,
+                                          CPU_INT08U         *p_out);
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                             MODULE END
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#endif  /* HTTPs_DEFLATE_MODULE_PRESENT  */
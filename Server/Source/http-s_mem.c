@@ -36,6 +36,8 @@
 #define    HTTPs_MEM_MODULE
 #include  "http-s.h"
 #include  "http-s_mem.h"
+#include  "http-s_sock.h"
+#include  "http-s_deflate.h"
 
 
 /*
@@ -48,6 +50,22 @@
 
 #define  HTTPs_CFG_POOLS_INIT_NBR       1
 
+#define  HTTPs_MEM_CACHE_LINE_LEN      32u
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL MACRO'S
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+                                                                /* Round len up to the pools blk alignment.             */
+#define  HTTPs_MEM_ALIGN_LEN(len)                 (((len) + sizeof(CPU_SIZE_T)       - 1u) & ~(sizeof(CPU_SIZE_T)       - 1u))
+
+                                                                /* Round len up to a cache line.                        */
+#define  HTTPs_MEM_CACHE_LINE_ALIGN_LEN(len)      (((len) + HTTPs_MEM_CACHE_LINE_LEN - 1u) & ~(HTTPs_MEM_CACHE_LINE_LEN - 1u))
+
 
 /*
 *********************************************************************************************************
@@ -84,6 +102,27 @@ static  void  HTTPsMem_RespHdrPoolInit (HTTPs_INSTANCE  *p_instance,
                                         HTTPs_ERR       *p_err);
 #endif
 
+static  CPU_SIZE_T   HTTPsMem_TxnArenaLenGet  (HTTPs_INSTANCE  *p_instance);
+
+static  void        *HTTPsMem_TxnBlkGet       (HTTPs_INSTANCE  *p_instance,
+                                               HTTPs_CONN      *p_conn,
+                                               MEM_DYN_POOL    *p_pool,
+                                               CPU_SIZE_T       len,
+                                               LIB_ERR         *p_err);
+
+static  void         HTTPsMem_TxnBlkFree      (HTTPs_CONN      *p_conn,
+                                               MEM_DYN_POOL    *p_pool,
+                                               void            *p_blk,
+                                               CPU_SIZE_T       len,
+                                               LIB_ERR         *p_err);
+
+static  void         HTTPsMem_TxnArenaReset   (HTTPs_INSTANCE  *p_instance,
+                                               HTTPs_CONN      *p_conn);
+
+#if (HTTPs_CFG_DEFLATE_EN == DEF_ENABLED)
+static  CPU_SIZE_T   HTTPsMem_DeflateBlkLenGet(HTTPs_INSTANCE  *p_instance);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -432,6 +471,167 @@ void  HTTPsMem_InstanceRelease (HTTPs_INSTANCE  *p_instance)
 }
 
 
+/*
+*********************************************************************************************************
+*                                       HTTPsMem_SockEvtDataGet()
+*
+* Description : Allocate the data block required by the instance socket event backend.
+*
+* Argument(s) : size    Size of the backend data block, in octets.
+*
+*               p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                           HTTPs_ERR_NONE
+*                           HTTPs_ERR_INIT_POOL_MEM_NO_SPACE
+*
+* Return(s)   : Pointer to the backend data block, if NO error(s).
+*
+*               NULL pointer,                      otherwise.
+*
+* Caller(s)   : Socket event backend 'Init()' function.
+*
+*               This function is an INTERNAL HTTP server function & MUST NOT be called by application
+*               function(s).
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  *HTTPsMem_SockEvtDataGet (CPU_SIZE_T   size,
+                                HTTPs_ERR   *p_err)
+{
+#if (HTTPs_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    CPU_SIZE_T   octets_rem;
+#endif
+    void        *p_data;
+    LIB_ERR      err_lib;
+
+
+    p_data = DEF_NULL;
+
+#if (HTTPs_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* -------------- VALIDATE REM MEM AVAIL -------------- */
+    octets_rem = Mem_SegRemSizeGet(HTTPs_MemSegPtr,
+                                   sizeof(CPU_ALIGN),
+                                   DEF_NULL,
+                                  &err_lib);
+    if (octets_rem < size) {
+       *p_err = HTTPs_ERR_INIT_POOL_MEM_NO_SPACE;
+        goto exit;
+    }
+#endif
+
+                                                                /* -------------- ACQUIRE BACKEND DATA ---------------- */
+    p_data = Mem_SegAlloc("HTTPs Sock Evt Data",
+                           HTTPs_MemSegPtr,
+                           size,
+                          &err_lib);
+    if (p_data == DEF_NULL) {
+       *p_err = HTTPs_ERR_INIT_POOL_MEM_NO_SPACE;
+        goto exit;
+    }
+
+   *p_err = HTTPs_ERR_NONE;
+
+
+exit:
+    return (p_data);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         HTTPsMem_WorkerInit()
+*
+* Description : (1) Allocate the worker data of an HTTP server instance :
+*
+*                   (a) Validate remaining memory available
+*                   (b) Acquire worker table      of the primary instance
+*                   (c) Acquire connection handoff queue of a worker instance
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceInit().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               HTTPs_ERR_NONE                      Worker data successfully allocated.
+*                               HTTPs_ERR_INIT_POOL_MEM_NO_SPACE    Not enough remaining memory.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPs_InstanceInit().
+*
+*               This function is an INTERNAL HTTP server function & MUST NOT be called by application
+*               function(s).
+*
+* Note(s)     : (2) The primary instance (the one returned to the application) accepts the connections
+*                   itself and therefore only requires the worker table. The other workers receive their
+*                   connections through the handoff queue, which can hold as many sockets as the worker
+*                   can have connections.
+*********************************************************************************************************
+*/
+
+void  HTTPsMem_WorkerInit (HTTPs_INSTANCE  *p_instance,
+                           HTTPs_ERR       *p_err)
+{
+#if (HTTPs_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    CPU_SIZE_T   octets_rem;
+#endif
+    CPU_SIZE_T   octets_reqd;
+    LIB_ERR      err_lib;
+
+
+    if (p_instance->WorkerParentPtr == DEF_NULL) {              /* See Note #2.                                         */
+        octets_reqd = p_instance->WorkerNbr * sizeof(HTTPs_INSTANCE *);
+    } else {
+        octets_reqd = p_instance->ConnNbrMax * sizeof(HTTPs_WORKER_HANDOFF);
+    }
+
+#if (HTTPs_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* -------------- VALIDATE REM MEM AVAIL -------------- */
+    octets_rem = Mem_SegRemSizeGet(HTTPs_MemSegPtr,
+                                   sizeof(CPU_ALIGN),
+                                   DEF_NULL,
+                                  &err_lib);
+    if (octets_rem < octets_reqd) {
+       *p_err = HTTPs_ERR_INIT_POOL_MEM_NO_SPACE;
+        return;
+    }
+#endif
+
+    if (p_instance->WorkerParentPtr == DEF_NULL) {
+                                                                /* --------------- ACQUIRE WORKER TBL ----------------- */
+        p_instance->WorkerTbl = (HTTPs_INSTANCE **)Mem_SegAlloc("HTTPs Worker Tbl",
+                                                                 HTTPs_MemSegPtr,
+                                                                 octets_reqd,
+                                                                &err_lib);
+        if (p_instance->WorkerTbl == DEF_NULL) {
+           *p_err = HTTPs_ERR_INIT_POOL_MEM_NO_SPACE;
+            return;
+        }
+
+        p_instance->WorkerTbl[0] = p_instance;
+
+    } else {
+                                                                /* ------------- ACQUIRE CONN HANDOFF Q --------------- */
+        p_instance->WorkerQ = (HTTPs_WORKER_HANDOFF *)Mem_SegAlloc("HTTPs Worker Q",
+                                                                    HTTPs_MemSegPtr,
+                                                                    octets_reqd,
+                                                                   &err_lib);
+        if (p_instance->WorkerQ == DEF_NULL) {
+           *p_err = HTTPs_ERR_INIT_POOL_MEM_NO_SPACE;
+            return;
+        }
+    }
+
+    p_instance->WorkerQ_IxIn  = 0u;
+    p_instance->WorkerQ_IxOut = 0u;
+    p_instance->WorkerQ_Ctr   = 0u;
+
+   *p_err = HTTPs_ERR_NONE;
+}
+
+
 /*
 *********************************************************************************************************
 *                                       HTTPsMem_ConnPoolInit()
@@ -463,6 +663,29 @@ void  HTTPsMem_InstanceRelease (HTTPs_INSTANCE  *p_instance)
 * Note(s)     : (2) Validate that the remaining memory available on the heap before creating the connection &
 *                   buffer pools is required to avoid wasting heap in the case there is enough memory to create
 *                   the connection pool but not enough to create the buffer pool.
+*
+*               (3) Each query string & form key-value pool block holds the HTTPs_KEY_VAL structure
+*                   immediately followed by its key & value string buffers so that a single pool operation
+*                   acquires or releases a complete key-value pair.
+*
+*               (4) When every transaction object (headers, tokens, query string & form key-value pairs) has
+*                   a maximum number per connection, each connection buffer is followed by a transaction
+*                   arena that serves all these objects. The objects pools are then not created. Otherwise,
+*                   the arena cannot be sized & the objects are acquired from their pools.
+*
+*               (5) Each connection is allocated as a single cache line aligned slab :
+*
+*                       +------------+-----+-----------+------+------+---------------+
+*                       | HTTPs_CONN | Buf | Txn arena | Path | Host | Form boundary |
+*                       +------------+-----+-----------+------+------+---------------+
+*
+*                   (a) The connection structure is padded to a cache line so that the buffer starts on its
+*                       own cache line.
+*
+*                   (b) The slab is carved in the same order by HTTPsMem_ConnGet().
+*
+*               (6) A deflate block compresses the chunks of one response at a time. Its output buffer is
+*                   sized for the largest chunk : a connection buffer of file data followed by a token value.
 *********************************************************************************************************
 */
 
@@ -474,10 +697,14 @@ void  HTTPsMem_ConnPoolInit (HTTPs_INSTANCE  *p_instance,
 #endif
 #if (HTTPs_CFG_TOKEN_PARSE_EN == DEF_ENABLED)
            CPU_INT16U   val_len;
+#endif
+#if (HTTPs_CFG_DEFLATE_EN == DEF_ENABLED)
+           CPU_SIZE_T   data_len_max;
 #endif
     const  HTTPs_CFG   *p_cfg;
            CPU_SIZE_T   octets_reqd;
            CPU_SIZE_T   pool_size_max;
+           CPU_SIZE_T   slab_len;
            CPU_INT32U   path_len_max;
            LIB_ERR      err_lib;
 
@@ -505,17 +732,43 @@ void  HTTPsMem_ConnPoolInit (HTTPs_INSTANCE  *p_instance,
     }
 
 
-#if (HTTPs_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
-                                                                /* -------------- VALIDATE REM MEM AVAIL -------------- */
-    octets_reqd = (HTTPs_CFG_POOLS_INIT_NBR * sizeof(HTTPs_CONN))
-                + (HTTPs_CFG_POOLS_INIT_NBR * p_cfg->BufLen)
-                + (HTTPs_CFG_POOLS_INIT_NBR * path_len_max);
+                                                                /* ----------------- SIZE CONN SLAB ------------------- */
+    p_instance->TxnArenaLen = HTTPsMem_TxnArenaLenGet(p_instance);
 
+    slab_len = HTTPs_MEM_CACHE_LINE_ALIGN_LEN(sizeof(HTTPs_CONN))
+             + HTTPs_MEM_ALIGN_LEN(p_cfg->BufLen)               /* Txn arena follows the buf (see Note #4).             */
+             + p_instance->TxnArenaLen
+             + HTTPs_MEM_ALIGN_LEN(path_len_max);
 
 #if (HTTPs_CFG_ABSOLUTE_URI_EN == DEF_ENABLED)
-    octets_reqd += (HTTPs_CFG_POOLS_INIT_NBR * p_cfg->HostNameLenMax);
+    slab_len += HTTPs_MEM_ALIGN_LEN(p_cfg->HostNameLenMax);
+#endif
+
+#if (HTTPs_CFG_DEFLATE_EN == DEF_ENABLED)
+    if (p_cfg->DeflateCfgPtr != DEF_NULL) {                     /* Size deflate output buf (see Note #6).               */
+        data_len_max = p_cfg->BufLen;
+#if (HTTPs_CFG_TOKEN_PARSE_EN == DEF_ENABLED)
+        if (p_cfg->TokenCfgPtr != DEF_NULL) {
+            data_len_max += p_cfg->TokenCfgPtr->ValLenMax;
+        }
+#endif
+        p_instance->DeflateOutLenMax = (CPU_INT16U)HTTPs_DEFLATE_OUT_LEN_MAX(data_len_max);
+    }
+#endif
+
+#if ((HTTPs_CFG_FORM_EN           == DEF_ENABLED) && \
+     (HTTPs_CFG_FORM_MULTIPART_EN == DEF_ENABLED))
+    if (p_cfg->FormCfgPtr != DEF_NULL) {
+        if (p_cfg->FormCfgPtr->MultipartEn == DEF_ENABLED) {
+            slab_len += HTTPs_FORM_BOUNDARY_BLK_LEN;
+        }
+    }
 #endif
 
+#if (HTTPs_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+                                                                /* -------------- VALIDATE REM MEM AVAIL -------------- */
+    octets_reqd = (HTTPs_CFG_POOLS_INIT_NBR * slab_len);
+
 
 #if (HTTPs_CFG_TOKEN_PARSE_EN == DEF_ENABLED)
     if (p_cfg->TokenCfgPtr != DEF_NULL) {                       /* If token parse is enabled, add space for token.      */
@@ -541,12 +794,12 @@ void  HTTPsMem_ConnPoolInit (HTTPs_INSTANCE  *p_instance,
         octets_reqd += ((HTTPs_CFG_POOLS_INIT_NBR * sizeof(HTTPs_KEY_VAL))
                     +   (HTTPs_CFG_POOLS_INIT_NBR * p_cfg->FormCfgPtr->KeyLenMax)
                     +   (HTTPs_CFG_POOLS_INIT_NBR * p_cfg->FormCfgPtr->ValLenMax));
-
-#if (HTTPs_CFG_FORM_MULTIPART_EN == DEF_ENABLED)
-        if (p_cfg->FormCfgPtr->MultipartEn == DEF_ENABLED) {    /* If multipart is enabled, add boundary space.         */
-            octets_reqd += (HTTPs_CFG_POOLS_INIT_NBR * HTTPs_FORM_BOUNDARY_STR_LEN_MAX);
-        }
+    }
 #endif
+
+#if (HTTPs_CFG_DEFLATE_EN == DEF_ENABLED)
+    if (p_cfg->DeflateCfgPtr != DEF_NULL) {                     /* If deflate is enabled, add space for deflate blk.    */
+        octets_reqd += (HTTPs_CFG_POOLS_INIT_NBR * HTTPsMem_DeflateBlkLenGet(p_instance));
     }
 #endif
 
@@ -563,13 +816,13 @@ void  HTTPsMem_ConnPoolInit (HTTPs_INSTANCE  *p_instance,
 #endif
 
                                                                 /* ----------------- CREATE CONN POOL ----------------- */
-    Mem_DynPoolCreate("HTTPs Conn Pool",
+    Mem_DynPoolCreate("HTTPs Conn Pool",                        /* Conn & its bufs share one slab (see Note #5).        */
                       &p_instance->PoolConn,
                        HTTPs_MemSegPtr,
-                       sizeof(HTTPs_CONN),
-                       sizeof(CPU_SIZE_T),
+                       slab_len,
+                       HTTPs_MEM_CACHE_LINE_LEN,
                        HTTPs_CFG_POOLS_INIT_NBR,
-                       p_cfg->ConnNbrMax,
+                       p_instance->ConnNbrMax,
                       &err_lib);
     switch (err_lib) {
         case LIB_MEM_ERR_NONE:
@@ -584,79 +837,12 @@ void  HTTPsMem_ConnPoolInit (HTTPs_INSTANCE  *p_instance,
              return;
     }
 
-                                                                /* ----------------- CREATE BUF POOL ------------------ */
-    Mem_DynPoolCreate("HTTPs Conn Buffer Pool",
-                      &p_instance->PoolBuf,
-                       HTTPs_MemSegPtr,
-                       p_cfg->BufLen,
-                       sizeof(CPU_SIZE_T),
-                       HTTPs_CFG_POOLS_INIT_NBR,
-                       p_cfg->ConnNbrMax,
-                      &err_lib);
-    switch (err_lib) {
-        case LIB_MEM_ERR_NONE:
-             break;
-
-        case LIB_MEM_ERR_SEG_OVF:
-            *p_err = HTTPs_ERR_INIT_POOL_MEM_NO_SPACE;
-             return;
-
-        default:
-            *p_err = HTTPs_ERR_INIT_POOL_BUF;
-             return;
-    }
-
-                                                                /* --------------- CREATE PATH POOL --------------- */
-    Mem_DynPoolCreate("HTTPs Conn Path Pool",
-                      &p_instance->PoolPath,
-                       HTTPs_MemSegPtr,
-                       path_len_max,
-                       sizeof(CPU_SIZE_T),
-                       HTTPs_CFG_POOLS_INIT_NBR,
-                       p_cfg->ConnNbrMax,
-                      &err_lib);
-    switch (err_lib) {
-        case LIB_MEM_ERR_NONE:
-             break;
-
-        case LIB_MEM_ERR_SEG_OVF:
-            *p_err = HTTPs_ERR_INIT_POOL_MEM_NO_SPACE;
-             return;
-
-        default:
-            *p_err = HTTPs_ERR_INIT_POOL_PATH;
-             return;
-    }
-
-#if (HTTPs_CFG_ABSOLUTE_URI_EN == DEF_ENABLED)
-                                                                /* ----------------- CREATE HOST POOL ----------------- */
-    Mem_DynPoolCreate("HTTPs Conn Host Pool",
-                      &p_instance->PoolHost,
-                       HTTPs_MemSegPtr,
-                       p_cfg->HostNameLenMax,
-                       sizeof(CPU_SIZE_T),
-                       HTTPs_CFG_POOLS_INIT_NBR,
-                       p_cfg->ConnNbrMax,
-                      &err_lib);
-    switch (err_lib) {
-        case LIB_MEM_ERR_NONE:
-             break;
-
-        case LIB_MEM_ERR_SEG_OVF:
-            *p_err = HTTPs_ERR_INIT_POOL_MEM_NO_SPACE;
-             return;
-
-        default:
-            *p_err = HTTPs_ERR_INIT_POOL_HOST;
-             return;
-    }
-#endif
-
 #if (HTTPs_CFG_TOKEN_PARSE_EN == DEF_ENABLED)
-    if (p_cfg->TokenCfgPtr != DEF_NULL) {
+    if ((p_cfg->TokenCfgPtr     != DEF_NULL) &&
+        (p_instance->TxnArenaLen == 0u     )) {
 
         if (p_cfg->TokenCfgPtr->NbrPerConnMax != LIB_MEM_BLK_QTY_UNLIMITED) {
-            pool_size_max = p_cfg->ConnNbrMax * p_cfg->TokenCfgPtr->NbrPerConnMax;
+            pool_size_max = p_instance->ConnNbrMax * p_cfg->TokenCfgPtr->NbrPerConnMax;
         } else {
             pool_size_max = LIB_MEM_BLK_QTY_UNLIMITED;
         }
@@ -709,38 +895,16 @@ void  HTTPsMem_ConnPoolInit (HTTPs_INSTANCE  *p_instance,
     }
 #endif
 
-#if ((HTTPs_CFG_FORM_EN      == DEF_ENABLED) || \
-     (HTTPs_CFG_QUERY_STR_EN == DEF_ENABLED))
-
-    pool_size_max = 0;
-
-    if (p_cfg->FormCfgPtr != DEF_NULL) {
-        if (p_cfg->FormCfgPtr->NbrPerConnMax != LIB_MEM_BLK_QTY_UNLIMITED) {
-            pool_size_max = p_cfg->ConnNbrMax * p_cfg->FormCfgPtr->NbrPerConnMax;
-        } else {
-            pool_size_max = LIB_MEM_BLK_QTY_UNLIMITED;
-        }
-    }
-
-    if (p_cfg->QueryStrCfgPtr != DEF_NULL) {
-        if ((p_cfg->QueryStrCfgPtr->NbrPerConnMax != LIB_MEM_BLK_QTY_UNLIMITED) &&
-            (pool_size_max                        != LIB_MEM_BLK_QTY_UNLIMITED)){
-            pool_size_max += p_cfg->ConnNbrMax * p_cfg->QueryStrCfgPtr->NbrPerConnMax;
-        } else {
-            pool_size_max = LIB_MEM_BLK_QTY_UNLIMITED;
-        }
-    }
-
-    if ((p_cfg->FormCfgPtr     != DEF_NULL) ||
-        (p_cfg->QueryStrCfgPtr != DEF_NULL)) {
-                                                                /* ------------- CREATE KEY-VALUE BLK POOL ------------ */
-        Mem_DynPoolCreate("HTTPs Key-Val Blk Pool",
-                          &p_instance->PoolKeyVal,
+#if (HTTPs_CFG_DEFLATE_EN == DEF_ENABLED)
+    if (p_cfg->DeflateCfgPtr != DEF_NULL) {
+                                                                /* --------------- CREATE DEFLATE POOL ---------------- */
+        Mem_DynPoolCreate("HTTPs Deflate Pool",                 /* Ctx & its bufs are stored in the blk.                */
+                          &p_instance->PoolDeflate,
                            HTTPs_MemSegPtr,
-                           sizeof(HTTPs_KEY_VAL),
+                           HTTPsMem_DeflateBlkLenGet(p_instance),
                            sizeof(CPU_SIZE_T),
                            HTTPs_CFG_POOLS_INIT_NBR,
-                           pool_size_max,
+                           p_cfg->DeflateCfgPtr->NbrPerInstanceMax,
                           &err_lib);
         switch (err_lib) {
             case LIB_MEM_ERR_NONE:
@@ -751,47 +915,26 @@ void  HTTPsMem_ConnPoolInit (HTTPs_INSTANCE  *p_instance,
                  return;
 
             default:
-                *p_err = HTTPs_ERR_INIT_POOL_KEY_VAL;
+                *p_err = HTTPs_ERR_INIT_POOL_DEFLATE;
                  return;
         }
     }
 #endif
 
 #if (HTTPs_CFG_QUERY_STR_EN == DEF_ENABLED)
-    if (p_cfg->QueryStrCfgPtr != DEF_NULL) {
+    if ((p_cfg->QueryStrCfgPtr  != DEF_NULL) &&
+        (p_instance->TxnArenaLen == 0u     )) {
 
         if (p_cfg->QueryStrCfgPtr->NbrPerConnMax != LIB_MEM_BLK_QTY_UNLIMITED) {
-            pool_size_max = p_cfg->ConnNbrMax * p_cfg->QueryStrCfgPtr->NbrPerConnMax;
+            pool_size_max = p_instance->ConnNbrMax * p_cfg->QueryStrCfgPtr->NbrPerConnMax;
         } else {
             pool_size_max = LIB_MEM_BLK_QTY_UNLIMITED;
         }
-                                                                /* -------- CREATE QUERY STRING KEY STRING POOL ------- */
-        Mem_DynPoolCreate("HTTPs Query Str Key Pool",
-                          &p_instance->PoolQueryStrKeyStr,
-                           HTTPs_MemSegPtr,
-                           p_cfg->QueryStrCfgPtr->KeyLenMax,
-                           sizeof(CPU_SIZE_T),
-                           HTTPs_CFG_POOLS_INIT_NBR,
-                           pool_size_max,
-                          &err_lib);
-        switch (err_lib) {
-            case LIB_MEM_ERR_NONE:
-                 break;
-
-            case LIB_MEM_ERR_SEG_OVF:
-                *p_err = HTTPs_ERR_INIT_POOL_MEM_NO_SPACE;
-                 return;
-
-            default:
-                *p_err = HTTPs_ERR_INIT_POOL_QUERY_STR_KEY;
-                 return;
-        }
-
-                                                                /* ------- CREATE QUERY STRING VAL STRING POOL -------- */
-        Mem_DynPoolCreate("HTTPs Query String Val Pool",
-                          &p_instance->PoolQueryStrValStr,
+                                                                /* ---------- CREATE QUERY STRING KEY-VAL POOL -------- */
+        Mem_DynPoolCreate("HTTPs Query Str Key-Val Pool",       /* Key & val str are stored in the blk (see Note #3).   */
+                          &p_instance->PoolQueryStrKeyVal,
                            HTTPs_MemSegPtr,
-                           p_cfg->QueryStrCfgPtr->ValLenMax,
+                          (sizeof(HTTPs_KEY_VAL) + p_cfg->QueryStrCfgPtr->KeyLenMax + p_cfg->QueryStrCfgPtr->ValLenMax),
                            sizeof(CPU_SIZE_T),
                            HTTPs_CFG_POOLS_INIT_NBR,
                            pool_size_max,
@@ -805,7 +948,7 @@ void  HTTPsMem_ConnPoolInit (HTTPs_INSTANCE  *p_instance,
                  return;
 
             default:
-                *p_err = HTTPs_ERR_INIT_POOL_QUERY_STR_VAL;
+                *p_err = HTTPs_ERR_INIT_POOL_KEY_VAL;
                  return;
         }
     }
@@ -813,19 +956,19 @@ void  HTTPsMem_ConnPoolInit (HTTPs_INSTANCE  *p_instance,
 
 
 #if (HTTPs_CFG_FORM_EN == DEF_ENABLED)
-    if (p_cfg->FormCfgPtr != DEF_NULL) {
+    if ((p_cfg->FormCfgPtr      != DEF_NULL) &&
+        (p_instance->TxnArenaLen == 0u     )) {
 
         if (p_cfg->FormCfgPtr->NbrPerConnMax != LIB_MEM_BLK_QTY_UNLIMITED) {
-            pool_size_max = p_cfg->ConnNbrMax * p_cfg->FormCfgPtr->NbrPerConnMax;
+            pool_size_max = p_instance->ConnNbrMax * p_cfg->FormCfgPtr->NbrPerConnMax;
         } else {
             pool_size_max = LIB_MEM_BLK_QTY_UNLIMITED;
         }
-
-                                                                /* ------------ CREATE FORM KEY STRING POOL ----------- */
-        Mem_DynPoolCreate("HTTPs Form Key Pool",
-                          &p_instance->PoolFormKeyStr,
+                                                                /* -------------- CREATE FORM KEY-VAL POOL ------------ */
+        Mem_DynPoolCreate("HTTPs Form Key-Val Pool",            /* Key & val str are stored in the blk (see Note #3).   */
+                          &p_instance->PoolFormKeyVal,
                            HTTPs_MemSegPtr,
-                           p_cfg->FormCfgPtr->KeyLenMax,
+                          (sizeof(HTTPs_KEY_VAL) + p_cfg->FormCfgPtr->KeyLenMax + p_cfg->FormCfgPtr->ValLenMax),
                            sizeof(CPU_SIZE_T),
                            HTTPs_CFG_POOLS_INIT_NBR,
                            pool_size_max,
@@ -839,64 +982,16 @@ void  HTTPsMem_ConnPoolInit (HTTPs_INSTANCE  *p_instance,
                  return;
 
             default:
-                *p_err = HTTPs_ERR_INIT_POOL_FORM_KEY;
+                *p_err = HTTPs_ERR_INIT_POOL_KEY_VAL;
                  return;
         }
-
-                                                                /* ----------- CREATE FORM VAL STRING POOL ------------ */
-        Mem_DynPoolCreate("HTTPs Form Val Pool",
-                          &p_instance->PoolFormValStr,
-                           HTTPs_MemSegPtr,
-                           p_cfg->FormCfgPtr->ValLenMax,
-                           sizeof(CPU_SIZE_T),
-                           HTTPs_CFG_POOLS_INIT_NBR,
-                           pool_size_max,
-                          &err_lib);
-        switch (err_lib) {
-            case LIB_MEM_ERR_NONE:
-                 break;
-
-            case LIB_MEM_ERR_SEG_OVF:
-                *p_err = HTTPs_ERR_INIT_POOL_MEM_NO_SPACE;
-                 return;
-
-            default:
-                *p_err = HTTPs_ERR_INIT_POOL_FORM_VAL;
-                 return;
-        }
-
-#if (HTTPs_CFG_FORM_MULTIPART_EN == DEF_ENABLED)
-        if (p_cfg->FormCfgPtr->MultipartEn == DEF_ENABLED) {
-                                                                /* ------------- CREATE FORM BOUNDARY POOL ------------ */
-            Mem_DynPoolCreate("HTTPs Form Boundary Pool",
-                              &p_instance->PoolFormBoundary,
-                               HTTPs_MemSegPtr,
-                               HTTPs_FORM_BOUNDARY_STR_LEN_MAX,
-                               sizeof(CPU_SIZE_T),
-                               HTTPs_CFG_POOLS_INIT_NBR,
-                               p_cfg->ConnNbrMax,
-                              &err_lib);
-            switch (err_lib) {
-                case LIB_MEM_ERR_NONE:
-                     break;
-
-                case LIB_MEM_ERR_SEG_OVF:
-                    *p_err = HTTPs_ERR_INIT_POOL_MEM_NO_SPACE;
-                     return;
-
-                default:
-                    *p_err = HTTPs_ERR_INIT_POOL_FORM_BOUNDARY;
-                     return;
-            }
-        }
-#endif
-
-    }
-#endif
+    }
+#endif
 
 
 #if (HTTPs_CFG_HDR_RX_EN == DEF_ENABLED)
-    if (p_cfg->HdrRxCfgPtr != DEF_NULL) {
+    if ((p_cfg->HdrRxCfgPtr     != DEF_NULL) &&
+        (p_instance->TxnArenaLen == 0u     )) {
                                                                 /* ------------- INIT REQ HDR FIELD POOL -------------- */
         HTTPsMem_ReqHdrPoolInit(p_instance,
                                 p_err);
@@ -907,7 +1002,8 @@ void  HTTPsMem_ConnPoolInit (HTTPs_INSTANCE  *p_instance,
 #endif
 
 #if (HTTPs_CFG_HDR_TX_EN == DEF_ENABLED)
-    if (p_cfg->HdrTxCfgPtr != DEF_NULL) {
+    if ((p_cfg->HdrTxCfgPtr     != DEF_NULL) &&
+        (p_instance->TxnArenaLen == 0u     )) {
                                                                 /* -------------- INIT RESP HDR FIELD POOL ------------ */
         HTTPsMem_RespHdrPoolInit(p_instance,
                                  p_err);
@@ -930,8 +1026,8 @@ void  HTTPsMem_ConnPoolInit (HTTPs_INSTANCE  *p_instance,
 *
 * Description : (1) Acquire a new connection:
 *
-*                   (a) Acquire connection block
-*                   (b) Acquire buffer block
+*                   (a) Acquire connection slab
+*                   (b) Carve   connection buffers from the slab
 *                   (c) Update connections list
 *                   (d) Initialize connection parameters
 *
@@ -951,7 +1047,8 @@ void  HTTPsMem_ConnPoolInit (HTTPs_INSTANCE  *p_instance,
 *               This function is an INTERNAL HTTP server function & MUST NOT be called by application
 *               function(s).
 *
-* Note(s)     : none.
+* Note(s)     : (2) The connection structure & its buffers are acquired in a single pool operation. See
+*                   'HTTPsMem_ConnPoolInit()  Notes #4 & #5' for the slab layout.
 *********************************************************************************************************
 */
 
@@ -962,6 +1059,7 @@ HTTPs_CONN  *HTTPsMem_ConnGet (HTTPs_INSTANCE  *p_instance,
     const  HTTPs_CFG             *p_cfg;
            HTTPs_CONN            *p_conn;
            HTTPs_CONN            *p_conn_item;
+           CPU_INT08U            *p_slab;
            HTTPs_INSTANCE_STATS  *p_ctr_stats;
            HTTPs_INSTANCE_ERRS   *p_ctr_err;
            LIB_ERR                err_lib;
@@ -972,7 +1070,7 @@ HTTPs_CONN  *HTTPsMem_ConnGet (HTTPs_INSTANCE  *p_instance,
 
     p_cfg = p_instance->CfgPtr;
 
-                                                                /* ----------------- ACQUIRE CONN BLK ----------------- */
+                                                                /* ----------------- ACQUIRE CONN SLAB ---------------- */
     p_conn = (HTTPs_CONN *)Mem_DynPoolBlkGet(&p_instance->PoolConn,
                                              &err_lib);
     switch (err_lib) {
@@ -993,93 +1091,53 @@ HTTPs_CONN  *HTTPsMem_ConnGet (HTTPs_INSTANCE  *p_instance,
              goto exit;
     }
 
-                                                                /* ----------------- ACQUIRE BUF BLK ------------------ */
-    p_conn->BufPtr = (CPU_CHAR *)Mem_DynPoolBlkGet(&p_instance->PoolBuf,
-                                                   &err_lib);
-    switch (err_lib) {
-        case LIB_MEM_ERR_NONE:
+                                                                /* ------------------ GET PATH LEN MAX ---------------- */
+    switch (p_cfg->FS_Type) {
+        case HTTPs_FS_TYPE_NONE:
+             p_conn->PathLenMax = ((HTTPs_CFG_FS_NONE *)p_cfg->FS_CfgPtr)->PathLenMax;
              break;
 
-        case LIB_MEM_ERR_SEG_OVF:
-             HTTPs_ERR_INC(p_ctr_err->Conn_ErrBufPoolMemSpaceCtr);
-             goto exit_release_conn;
-
-        case LIB_MEM_ERR_POOL_EMPTY:
-             HTTPs_ERR_INC(p_ctr_err->Conn_ErrBufPoolEmptyCtr);
+        case HTTPs_FS_TYPE_STATIC:
+        case HTTPs_FS_TYPE_DYN:
+#if (HTTPs_CFG_FS_PRESENT_EN == DEF_ENABLED)
+             p_conn->PathLenMax = p_instance->FS_PathLenMax;
+#else
+             HTTPs_ERR_INC(p_ctr_err->FS_ErrNoEnCtr);
              goto exit_release_conn;
+#endif
+             break;
 
         default:
-             HTTPs_ERR_INC(p_ctr_err->Conn_ErrBufPoolLibGetCtr);
+             HTTPs_ERR_INC(p_ctr_err->FS_ErrTypeInvalidCtr);
              goto exit_release_conn;
     }
 
-                                                                /* ----------------- ACQUIRE PATH BLK ----------------- */
-    p_conn->PathPtr = (CPU_CHAR *)Mem_DynPoolBlkGet(&p_instance->PoolPath,
-                                                    &err_lib);
-    switch (err_lib) {
-        case LIB_MEM_ERR_NONE:
-             break;
-
-        case LIB_MEM_ERR_SEG_OVF:
-             HTTPs_ERR_INC(p_ctr_err->Conn_ErrPathPoolMemSpaceCtr);
-             goto exit_release_buf;
+                                                                /* ------------------ CARVE CONN SLAB ----------------- */
+    p_slab = (CPU_INT08U *)p_conn + HTTPs_MEM_CACHE_LINE_ALIGN_LEN(sizeof(HTTPs_CONN));
 
-        case LIB_MEM_ERR_POOL_EMPTY:
-             HTTPs_ERR_INC(p_ctr_err->Conn_ErrPathPoolEmptyCtr);
-             goto exit_release_buf;
+    p_conn->BufPtr = (CPU_CHAR *)p_slab;
+    p_slab        += HTTPs_MEM_ALIGN_LEN(p_cfg->BufLen);
 
-        default:
-             HTTPs_ERR_INC(p_ctr_err->Conn_ErrPathPoolLibGetCtr);
-             goto exit_release_buf;
+    if (p_instance->TxnArenaLen > 0u) {
+        p_conn->TxnArenaPtr = p_slab;
+        p_slab             += p_instance->TxnArenaLen;
     }
 
-#if (HTTPs_CFG_ABSOLUTE_URI_EN == DEF_ENABLED)
-                                                                /* ----------------- ACQUIRE HOST BLK ----------------- */
-    p_conn->HostPtr = (CPU_CHAR *)Mem_DynPoolBlkGet(&p_instance->PoolHost,
-                                                    &err_lib);
-    switch (err_lib) {
-        case LIB_MEM_ERR_NONE:
-             break;
-
-        case LIB_MEM_ERR_SEG_OVF:
-             HTTPs_ERR_INC(p_ctr_err->Host_ErrPoolMemSpaceCtr);
-             goto exit_release_path;
+    p_conn->PathPtr = (CPU_CHAR *)p_slab;
+    p_slab         += HTTPs_MEM_ALIGN_LEN(p_conn->PathLenMax);
 
-        case LIB_MEM_ERR_POOL_EMPTY:
-             HTTPs_ERR_INC(p_ctr_err->Host_ErrPoolEmptyCtr);
-             goto exit_release_path;
-
-        default:
-             HTTPs_ERR_INC(p_ctr_err->Host_ErrPoolLibGetCtr);
-             goto exit_release_path;
-    }
+#if (HTTPs_CFG_ABSOLUTE_URI_EN == DEF_ENABLED)
+    p_conn->HostPtr = (CPU_CHAR *)p_slab;
+    p_slab         += HTTPs_MEM_ALIGN_LEN(p_cfg->HostNameLenMax);
 #endif
 
-
 #if ((HTTPs_CFG_FORM_EN           == DEF_ENABLED) && \
      (HTTPs_CFG_FORM_MULTIPART_EN == DEF_ENABLED))
     if (p_cfg->FormCfgPtr != DEF_NULL) {
-
         if (p_cfg->FormCfgPtr->MultipartEn == DEF_ENABLED) {
-                                                                /* ------------- ACQUIRE FORM BOUNDARY BLK ------------ */
-            p_conn->FormBoundaryPtr = (CPU_CHAR *)Mem_DynPoolBlkGet(&p_instance->PoolFormBoundary,
-                                                                    &err_lib);
-            switch (err_lib) {
-                case LIB_MEM_ERR_NONE:
-                     break;
-
-                case LIB_MEM_ERR_SEG_OVF:
-                    HTTPs_ERR_INC(p_ctr_err->Req_ErrFormBoundaryPoolMemSpaceCtr);
-                     goto exit_release_host;
-
-                case LIB_MEM_ERR_POOL_EMPTY:
-                     HTTPs_ERR_INC(p_ctr_err->Req_ErrFormBoundaryPoolEmptyCtr);
-                     goto exit_release_host;
-
-                default:
-                     HTTPs_ERR_INC(p_ctr_err->Req_ErrFormBoundaryPoolLibGetCtr);
-                     goto exit_release_host;
-            }
+            p_conn->FormBoundaryPtr        = (CPU_CHAR *)p_slab;
+                                                                /* Skip tbl is located after the boundary str.          */
+            p_conn->FormBoundarySkipTblPtr =  p_slab + HTTPs_FORM_BOUNDARY_STR_LEN_MAX;
         }
     }
 #endif
@@ -1123,38 +1181,28 @@ HTTPs_CONN  *HTTPsMem_ConnGet (HTTPs_INSTANCE  *p_instance,
     p_conn->DataTxdLen         =  0u;
     p_conn->DataFixPosCur      =  0u;
 
-    switch (p_cfg->FS_Type) {
-        case HTTPs_FS_TYPE_NONE:
-             p_conn->PathLenMax = ((HTTPs_CFG_FS_NONE *)p_cfg->FS_CfgPtr)->PathLenMax;
-             break;
-
-        case HTTPs_FS_TYPE_STATIC:
-        case HTTPs_FS_TYPE_DYN:
-#if (HTTPs_CFG_FS_PRESENT_EN == DEF_ENABLED)
-             p_conn->PathLenMax = p_instance->FS_PathLenMax;
-#else
-             HTTPs_ERR_INC(p_ctr_err->FS_ErrNoEnCtr);
-             goto exit_release_host;
-#endif
-             break;
-
-        default:
-             HTTPs_ERR_INC(p_ctr_err->FS_ErrTypeInvalidCtr);
-             goto exit_release_host;
-    }
-
     p_conn->StatusCode         =  HTTP_STATUS_OK;
     p_conn->RespBodyDataType   =  HTTPs_BODY_DATA_TYPE_NONE;
     p_conn->RespContentType    =  HTTP_CONTENT_TYPE_UNKNOWN;
+#if (HTTPs_CFG_CONTENT_CODING_EN == DEF_ENABLED)
+    p_conn->ContentCodingFlags =  HTTPs_FLAG_NONE;
+#endif
+#if (HTTPs_CFG_COND_REQ_EN == DEF_ENABLED)
+    p_conn->CondFlags          =  HTTPs_FLAG_NONE;
+    p_conn->CondReqTagNbr      =  0u;
+#endif
 
     p_conn->BufLen             =  p_cfg->BufLen;
     p_conn->RxBufPtr           =  p_conn->BufPtr;
     p_conn->TxBufPtr           =  p_conn->BufPtr;
 
     p_conn->RxBufLenRem        =  0u;
+    p_conn->RxBufScanLen       =  0u;
     p_conn->RxDataLen          =  0u;
     p_conn->TxDataLen          =  0u;
 
+    p_conn->TxnArenaLenUsed    =  0u;
+
     p_conn->ConnDataPtr        =  DEF_NULL;
 
     p_conn->ConnNextPtr        =  DEF_NULL;
@@ -1165,28 +1213,8 @@ HTTPs_CONN  *HTTPsMem_ConnGet (HTTPs_INSTANCE  *p_instance,
 
     goto exit;
 
-exit_release_host:
-#if (HTTPs_CFG_ABSOLUTE_URI_EN == DEF_ENABLED)
-    Mem_DynPoolBlkFree(&p_instance->PoolHost,                   /* Release host previously acquired.                    */
-                        p_conn->HostPtr,
-                       &err_lib);
-    p_conn->HostPtr = DEF_NULL;
-
-exit_release_path:
-#endif
-    Mem_DynPoolBlkFree(&p_instance->PoolPath,                   /* Release path previously acquired.                    */
-                        p_conn->PathPtr,
-                       &err_lib);
-    p_conn->PathPtr = DEF_NULL;
-
-exit_release_buf:
-    Mem_DynPoolBlkFree(&p_instance->PoolBuf,                    /* Release buf previously acquired.                     */
-                        p_conn->BufPtr,
-                       &err_lib);
-    p_conn->BufPtr = DEF_NULL;
-
 exit_release_conn:
-    Mem_DynPoolBlkFree(&p_instance->PoolConn,                   /* Release conn previously acquired.                    */
+    Mem_DynPoolBlkFree(&p_instance->PoolConn,                   /* Release conn slab previously acquired.               */
                         p_conn,
                        &err_lib);
     p_conn = DEF_NULL;
@@ -1202,9 +1230,9 @@ exit:
 *
 * Description : (1) Release connection:
 *
-*                   (a) Update instance connection list
-*                   (b) Release buffer     block
-*                   (c) Release connection block
+*                   (a) Remove connection socket events
+*                   (b) Update instance connection list
+*                   (c) Release connection slab (including its buffers)
 *
 * Argument(s) : p_instance  Pointer to the instance structure variable.
 *               ----------  Argument validated in HTTPs_InstanceStart().
@@ -1232,18 +1260,14 @@ void  HTTPsMem_ConnRelease (HTTPs_INSTANCE  *p_instance,
            HTTPs_INSTANCE_STATS  *p_ctr_stats;
            HTTPs_INSTANCE_ERRS   *p_ctr_err;
            LIB_ERR                err_lib;
-#if ((HTTPs_CFG_FORM_EN           == DEF_ENABLED) && \
-     (HTTPs_CFG_FORM_MULTIPART_EN == DEF_ENABLED))
-    const  HTTPs_CFG             *p_cfg;
-
-
-    p_cfg = p_instance->CfgPtr;
-#endif
 
 
     HTTPs_SET_PTR_STATS(p_ctr_stats, p_instance);
     HTTPs_SET_PTR_ERRS( p_ctr_err,   p_instance);
 
+                                                                /* --------------- REMOVE CONN SOCK EVT --------------- */
+    HTTPsSock_ConnEvtRemove(p_instance, p_conn);
+
                                                                 /* ------------ UPDATE INSTANCE CONN LIST ------------- */
     if (p_instance->ConnFirstPtr == DEF_NULL) {
         HTTPs_STATS_INC(p_ctr_err->Conn_ErrFreePtrNullCtr);
@@ -1275,57 +1299,7 @@ void  HTTPsMem_ConnRelease (HTTPs_INSTANCE  *p_instance,
         }
     }
 
-#if (HTTPs_CFG_ABSOLUTE_URI_EN == DEF_ENABLED)
-                                                                /* ----------------- RELEASE HOST BLK ----------------- */
-    Mem_DynPoolBlkFree(&p_instance->PoolHost,
-                        p_conn->HostPtr,
-                       &err_lib);
-    if (err_lib != LIB_MEM_ERR_NONE) {
-        HTTPs_ERR_INC(p_ctr_err->Host_ErrPoolLibFreeCtr);
-    }
-
-    p_conn->HostPtr = DEF_NULL;
-#endif
-
-                                                                /* ----------------- RELEASE PATH BLK ----------------- */
-    Mem_DynPoolBlkFree(&p_instance->PoolPath,
-                        p_conn->PathPtr,
-                       &err_lib);
-    if (err_lib != LIB_MEM_ERR_NONE) {
-        HTTPs_ERR_INC(p_ctr_err->Conn_ErrPathPoolLibFreeCtr);
-    }
-
-    p_conn->PathPtr = DEF_NULL;
-
-                                                                /* ----------------- RELEASE BUF BLK ------------------ */
-    Mem_DynPoolBlkFree(&p_instance->PoolBuf,
-                        p_conn->BufPtr,
-                       &err_lib);
-    if (err_lib != LIB_MEM_ERR_NONE) {
-        HTTPs_ERR_INC(p_ctr_err->Conn_ErrBufPoolLibFreeCtr);
-    }
-
-    p_conn->BufPtr = DEF_NULL;
-
-#if ((HTTPs_CFG_FORM_EN           == DEF_ENABLED) && \
-     (HTTPs_CFG_FORM_MULTIPART_EN == DEF_ENABLED))
-    if (p_cfg->FormCfgPtr         != DEF_NULL) {
-
-        if (p_cfg->FormCfgPtr->MultipartEn == DEF_ENABLED) {
-                                                                /* ------------- RELEASE FORM BOUDNARY BLK ------------ */
-            Mem_DynPoolBlkFree(&p_instance->PoolFormBoundary,
-                                p_conn->FormBoundaryPtr,
-                               &err_lib);
-            if (err_lib != LIB_MEM_ERR_NONE) {
-                HTTPs_ERR_INC(p_ctr_err->Req_ErrFormBoundaryPoolLibFreeCtr);
-            }
-
-            p_conn->FormBoundaryPtr = DEF_NULL;
-        }
-    }
-#endif
-
-                                                                /* ----------------- RELEASE CONN BLK ----------------- */
+                                                                /* ---------------- RELEASE CONN SLAB ----------------- */
     Mem_DynPoolBlkFree(&p_instance->PoolConn,
                         p_conn,
                        &err_lib);
@@ -1347,8 +1321,10 @@ void  HTTPsMem_ConnRelease (HTTPs_INSTANCE  *p_instance,
 * Description : (1) Clear objects related to an HTTP request on the given connection.
 *
 *                   (a) Release Token blocks
-*                   (b) Release Key-Value blocks
-*                   (c) Release Header blocks
+*                   (b) Reset   transaction arena
+*                   (c) Release Key-Value blocks
+*                   (d) Release Header blocks
+*                   (e) Restore the data received after the previous request
 *
 *
 * Argument(s) : p_instance  Pointer to the instance structure variable.
@@ -1359,7 +1335,12 @@ void  HTTPsMem_ConnRelease (HTTPs_INSTANCE  *p_instance,
 *
 * Caller(s)   : HTTPsConn_Process().
 *
-* Note(s)     : None.
+* Note(s)     : (2) The data received after the previous request was moved at the end of the buffer and the
+*                   connection buffer length was reduced accordingly (see HTTPsReq_PipelineSave()). That data
+*                   becomes the received data to parse for the next request.
+*
+*               (3) When the connection has a transaction arena, the key-value & header lists are emptied by
+*                   the arena reset and the release functions below have nothing left to walk.
 *********************************************************************************************************
 */
 
@@ -1379,6 +1360,15 @@ void  HTTPsMem_ConnClr (HTTPs_INSTANCE  *p_instance,
     }
 #endif
 
+#if (HTTPs_CFG_DEFLATE_EN == DEF_ENABLED)
+    if (p_conn->DeflateCtxPtr != DEF_NULL) {
+        HTTPsMem_DeflateRelease(p_instance, p_conn);
+        HTTPs_ERR_INC(p_ctr_err->Resp_ErrDeflateClrNotEmptyCtr);
+    }
+#endif
+                                                                /* Release all txn blks at once (see Note #3).          */
+    HTTPsMem_TxnArenaReset(p_instance, p_conn);
+
 #if (HTTPs_CFG_QUERY_STR_EN == DEF_ENABLED)
     HTTPsMem_QueryStrKeyValBlkReleaseAll(p_instance, p_conn);
 #endif
@@ -1459,13 +1449,22 @@ void  HTTPsMem_ConnClr (HTTPs_INSTANCE  *p_instance,
     p_conn->StatusCode         =  HTTP_STATUS_OK;
     p_conn->RespBodyDataType   =  HTTPs_BODY_DATA_TYPE_NONE;
     p_conn->RespContentType    =  HTTP_CONTENT_TYPE_UNKNOWN;
-
-    p_conn->RxBufPtr           =  p_conn->BufPtr;
+#if (HTTPs_CFG_CONTENT_CODING_EN == DEF_ENABLED)
+    p_conn->ContentCodingFlags =  HTTPs_FLAG_NONE;
+#endif
+#if (HTTPs_CFG_COND_REQ_EN == DEF_ENABLED)
+    p_conn->CondFlags          =  HTTPs_FLAG_NONE;
+    p_conn->CondReqTagNbr      =  0u;
+#endif
+                                                                /* Restore data rxd after the req (see Note #2).        */
+    p_conn->RxBufPtr           =  p_conn->BufPtr + p_conn->BufLen;
     p_conn->TxBufPtr           =  p_conn->BufPtr;
 
-    p_conn->RxBufLenRem        =  0u;
+    p_conn->RxBufLenRem        =  p_cfg->BufLen  - p_conn->BufLen;
+    p_conn->RxBufScanLen       =  0u;
     p_conn->RxDataLen          =  0u;
     p_conn->TxDataLen          =  0u;
+    p_conn->BufLen             =  p_cfg->BufLen;
 
    (void)p_ctr_err;
 }
@@ -1508,15 +1507,21 @@ CPU_BOOLEAN  HTTPsMem_TokenGet (HTTPs_INSTANCE  *p_instance,
     HTTPs_INSTANCE_STATS   *p_ctr_stats;
     HTTPs_INSTANCE_ERRS    *p_ctr_err;
     CPU_BOOLEAN             result;
+    CPU_SIZE_T              val_len;
     LIB_ERR                 err_lib;
 
 
     HTTPs_SET_PTR_STATS(p_ctr_stats, p_instance);
     HTTPs_SET_PTR_ERRS( p_ctr_err,   p_instance);
 
+    val_len = p_instance->CfgPtr->TokenCfgPtr->ValLenMax + HTTP_STR_BUF_TOP_SPACE_REQ_MIN + HTTP_STR_BUF_END_SPACE_REQ_MIN;
+
                                                                 /* ---------------- ACQUIRE TOKEN BLK ----------------- */
-    p_token = (HTTPs_TOKEN_CTRL *)Mem_DynPoolBlkGet(&p_instance->PoolTokenCtrl,
-                                                    &err_lib);
+    p_token = (HTTPs_TOKEN_CTRL *)HTTPsMem_TxnBlkGet( p_instance,
+                                                      p_conn,
+                                                     &p_instance->PoolTokenCtrl,
+                                                      sizeof(HTTPs_TOKEN_CTRL),
+                                                     &err_lib);
     switch (err_lib) {
         case LIB_MEM_ERR_NONE:
              break;
@@ -1541,8 +1546,11 @@ CPU_BOOLEAN  HTTPsMem_TokenGet (HTTPs_INSTANCE  *p_instance,
     }
 
                                                                 /* -------------- ACQUIRE TOKEN VAL BLK --------------- */
-    p_token->ValPtr = (CPU_CHAR *)Mem_DynPoolBlkGet(&p_instance->PoolTokenVal,
-                                                    &err_lib);
+    p_token->ValPtr = (CPU_CHAR *)HTTPsMem_TxnBlkGet( p_instance,
+                                                      p_conn,
+                                                     &p_instance->PoolTokenVal,
+                                                      val_len,
+                                                     &err_lib);
     switch (err_lib) {
         case LIB_MEM_ERR_NONE:
              break;
@@ -1578,9 +1586,11 @@ CPU_BOOLEAN  HTTPsMem_TokenGet (HTTPs_INSTANCE  *p_instance,
 
 
 exit_release_blk:
-    Mem_DynPoolBlkFree(&p_instance->PoolTokenCtrl,              /* Release token previously acquired.                   */
-                        p_token,
-                       &err_lib);
+    HTTPsMem_TxnBlkFree( p_conn,                                /* Release token previously acquired.                   */
+                        &p_instance->PoolTokenCtrl,
+                         p_token,
+                         sizeof(HTTPs_TOKEN_CTRL),
+                        &err_lib);
 
 exit:
     return (result);
@@ -1621,16 +1631,21 @@ void  HTTPsMem_TokenRelease (HTTPs_INSTANCE  *p_instance,
 {
     HTTPs_INSTANCE_STATS   *p_ctr_stats;
     HTTPs_INSTANCE_ERRS    *p_ctr_err;
+    CPU_SIZE_T              val_len;
     LIB_ERR                 err_lib;
 
 
     HTTPs_SET_PTR_STATS(p_ctr_stats, p_instance);
     HTTPs_SET_PTR_ERRS( p_ctr_err,   p_instance);
 
+    val_len = p_instance->CfgPtr->TokenCfgPtr->ValLenMax + HTTP_STR_BUF_TOP_SPACE_REQ_MIN + HTTP_STR_BUF_END_SPACE_REQ_MIN;
+
                                                                 /* -------------- RELEASE TOKEN VAL BLK --------------- */
-    Mem_DynPoolBlkFree(&p_instance->PoolTokenVal,
-                        p_conn->TokenCtrlPtr->ValPtr,
-                       &err_lib);
+    HTTPsMem_TxnBlkFree( p_conn,
+                        &p_instance->PoolTokenVal,
+                         p_conn->TokenCtrlPtr->ValPtr,
+                         val_len,
+                        &err_lib);
     if (err_lib != LIB_MEM_ERR_NONE) {
         HTTPs_ERR_INC(p_ctr_err->Resp_ErrTokenValPoolLibFreeCtr);
     }
@@ -1638,9 +1653,11 @@ void  HTTPsMem_TokenRelease (HTTPs_INSTANCE  *p_instance,
     p_conn->TokenCtrlPtr->ValPtr = DEF_NULL;
 
                                                                 /* ---------------- RELEASE TOKEN BLK ----------------- */
-    Mem_DynPoolBlkFree(&p_instance->PoolTokenCtrl,
-                        p_conn->TokenCtrlPtr,
-                       &err_lib);
+    HTTPsMem_TxnBlkFree( p_conn,
+                        &p_instance->PoolTokenCtrl,
+                         p_conn->TokenCtrlPtr,
+                         sizeof(HTTPs_TOKEN_CTRL),
+                        &err_lib);
     if (err_lib != LIB_MEM_ERR_NONE) {
         HTTPs_ERR_INC(p_ctr_err->Resp_ErrTokenPoolLibFreeCtr);
     }
@@ -1652,6 +1669,158 @@ void  HTTPsMem_TokenRelease (HTTPs_INSTANCE  *p_instance,
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                        HTTPsMem_DeflateGet()
+*
+* Description : (1) Acquire a deflate block for the response of a connection:
+*
+*                   (a) Acquire deflate block
+*                   (b) Carve the context & its buffers in the block
+*                   (c) Start the compression
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceStart().
+*
+*               p_conn      Pointer to the connection.
+*               ------      Argument validated in HTTPsSock_ConnAccept().
+*
+* Return(s)   : Pointer to the deflate context, if no error(s).
+*
+*               Null pointer,                   otherwise.
+*
+* Caller(s)   : HTTPsResp_PrepareBodyData().
+*
+*               This function is an INTERNAL HTTP server function & MUST NOT be called by application
+*               function(s).
+*
+* Note(s)     : (2) The block is carved in the order used by HTTPsMem_DeflateBlkLenGet() :
+*
+*                       +-------------------+------------+--------+------------+
+*                       | HTTPs_DEFLATE_CTX | Hash table | Window | Output buf |
+*                       +-------------------+------------+--------+------------+
+*
+*               (3) The window & hash table lengths are powers of 2 (see HTTPs_InstanceInit()).
+*********************************************************************************************************
+*/
+#if (HTTPs_CFG_DEFLATE_EN == DEF_ENABLED)
+HTTPs_DEFLATE_CTX  *HTTPsMem_DeflateGet (HTTPs_INSTANCE  *p_instance,
+                                         HTTPs_CONN      *p_conn)
+{
+    const  HTTPs_DEFLATE_CFG     *p_cfg_deflate;
+           HTTPs_DEFLATE_CTX     *p_ctx;
+           HTTPs_INSTANCE_STATS  *p_ctr_stats;
+           HTTPs_INSTANCE_ERRS   *p_ctr_err;
+           CPU_INT08U            *p_blk;
+           CPU_INT16U             hash_tbl_len;
+           LIB_ERR                err_lib;
+
+
+    HTTPs_SET_PTR_STATS(p_ctr_stats, p_instance);
+    HTTPs_SET_PTR_ERRS( p_ctr_err,   p_instance);
+
+    p_cfg_deflate = p_instance->CfgPtr->DeflateCfgPtr;
+
+                                                                /* --------------- ACQUIRE DEFLATE BLK ---------------- */
+    p_blk = (CPU_INT08U *)Mem_DynPoolBlkGet(&p_instance->PoolDeflate,
+                                            &err_lib);
+    switch (err_lib) {
+        case LIB_MEM_ERR_NONE:
+             break;
+
+        case LIB_MEM_ERR_SEG_OVF:
+             HTTPs_ERR_INC(p_ctr_err->Resp_ErrDeflatePoolMemSpaceCtr);
+             return (DEF_NULL);
+
+        case LIB_MEM_ERR_POOL_EMPTY:
+             HTTPs_ERR_INC(p_ctr_err->Resp_ErrDeflatePoolEmptyCtr);
+             return (DEF_NULL);
+
+        default:
+             HTTPs_ERR_INC(p_ctr_err->Resp_ErrDeflatePoolLibGetCtr);
+             return (DEF_NULL);
+    }
+
+                                                                /* ------------ CARVE CTX IN BLK (see Note #2) -------- */
+    p_ctx             = (HTTPs_DEFLATE_CTX *)p_blk;
+    p_blk            +=  HTTPs_MEM_ALIGN_LEN(sizeof(HTTPs_DEFLATE_CTX));
+    p_ctx->HashTblPtr = (CPU_INT16U *)p_blk;
+    p_blk            +=  HTTPs_MEM_ALIGN_LEN(p_cfg_deflate->HashTblLen * sizeof(CPU_INT16U));
+    p_ctx->WinPtr     =  p_blk;
+    p_blk            +=  HTTPs_MEM_ALIGN_LEN(p_cfg_deflate->WinLen);
+    p_ctx->OutBufPtr  = (CPU_CHAR *)p_blk;
+    p_ctx->OutLenMax  =  p_instance->DeflateOutLenMax;
+    p_ctx->WinMask    =  p_cfg_deflate->WinLen - 1u;
+
+    p_ctx->HashShift  =  DEF_INT_32_NBR_BITS;                   /* Shift keeps log2(hash tbl len) bits (see Note #3).   */
+    hash_tbl_len      =  p_cfg_deflate->HashTblLen;
+    while (hash_tbl_len > 1u) {
+        hash_tbl_len >>= 1u;
+        p_ctx->HashShift--;
+    }
+
+                                                                /* ------------------ START STREAM -------------------- */
+    HTTPsDeflate_Start(p_ctx);
+
+    p_conn->DeflateCtxPtr = p_ctx;
+
+    HTTPs_STATS_INC(p_ctr_stats->Resp_StatDeflateAcquiredCtr);
+
+    return (p_ctx);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      HTTPsMem_DeflateRelease()
+*
+* Description : Release the deflate block of a connection.
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceStart().
+*
+*               p_conn      Pointer to the connection.
+*               ------      Argument validated in HTTPsSock_ConnAccept().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPsConn_Close(),
+*               HTTPsMem_ConnClr(),
+*               HTTPsResp_Handle().
+*
+*               This function is an INTERNAL HTTP server function & MUST NOT be called by application
+*               function(s).
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+#if (HTTPs_CFG_DEFLATE_EN == DEF_ENABLED)
+void  HTTPsMem_DeflateRelease (HTTPs_INSTANCE  *p_instance,
+                               HTTPs_CONN      *p_conn)
+{
+    HTTPs_INSTANCE_STATS  *p_ctr_stats;
+    HTTPs_INSTANCE_ERRS   *p_ctr_err;
+    LIB_ERR                err_lib;
+
+
+    HTTPs_SET_PTR_STATS(p_ctr_stats, p_instance);
+    HTTPs_SET_PTR_ERRS( p_ctr_err,   p_instance);
+
+    Mem_DynPoolBlkFree(&p_instance->PoolDeflate,
+                        p_conn->DeflateCtxPtr,
+                       &err_lib);
+    if (err_lib != LIB_MEM_ERR_NONE) {
+        HTTPs_ERR_INC(p_ctr_err->Resp_ErrDeflatePoolLibFreeCtr);
+    }
+
+    p_conn->DeflateCtxPtr = DEF_NULL;
+
+    HTTPs_STATS_INC(p_ctr_stats->Resp_StatDeflateReleaseCtr);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                    HTTPsMem_QueryStrKeyValBlkGet()
@@ -1659,8 +1828,7 @@ void  HTTPsMem_TokenRelease (HTTPs_INSTANCE  *p_instance,
 * Description : (1) Acquire a new Key-Value Pair block for an HTTP Query String received:
 *
 *                   (a) Acquire Key-Value block
-*                   (b) Acquire Key string block
-*                   (c) Acquire Value string block
+*                   (b) Set     Key & Value string pointers
 
 *
 * Argument(s) : p_instance  Pointer to the instance used to acquire a connection.
@@ -1676,7 +1844,8 @@ void  HTTPsMem_TokenRelease (HTTPs_INSTANCE  *p_instance,
 *
 *               This function is an INTERNAL function & MUST NOT be called by application function(s).
 *
-* Note(s)     : none.
+* Note(s)     : (2) The key & value string buffers are stored in the same pool block, immediately after the
+*                   Key-Value structure (see 'HTTPsMem_ConnPoolInit()  Note #3').
 *********************************************************************************************************
 */
 #if (HTTPs_CFG_QUERY_STR_EN == DEF_ENABLED)
@@ -1684,18 +1853,26 @@ HTTPs_KEY_VAL  *HTTPsMem_QueryStrKeyValBlkGet (HTTPs_INSTANCE  *p_instance,
                                                HTTPs_CONN      *p_conn,
                                                HTTPs_ERR       *p_err)
 {
-    HTTPs_KEY_VAL         *p_key_val;
-    HTTPs_INSTANCE_STATS  *p_ctr_stats;
-    HTTPs_INSTANCE_ERRS   *p_ctr_err;
-    LIB_ERR                err_lib;
+    const  HTTPs_CFG             *p_cfg;
+           HTTPs_KEY_VAL         *p_key_val;
+           HTTPs_INSTANCE_STATS  *p_ctr_stats;
+           HTTPs_INSTANCE_ERRS   *p_ctr_err;
+           CPU_SIZE_T             key_val_len;
+           LIB_ERR                err_lib;
 
 
+    p_cfg       = p_instance->CfgPtr;
+    key_val_len = sizeof(HTTPs_KEY_VAL) + p_cfg->QueryStrCfgPtr->KeyLenMax + p_cfg->QueryStrCfgPtr->ValLenMax;
+
     HTTPs_SET_PTR_STATS(p_ctr_stats, p_instance);
     HTTPs_SET_PTR_ERRS( p_ctr_err,   p_instance);
 
                                                                 /* --------------- ACQUIRE KEY-VAL BLK ---------------- */
-    p_key_val = (HTTPs_KEY_VAL *)Mem_DynPoolBlkGet(&p_instance->PoolKeyVal,
-                                                   &err_lib);
+    p_key_val = (HTTPs_KEY_VAL *)HTTPsMem_TxnBlkGet( p_instance,
+                                                     p_conn,
+                                                    &p_instance->PoolQueryStrKeyVal,
+                                                     key_val_len,
+                                                    &err_lib);
     switch (err_lib) {
         case LIB_MEM_ERR_NONE:
              break;
@@ -1710,42 +1887,9 @@ HTTPs_KEY_VAL  *HTTPsMem_QueryStrKeyValBlkGet (HTTPs_INSTANCE  *p_instance,
              HTTPs_ERR_INC(p_ctr_err->Req_ErrKeyValPoolLibGetCtr);
              goto exit;
     }
-
-                                                                /* -------------- ACQUIRE KEY STRING BLK -------------- */
-    p_key_val->KeyPtr = (CPU_CHAR *)Mem_DynPoolBlkGet(&p_instance->PoolQueryStrKeyStr,
-                                                      &err_lib);
-    switch (err_lib) {
-        case LIB_MEM_ERR_NONE:
-             break;
-
-        case LIB_MEM_ERR_SEG_OVF:
-            *p_err = HTTPs_ERR_MEM_NO_SPACE;
-             HTTPs_ERR_INC(p_ctr_err->Req_ErrQueryStrKeyPoolMemSpaceCtr);
-             goto exit_release_blk;
-
-        default:
-            *p_err = HTTPs_ERR_QUERY_STR_POOL_LIB_FAULT;
-             HTTPs_ERR_INC(p_ctr_err->Req_ErrQueryStrKeyPoolLibGetCtr);
-             goto exit_release_blk;
-    }
-
-                                                                /* -------------- ACQUIRE VAL STRING BLK -------------- */
-    p_key_val->ValPtr = (CPU_CHAR *)Mem_DynPoolBlkGet(&p_instance->PoolQueryStrValStr,
-                                                      &err_lib);
-    switch (err_lib) {
-        case LIB_MEM_ERR_NONE:
-             break;
-
-        case LIB_MEM_ERR_SEG_OVF:
-            *p_err = HTTPs_ERR_MEM_NO_SPACE;
-             HTTPs_ERR_INC(p_ctr_err->Req_ErrQueryStrValPoolMemSpaceCtr);
-             goto exit_release_key;
-
-        default:
-            *p_err = HTTPs_ERR_QUERY_STR_POOL_LIB_FAULT;
-             HTTPs_ERR_INC(p_ctr_err->Req_ErrQueryStrValPoolLibGetCtr);
-             goto exit_release_key;
-    }
+                                                                /* Key & val str follow the blk (see Note #2).          */
+    p_key_val->KeyPtr = (CPU_CHAR *)(p_key_val + 1);
+    p_key_val->ValPtr =  p_key_val->KeyPtr + p_cfg->QueryStrCfgPtr->KeyLenMax;
 
     p_conn->QueryStrBlkAcquiredCtr++;
 
@@ -1753,21 +1897,6 @@ HTTPs_KEY_VAL  *HTTPsMem_QueryStrKeyValBlkGet (HTTPs_INSTANCE  *p_instance,
 
    *p_err = HTTPs_ERR_NONE;
 
-    goto exit;
-
-
-exit_release_key:
-    Mem_DynPoolBlkFree(&p_instance->PoolQueryStrKeyStr,         /* Key String block previously acquired.                */
-                        p_key_val->KeyPtr,
-                       &err_lib);
-    p_key_val->KeyPtr = DEF_NULL;
-
-exit_release_blk:
-    Mem_DynPoolBlkFree(&p_instance->PoolKeyVal,                 /* Key-Val block previously acquired.                   */
-                        p_key_val,
-                       &err_lib);
-    p_key_val = DEF_NULL;
-
 exit:
     return (p_key_val);
 }
@@ -1780,9 +1909,7 @@ exit:
 *
 * Description : (1) Release the entire Key-Value pairs list associated with Query String received:
 *
-*                   (a) Release Key-value value block
-*                   (b) Release Key-value key block
-*                   (c) Release Key-value block
+*                   (a) Release Key-value block (including key & value strings)
 *
 *
 * Argument(s) : p_instance  Pointer to the instance used to acquire a connection.
@@ -1803,46 +1930,35 @@ exit:
 void  HTTPsMem_QueryStrKeyValBlkReleaseAll (HTTPs_INSTANCE  *p_instance,
                                             HTTPs_CONN      *p_conn)
 {
-    HTTPs_KEY_VAL         *p_key_val;
-    HTTPs_KEY_VAL         *p_key_val_next;
-    HTTPs_INSTANCE_STATS  *p_ctr_stats;
-    HTTPs_INSTANCE_ERRS   *p_ctr_err;
-    LIB_ERR                err_lib;
+    const  HTTPs_CFG             *p_cfg;
+           HTTPs_KEY_VAL         *p_key_val;
+           HTTPs_KEY_VAL         *p_key_val_next;
+           HTTPs_INSTANCE_STATS  *p_ctr_stats;
+           HTTPs_INSTANCE_ERRS   *p_ctr_err;
+           CPU_SIZE_T             key_val_len;
+           LIB_ERR                err_lib;
 
 
     HTTPs_SET_PTR_STATS(p_ctr_stats, p_instance);
     HTTPs_SET_PTR_ERRS( p_ctr_err,   p_instance);
 
+    p_cfg       = p_instance->CfgPtr;
+    key_val_len = sizeof(HTTPs_KEY_VAL) + p_cfg->QueryStrCfgPtr->KeyLenMax + p_cfg->QueryStrCfgPtr->ValLenMax;
+
     p_key_val = p_conn->QueryStrListPtr;
     while (p_key_val != DEF_NULL) {
 
         p_key_val_next     = p_key_val->NextPtr;
         p_key_val->NextPtr = DEF_NULL;
 
-                                                                /* ----------------- RELEASE VAL BLK ------------------ */
-        Mem_DynPoolBlkFree(&p_instance->PoolQueryStrValStr,
-                            p_key_val->ValPtr,
-                           &err_lib);
-        if (err_lib != LIB_MEM_ERR_NONE) {
-            HTTPs_ERR_INC(p_ctr_err->Req_ErrQueryStrValPoolLibFreeCtr);
-        }
-
-        p_key_val->ValPtr = DEF_NULL;
-
-                                                                /* ----------------- RELEASE KEY BLK ------------------ */
-        Mem_DynPoolBlkFree(&p_instance->PoolQueryStrKeyStr,
-                            p_key_val->KeyPtr,
-                           &err_lib);
-        if (err_lib != LIB_MEM_ERR_NONE) {
-            HTTPs_ERR_INC(p_ctr_err->Req_ErrQueryStrKeyPoolLibFreeCtr);
-        }
-
-        p_key_val->KeyPtr = DEF_NULL;
-
+        p_key_val->KeyPtr  = DEF_NULL;
+        p_key_val->ValPtr  = DEF_NULL;
                                                                 /* --------------- RELEASE KEY-VAL BLK ---------------- */
-        Mem_DynPoolBlkFree(&p_instance->PoolKeyVal,
-                            p_key_val,
-                           &err_lib);
+        HTTPsMem_TxnBlkFree( p_conn,
+                            &p_instance->PoolQueryStrKeyVal,
+                             p_key_val,
+                             key_val_len,
+                            &err_lib);
         if (err_lib != LIB_MEM_ERR_NONE) {
             HTTPs_ERR_INC(p_ctr_err->Req_ErrKeyValPoolLibFreeCtr);
         }
@@ -1867,8 +1983,7 @@ void  HTTPsMem_QueryStrKeyValBlkReleaseAll (HTTPs_INSTANCE  *p_instance,
 * Description : (1) Acquire a new Key-Value Pair block for an HTTP Form received:
 *
 *                   (a) Acquire Key-Value block
-*                   (b) Acquire Key string block
-*                   (c) Acquire Value string block
+*                   (b) Set     Key & Value string pointers
 *
 * Argument(s) : p_instance  Pointer to the instance used to acquire a connection.
 *               ----------  Argument validated in HTTPs_InstanceStart().
@@ -1884,7 +1999,8 @@ void  HTTPsMem_QueryStrKeyValBlkReleaseAll (HTTPs_INSTANCE  *p_instance,
 *
 *               This function is an INTERNAL function & MUST NOT be called by application function(s).
 *
-* Note(s)     : none.
+* Note(s)     : (2) The key & value string buffers are stored in the same pool block, immediately after the
+*                   Key-Value structure (see 'HTTPsMem_ConnPoolInit()  Note #3').
 *********************************************************************************************************
 */
 #if (HTTPs_CFG_FORM_EN == DEF_ENABLED)
@@ -1892,68 +2008,43 @@ HTTPs_KEY_VAL  *HTTPsMem_FormKeyValBlkGet (HTTPs_INSTANCE  *p_instance,
                                            HTTPs_CONN      *p_conn,
                                            HTTPs_ERR       *p_err)
 {
-    HTTPs_KEY_VAL         *p_key_val;
-    HTTPs_INSTANCE_STATS  *p_ctr_stats;
-    HTTPs_INSTANCE_ERRS   *p_ctr_err;
-    LIB_ERR                err_lib;
-
-
-    HTTPs_SET_PTR_STATS(p_ctr_stats, p_instance);
-    HTTPs_SET_PTR_ERRS( p_ctr_err,   p_instance);
-
-                                                                /* --------------- ACQUIRE KEY-VAL BLK ---------------- */
-    p_key_val = (HTTPs_KEY_VAL *)Mem_DynPoolBlkGet(&p_instance->PoolKeyVal,
-                                                   &err_lib);
-    switch (err_lib) {
-        case LIB_MEM_ERR_NONE:
-             break;
-
-        case LIB_MEM_ERR_SEG_OVF:
-            *p_err = HTTPs_ERR_MEM_NO_SPACE;
-             HTTPs_ERR_INC(p_ctr_err->Req_ErrKeyValPoolMemSpaceCtr);
-             goto exit;
-
-        default:
-            *p_err = HTTPs_ERR_FORM_POOL_LIB_FAULT;
-             HTTPs_ERR_INC(p_ctr_err->Req_ErrKeyValPoolLibGetCtr);
-             goto exit;
-    }
-
-                                                                /* -------------- ACQUIRE KEY STRING BLK -------------- */
-    p_key_val->KeyPtr = (CPU_CHAR *)Mem_DynPoolBlkGet(&p_instance->PoolFormKeyStr,
-                                                      &err_lib);
-    switch (err_lib) {
-        case LIB_MEM_ERR_NONE:
-             break;
-
-        case LIB_MEM_ERR_SEG_OVF:
-            *p_err = HTTPs_ERR_MEM_NO_SPACE;
-             HTTPs_ERR_INC(p_ctr_err->Req_ErrFormKeyPoolMemSpaceCtr);
-             goto exit_release_blk;
-
-        default:
-            *p_err = HTTPs_ERR_FORM_POOL_LIB_FAULT;
-             HTTPs_ERR_INC(p_ctr_err->Req_ErrFormKeyPoolLibGetCtr);
-             goto exit_release_blk;
-    }
+    const  HTTPs_CFG             *p_cfg;
+           HTTPs_KEY_VAL         *p_key_val;
+           HTTPs_INSTANCE_STATS  *p_ctr_stats;
+           HTTPs_INSTANCE_ERRS   *p_ctr_err;
+           CPU_SIZE_T             key_val_len;
+           LIB_ERR                err_lib;
 
-                                                                /* -------------- ACQUIRE VAL STRING BLK -------------- */
-    p_key_val->ValPtr = (CPU_CHAR *)Mem_DynPoolBlkGet(&p_instance->PoolFormValStr,
-                                                      &err_lib);
+
+    p_cfg       = p_instance->CfgPtr;
+    key_val_len = sizeof(HTTPs_KEY_VAL) + p_cfg->FormCfgPtr->KeyLenMax + p_cfg->FormCfgPtr->ValLenMax;
+
+    HTTPs_SET_PTR_STATS(p_ctr_stats, p_instance);
+    HTTPs_SET_PTR_ERRS( p_ctr_err,   p_instance);
+
+                                                                /* --------------- ACQUIRE KEY-VAL BLK ---------------- */
+    p_key_val = (HTTPs_KEY_VAL *)HTTPsMem_TxnBlkGet( p_instance,
+                                                     p_conn,
+                                                    &p_instance->PoolFormKeyVal,
+                                                     key_val_len,
+                                                    &err_lib);
     switch (err_lib) {
         case LIB_MEM_ERR_NONE:
              break;
 
         case LIB_MEM_ERR_SEG_OVF:
             *p_err = HTTPs_ERR_MEM_NO_SPACE;
-             HTTPs_ERR_INC(p_ctr_err->Req_ErrFormValPoolMemSpaceCtr);
-             goto exit_release_key;
+             HTTPs_ERR_INC(p_ctr_err->Req_ErrKeyValPoolMemSpaceCtr);
+             goto exit;
 
         default:
             *p_err = HTTPs_ERR_FORM_POOL_LIB_FAULT;
-             HTTPs_ERR_INC(p_ctr_err->Req_ErrFormValPoolLibGetCtr);
-             goto exit_release_key;
+             HTTPs_ERR_INC(p_ctr_err->Req_ErrKeyValPoolLibGetCtr);
+             goto exit;
     }
+                                                                /* Key & val str follow the blk (see Note #2).          */
+    p_key_val->KeyPtr = (CPU_CHAR *)(p_key_val + 1);
+    p_key_val->ValPtr =  p_key_val->KeyPtr + p_cfg->FormCfgPtr->KeyLenMax;
 
     p_conn->FormBlkAcquiredCtr++;
 
@@ -1961,21 +2052,6 @@ HTTPs_KEY_VAL  *HTTPsMem_FormKeyValBlkGet (HTTPs_INSTANCE  *p_instance,
 
    *p_err = HTTPs_ERR_NONE;
 
-    goto exit;
-
-
-exit_release_key:
-    Mem_DynPoolBlkFree(&p_instance->PoolFormKeyStr,             /* Key String block previously acquired.                */
-                        p_key_val->KeyPtr,
-                       &err_lib);
-    p_key_val->KeyPtr = DEF_NULL;
-
-exit_release_blk:
-    Mem_DynPoolBlkFree(&p_instance->PoolKeyVal,                 /* Key-Val block previously acquired.                   */
-                        p_key_val,
-                       &err_lib);
-    p_key_val = DEF_NULL;
-
 exit:
     return (p_key_val);
 }
@@ -1988,9 +2064,7 @@ exit:
 *
 * Description : (1) Release the entire Key-Value pairs list associated with Form received:
 *
-*                   (a) Release Key-value value block
-*                   (b) Release Key-value key block
-*                   (c) Release Key-value block
+*                   (a) Release Key-value block (including key & value strings)
 *
 * Argument(s) : p_instance  Pointer to the instance used to acquire a connection.
 *               ----------  Argument validated in HTTPs_InstanceStart().
@@ -2012,46 +2086,35 @@ exit:
 void  HTTPsMem_FormKeyValBlkReleaseAll (HTTPs_INSTANCE  *p_instance,
                                         HTTPs_CONN      *p_conn)
 {
-    HTTPs_KEY_VAL         *p_key_val;
-    HTTPs_KEY_VAL         *p_key_val_next;
-    HTTPs_INSTANCE_STATS  *p_ctr_stats;
-    HTTPs_INSTANCE_ERRS   *p_ctr_err;
-    LIB_ERR                err_lib;
+    const  HTTPs_CFG             *p_cfg;
+           HTTPs_KEY_VAL         *p_key_val;
+           HTTPs_KEY_VAL         *p_key_val_next;
+           HTTPs_INSTANCE_STATS  *p_ctr_stats;
+           HTTPs_INSTANCE_ERRS   *p_ctr_err;
+           CPU_SIZE_T             key_val_len;
+           LIB_ERR                err_lib;
 
 
     HTTPs_SET_PTR_STATS(p_ctr_stats, p_instance);
     HTTPs_SET_PTR_ERRS( p_ctr_err,   p_instance);
 
+    p_cfg       = p_instance->CfgPtr;
+    key_val_len = sizeof(HTTPs_KEY_VAL) + p_cfg->FormCfgPtr->KeyLenMax + p_cfg->FormCfgPtr->ValLenMax;
+
     p_key_val = p_conn->FormDataListPtr;
     while (p_key_val != DEF_NULL) {
 
         p_key_val_next     = p_key_val->NextPtr;
         p_key_val->NextPtr = DEF_NULL;
 
-                                                                /* ----------------- RELEASE VAL BLK ------------------ */
-        Mem_DynPoolBlkFree(&p_instance->PoolFormValStr,
-                            p_key_val->ValPtr,
-                           &err_lib);
-        if (err_lib != LIB_MEM_ERR_NONE) {
-            HTTPs_ERR_INC(p_ctr_err->Req_ErrFormValPoolLibFreeCtr);
-        }
-
-        p_key_val->ValPtr = DEF_NULL;
-
-                                                                /* ----------------- RELEASE KEY BLK ------------------ */
-        Mem_DynPoolBlkFree(&p_instance->PoolFormKeyStr,
-                            p_key_val->KeyPtr,
-                           &err_lib);
-        if (err_lib != LIB_MEM_ERR_NONE) {
-            HTTPs_ERR_INC(p_ctr_err->Req_ErrFormKeyPoolLibFreeCtr);
-        }
-
-        p_key_val->KeyPtr = DEF_NULL;
-
+        p_key_val->KeyPtr  = DEF_NULL;
+        p_key_val->ValPtr  = DEF_NULL;
                                                                 /* --------------- RELEASE KEY-VAL BLK ---------------- */
-        Mem_DynPoolBlkFree(&p_instance->PoolKeyVal,
-                            p_key_val,
-                           &err_lib);
+        HTTPsMem_TxnBlkFree( p_conn,
+                            &p_instance->PoolFormKeyVal,
+                             p_key_val,
+                             key_val_len,
+                            &err_lib);
         if (err_lib != LIB_MEM_ERR_NONE) {
             HTTPs_ERR_INC(p_ctr_err->Req_ErrKeyValPoolLibFreeCtr);
         }
@@ -2119,18 +2182,24 @@ HTTP_HDR_BLK  *HTTPsMem_ReqHdrGet(HTTPs_INSTANCE     *p_instance,
                                   HTTP_HDR_VAL_TYPE   val_type,
                                   HTTPs_ERR          *p_err)
 {
-    HTTP_HDR_BLK          *p_req_hdr_blk;
-    HTTPs_INSTANCE_STATS  *p_ctr_stats;
-    HTTPs_INSTANCE_ERRS   *p_ctr_err;
-    LIB_ERR                err_lib;
+    const  HTTPs_CFG             *p_cfg;
+           HTTP_HDR_BLK          *p_req_hdr_blk;
+           HTTPs_INSTANCE_STATS  *p_ctr_stats;
+           HTTPs_INSTANCE_ERRS   *p_ctr_err;
+           LIB_ERR                err_lib;
+
 
+    p_cfg = p_instance->CfgPtr;
 
     HTTPs_SET_PTR_STATS(p_ctr_stats, p_instance);
     HTTPs_SET_PTR_ERRS( p_ctr_err,   p_instance);
 
                                                                 /* ------------ ACQUIRE RESP HDR FIELD BLK ------------ */
-    p_req_hdr_blk = (HTTP_HDR_BLK *)Mem_DynPoolBlkGet(&p_instance->PoolReqHdr,
-                                                      &err_lib);
+    p_req_hdr_blk = (HTTP_HDR_BLK *)HTTPsMem_TxnBlkGet( p_instance,
+                                                        p_conn,
+                                                       &p_instance->PoolReqHdr,
+                                                        sizeof(HTTP_HDR_BLK),
+                                                       &err_lib);
     switch (err_lib) {
         case LIB_MEM_ERR_NONE:
              break;
@@ -2159,8 +2228,11 @@ HTTP_HDR_BLK  *HTTPsMem_ReqHdrGet(HTTPs_INSTANCE     *p_instance,
 
 
         case HTTP_HDR_VAL_TYPE_STR_DYN:
-             p_req_hdr_blk->ValPtr = Mem_DynPoolBlkGet(&p_instance->PoolReqHdrStr,
-                                                       &err_lib);
+             p_req_hdr_blk->ValPtr = HTTPsMem_TxnBlkGet( p_instance,
+                                                         p_conn,
+                                                        &p_instance->PoolReqHdrStr,
+                                                         p_cfg->HdrRxCfgPtr->DataLenMax,
+                                                        &err_lib);
              switch (err_lib) {
                  case LIB_MEM_ERR_NONE:
                       break;
@@ -2182,9 +2254,11 @@ HTTP_HDR_BLK  *HTTPsMem_ReqHdrGet(HTTPs_INSTANCE     *p_instance,
              }
 
              if (err_lib != LIB_MEM_ERR_NONE) {
-                 Mem_DynPoolBlkFree(&p_instance->PoolReqHdr,    /* Release hdr previously acquired.                    */
-                                     p_req_hdr_blk,
-                                    &err_lib);
+                 HTTPsMem_TxnBlkFree( p_conn,                   /* Release hdr previously acquired.                    */
+                                     &p_instance->PoolReqHdr,
+                                      p_req_hdr_blk,
+                                      sizeof(HTTP_HDR_BLK),
+                                     &err_lib);
                  return (DEF_NULL);
              }
              break;
@@ -2193,9 +2267,11 @@ HTTP_HDR_BLK  *HTTPsMem_ReqHdrGet(HTTPs_INSTANCE     *p_instance,
         default:
             *p_err = HTTPs_ERR_REQ_HDR_DATA_TYPE_UNKNOWN;
              HTTPs_ERR_INC(p_ctr_err->Req_ErrHdrValTypeUnknown);
-             Mem_DynPoolBlkFree(&p_instance->PoolReqHdr,
-                                 p_req_hdr_blk,
-                                &err_lib);
+             HTTPsMem_TxnBlkFree( p_conn,
+                                 &p_instance->PoolReqHdr,
+                                  p_req_hdr_blk,
+                                  sizeof(HTTP_HDR_BLK),
+                                 &err_lib);
              return (DEF_NULL);
     }
 
@@ -2253,11 +2329,14 @@ HTTP_HDR_BLK  *HTTPsMem_ReqHdrGet(HTTPs_INSTANCE     *p_instance,
 void  HTTPsMem_ReqHdrRelease (HTTPs_INSTANCE  *p_instance,
                               HTTPs_CONN      *p_conn)
 {
-    HTTP_HDR_BLK          *p_req_hdr_blk;
-    HTTPs_INSTANCE_STATS  *p_ctr_stats;
-    HTTPs_INSTANCE_ERRS   *p_ctr_err;
-    LIB_ERR                err_lib;
+    const  HTTPs_CFG             *p_cfg;
+           HTTP_HDR_BLK          *p_req_hdr_blk;
+           HTTPs_INSTANCE_STATS  *p_ctr_stats;
+           HTTPs_INSTANCE_ERRS   *p_ctr_err;
+           LIB_ERR                err_lib;
+
 
+    p_cfg = p_instance->CfgPtr;
 
     HTTPs_SET_PTR_STATS(p_ctr_stats, p_instance);
     HTTPs_SET_PTR_ERRS( p_ctr_err,   p_instance);
@@ -2276,9 +2355,11 @@ void  HTTPsMem_ReqHdrRelease (HTTPs_INSTANCE  *p_instance,
     switch(p_req_hdr_blk->ValType) {
         case HTTP_HDR_VAL_TYPE_STR_DYN:
                                                                 /* -------------- RELEASE STR DATA BLK ---------------- */
-             Mem_DynPoolBlkFree(&p_instance->PoolReqHdrStr,
-                                 p_req_hdr_blk->ValPtr,
-                                &err_lib);
+             HTTPsMem_TxnBlkFree( p_conn,
+                                 &p_instance->PoolReqHdrStr,
+                                  p_req_hdr_blk->ValPtr,
+                                  p_cfg->HdrRxCfgPtr->DataLenMax,
+                                 &err_lib);
              if (err_lib != LIB_MEM_ERR_NONE) {
                  HTTPs_ERR_INC(p_ctr_err->Req_ErrHdrBufPoolLibFreeCtr);
                  return;
@@ -2294,9 +2375,11 @@ void  HTTPsMem_ReqHdrRelease (HTTPs_INSTANCE  *p_instance,
     }
 
                                                                 /* ----------- RELEASE RESP HDR FIELD BLK ------------- */
-    Mem_DynPoolBlkFree(&p_instance->PoolReqHdr,
-                        p_req_hdr_blk,
-                       &err_lib);
+    HTTPsMem_TxnBlkFree( p_conn,
+                        &p_instance->PoolReqHdr,
+                         p_req_hdr_blk,
+                         sizeof(HTTP_HDR_BLK),
+                        &err_lib);
     if (err_lib != LIB_MEM_ERR_NONE) {
         HTTPs_ERR_INC(p_ctr_err->Req_ErrHdrPoolLibFreeCtr);
         return;
@@ -2387,8 +2470,11 @@ HTTP_HDR_BLK  *HTTPsMem_RespHdrGet(HTTPs_INSTANCE     *p_instance,
     }
 
                                                                 /* ------------ ACQUIRE RESP HDR FIELD BLK ------------ */
-    p_resp_hdr_blk = (HTTP_HDR_BLK *)Mem_DynPoolBlkGet(&p_instance->PoolRespHdr,
-                                                       &err_lib);
+    p_resp_hdr_blk = (HTTP_HDR_BLK *)HTTPsMem_TxnBlkGet( p_instance,
+                                                         p_conn,
+                                                        &p_instance->PoolRespHdr,
+                                                         sizeof(HTTP_HDR_BLK),
+                                                        &err_lib);
     switch (err_lib) {
         case LIB_MEM_ERR_NONE:
              break;
@@ -2418,8 +2504,11 @@ HTTP_HDR_BLK  *HTTPsMem_RespHdrGet(HTTPs_INSTANCE     *p_instance,
 
 
         case HTTP_HDR_VAL_TYPE_STR_DYN:
-             p_resp_hdr_blk->ValPtr = Mem_DynPoolBlkGet(&p_instance->PoolRespHdrStr,
-                                                        &err_lib);
+             p_resp_hdr_blk->ValPtr = HTTPsMem_TxnBlkGet( p_instance,
+                                                          p_conn,
+                                                         &p_instance->PoolRespHdrStr,
+                                                          p_cfg->HdrTxCfgPtr->DataLenMax,
+                                                         &err_lib);
              switch (err_lib) {
                  case LIB_MEM_ERR_NONE:
                       break;
@@ -2441,9 +2530,11 @@ HTTP_HDR_BLK  *HTTPsMem_RespHdrGet(HTTPs_INSTANCE     *p_instance,
              }
 
              if (err_lib != LIB_MEM_ERR_NONE) {
-                 Mem_DynPoolBlkFree(&p_instance->PoolRespHdr,   /* Release block previously acquired.                   */
-                                     p_resp_hdr_blk,
-                                    &err_lib);
+                 HTTPsMem_TxnBlkFree( p_conn,                   /* Release block previously acquired.                   */
+                                     &p_instance->PoolRespHdr,
+                                      p_resp_hdr_blk,
+                                      sizeof(HTTP_HDR_BLK),
+                                     &err_lib);
                  return (DEF_NULL);
              }
              break;
@@ -2452,9 +2543,11 @@ HTTP_HDR_BLK  *HTTPsMem_RespHdrGet(HTTPs_INSTANCE     *p_instance,
         default :
              HTTPs_ERR_INC(p_ctr_err->Resp_ErrHdrValTypeUnknown);
             *p_err = HTTPs_ERR_RESP_HDR_DATA_TYPE_UNKNOWN;
-             Mem_DynPoolBlkFree(&p_instance->PoolRespHdr,
-                                 p_resp_hdr_blk,
-                                &err_lib);
+             HTTPsMem_TxnBlkFree( p_conn,
+                                 &p_instance->PoolRespHdr,
+                                  p_resp_hdr_blk,
+                                  sizeof(HTTP_HDR_BLK),
+                                 &err_lib);
              return (DEF_NULL);
 
     }
@@ -2513,12 +2606,14 @@ HTTP_HDR_BLK  *HTTPsMem_RespHdrGet(HTTPs_INSTANCE     *p_instance,
 void  HTTPsMem_RespHdrRelease (HTTPs_INSTANCE  *p_instance,
                                HTTPs_CONN      *p_conn)
 {
+    const  HTTPs_CFG             *p_cfg;
+           HTTP_HDR_BLK          *p_resp_hdr_blk;
+           HTTPs_INSTANCE_STATS  *p_ctr_stats;
+           HTTPs_INSTANCE_ERRS   *p_ctr_err;
+           LIB_ERR                err_lib;
 
-    HTTP_HDR_BLK          *p_resp_hdr_blk;
-    HTTPs_INSTANCE_STATS  *p_ctr_stats;
-    HTTPs_INSTANCE_ERRS   *p_ctr_err;
-    LIB_ERR                err_lib;
 
+    p_cfg = p_instance->CfgPtr;
 
     HTTPs_SET_PTR_STATS(p_ctr_stats, p_instance);
     HTTPs_SET_PTR_ERRS( p_ctr_err,   p_instance);
@@ -2538,9 +2633,11 @@ void  HTTPsMem_RespHdrRelease (HTTPs_INSTANCE  *p_instance,
     switch(p_resp_hdr_blk->ValType) {
         case HTTP_HDR_VAL_TYPE_STR_DYN:
                                                                 /* -------------- RELEASE STR DATA BLK ---------------- */
-             Mem_DynPoolBlkFree(&p_instance->PoolRespHdrStr,
-                                 p_resp_hdr_blk->ValPtr,
-                                &err_lib);
+             HTTPsMem_TxnBlkFree( p_conn,
+                                 &p_instance->PoolRespHdrStr,
+                                  p_resp_hdr_blk->ValPtr,
+                                  p_cfg->HdrTxCfgPtr->DataLenMax,
+                                 &err_lib);
              if (err_lib != LIB_MEM_ERR_NONE) {
                  HTTPs_ERR_INC(p_ctr_err->Resp_ErrHdrBufPoolLibFreeCtr);
                  return;
@@ -2555,9 +2652,11 @@ void  HTTPsMem_RespHdrRelease (HTTPs_INSTANCE  *p_instance,
     }
 
                                                                 /* ----------- RELEASE RESP HDR FIELD BLK ------------- */
-    Mem_DynPoolBlkFree(&p_instance->PoolRespHdr,
-                        p_resp_hdr_blk,
-                       &err_lib);
+    HTTPsMem_TxnBlkFree( p_conn,
+                        &p_instance->PoolRespHdr,
+                         p_resp_hdr_blk,
+                         sizeof(HTTP_HDR_BLK),
+                        &err_lib);
     if (err_lib != LIB_MEM_ERR_NONE) {
         HTTPs_ERR_INC(p_ctr_err->Resp_ErrHdrPoolLibFreeCtr);
         return;
@@ -2646,7 +2745,7 @@ static  void  HTTPsMem_ReqHdrPoolInit (HTTPs_INSTANCE  *p_instance,
 #endif
 
     if (p_cfg->HdrRxCfgPtr->NbrPerConnMax != LIB_MEM_BLK_QTY_UNLIMITED) {
-        pool_size_max = p_cfg->ConnNbrMax * p_cfg->HdrRxCfgPtr->NbrPerConnMax;
+        pool_size_max = p_instance->ConnNbrMax * p_cfg->HdrRxCfgPtr->NbrPerConnMax;
     } else {
         pool_size_max = LIB_MEM_BLK_QTY_UNLIMITED;
     }
@@ -2769,7 +2868,7 @@ static  void  HTTPsMem_RespHdrPoolInit(HTTPs_INSTANCE  *p_instance,
 #endif
 
     if (p_cfg->HdrTxCfgPtr->NbrPerConnMax != LIB_MEM_BLK_QTY_UNLIMITED) {
-        pool_size_max = p_cfg->ConnNbrMax * p_cfg->HdrTxCfgPtr->NbrPerConnMax;
+        pool_size_max = p_instance->ConnNbrMax * p_cfg->HdrTxCfgPtr->NbrPerConnMax;
     } else {
         pool_size_max = LIB_MEM_BLK_QTY_UNLIMITED;
     }
@@ -2824,3 +2923,311 @@ static  void  HTTPsMem_RespHdrPoolInit(HTTPs_INSTANCE  *p_instance,
    *p_err = HTTPs_ERR_NONE;
 }
 #endif
+
+
+/*
+*********************************************************************************************************
+*                                      HTTPsMem_TxnArenaLenGet()
+*
+* Description : Compute the length of the per connection transaction arena.
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceStart().
+*
+* Return(s)   : Length of the transaction arena, if every transaction object has a per connection maximum.
+*
+*               0,                                 otherwise (the transaction objects are taken from the pools).
+*
+* Caller(s)   : HTTPsMem_ConnPoolInit().
+*
+* Note(s)     : (1) The arena is sized for the worst case where every transaction object is acquired up to its
+*                   configured maximum per connection. Request & response headers are counted separately since
+*                   the request headers are not always on top of the arena when they are released.
+*********************************************************************************************************
+*/
+
+static  CPU_SIZE_T  HTTPsMem_TxnArenaLenGet (HTTPs_INSTANCE  *p_instance)
+{
+    const  HTTPs_CFG   *p_cfg;
+           CPU_SIZE_T   len;
+
+
+    p_cfg = p_instance->CfgPtr;
+    len   = 0u;
+
+#if (HTTPs_CFG_TOKEN_PARSE_EN == DEF_ENABLED)
+    if (p_cfg->TokenCfgPtr != DEF_NULL) {
+        if (p_cfg->TokenCfgPtr->NbrPerConnMax == LIB_MEM_BLK_QTY_UNLIMITED) {
+            return (0u);
+        }
+        len += p_cfg->TokenCfgPtr->NbrPerConnMax
+            * (HTTPs_MEM_ALIGN_LEN(sizeof(HTTPs_TOKEN_CTRL))
+            +  HTTPs_MEM_ALIGN_LEN(p_cfg->TokenCfgPtr->ValLenMax + HTTP_STR_BUF_TOP_SPACE_REQ_MIN + HTTP_STR_BUF_END_SPACE_REQ_MIN));
+    }
+#endif
+
+#if (HTTPs_CFG_QUERY_STR_EN == DEF_ENABLED)
+    if (p_cfg->QueryStrCfgPtr != DEF_NULL) {
+        if (p_cfg->QueryStrCfgPtr->NbrPerConnMax == LIB_MEM_BLK_QTY_UNLIMITED) {
+            return (0u);
+        }
+        len += p_cfg->QueryStrCfgPtr->NbrPerConnMax
+            *  HTTPs_MEM_ALIGN_LEN(sizeof(HTTPs_KEY_VAL) + p_cfg->QueryStrCfgPtr->KeyLenMax + p_cfg->QueryStrCfgPtr->ValLenMax);
+    }
+#endif
+
+#if (HTTPs_CFG_FORM_EN == DEF_ENABLED)
+    if (p_cfg->FormCfgPtr != DEF_NULL) {
+        if (p_cfg->FormCfgPtr->NbrPerConnMax == LIB_MEM_BLK_QTY_UNLIMITED) {
+            return (0u);
+        }
+        len += p_cfg->FormCfgPtr->NbrPerConnMax
+            *  HTTPs_MEM_ALIGN_LEN(sizeof(HTTPs_KEY_VAL) + p_cfg->FormCfgPtr->KeyLenMax + p_cfg->FormCfgPtr->ValLenMax);
+    }
+#endif
+
+#if (HTTPs_CFG_HDR_RX_EN == DEF_ENABLED)
+    if (p_cfg->HdrRxCfgPtr != DEF_NULL) {
+        if (p_cfg->HdrRxCfgPtr->NbrPerConnMax == LIB_MEM_BLK_QTY_UNLIMITED) {
+            return (0u);
+        }
+        len += p_cfg->HdrRxCfgPtr->NbrPerConnMax
+            * (HTTPs_MEM_ALIGN_LEN(sizeof(HTTP_HDR_BLK))
+            +  HTTPs_MEM_ALIGN_LEN(p_cfg->HdrRxCfgPtr->DataLenMax));
+    }
+#endif
+
+#if (HTTPs_CFG_HDR_TX_EN == DEF_ENABLED)
+    if (p_cfg->HdrTxCfgPtr != DEF_NULL) {
+        if (p_cfg->HdrTxCfgPtr->NbrPerConnMax == LIB_MEM_BLK_QTY_UNLIMITED) {
+            return (0u);
+        }
+        len += p_cfg->HdrTxCfgPtr->NbrPerConnMax
+            * (HTTPs_MEM_ALIGN_LEN(sizeof(HTTP_HDR_BLK))
+            +  HTTPs_MEM_ALIGN_LEN(p_cfg->HdrTxCfgPtr->DataLenMax));
+    }
+#endif
+
+   (void)p_cfg;
+
+    return (len);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         HTTPsMem_TxnBlkGet()
+*
+* Description : Acquire a transaction object block from the connection transaction arena or from its pool.
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceStart().
+*
+*               p_conn      Pointer to the connection.
+*               ------      Argument validated in HTTPsSock_ConnAccept().
+*
+*               p_pool      Pointer to the pool to use when the connection has no transaction arena.
+*
+*               len         Length of the block.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_NONE            Block successfully acquired.
+*                               LIB_MEM_ERR_POOL_EMPTY      Transaction arena is full (see Note #1).
+*
+*                               ----------- RETURNED BY Mem_DynPoolBlkGet() -----------
+*                               See Mem_DynPoolBlkGet() for additional return error codes.
+*
+* Return(s)   : Pointer to the block, if no error(s).
+*
+*               Null pointer,         otherwise.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : (1) A full arena is reported like an empty pool so that the callers' pool exhaustion
+*                   accounting is preserved.
+*********************************************************************************************************
+*/
+
+static  void  *HTTPsMem_TxnBlkGet (HTTPs_INSTANCE  *p_instance,
+                                   HTTPs_CONN      *p_conn,
+                                   MEM_DYN_POOL    *p_pool,
+                                   CPU_SIZE_T       len,
+                                   LIB_ERR         *p_err)
+{
+    void        *p_blk;
+    CPU_SIZE_T   len_blk;
+
+
+    if (p_conn->TxnArenaPtr == DEF_NULL) {
+        p_blk = Mem_DynPoolBlkGet(p_pool, p_err);
+        return (p_blk);
+    }
+
+    len_blk = HTTPs_MEM_ALIGN_LEN(len);
+
+    if (len_blk > (p_instance->TxnArenaLen - p_conn->TxnArenaLenUsed)) {
+       *p_err = LIB_MEM_ERR_POOL_EMPTY;
+        return (DEF_NULL);
+    }
+
+    p_blk                    = p_conn->TxnArenaPtr + p_conn->TxnArenaLenUsed;
+    p_conn->TxnArenaLenUsed += len_blk;
+
+   *p_err = LIB_MEM_ERR_NONE;
+
+    return (p_blk);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        HTTPsMem_TxnBlkFree()
+*
+* Description : Release a transaction object block to the connection transaction arena or to its pool.
+*
+* Argument(s) : p_conn      Pointer to the connection.
+*               ------      Argument validated in HTTPsSock_ConnAccept().
+*
+*               p_pool      Pointer to the pool to use when the connection has no transaction arena.
+*
+*               p_blk       Pointer to the block to release.
+*
+*               len         Length of the block.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_NONE            Block successfully released.
+*
+*                               ----------- RETURNED BY Mem_DynPoolBlkFree() ----------
+*                               See Mem_DynPoolBlkFree() for additional return error codes.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : (1) Headers & tokens are released in the reverse order of their acquisition. The arena space
+*                   of a block located on top of the arena is therefore reclaimed right away. Any other block
+*                   is reclaimed when the transaction ends (see HTTPsMem_TxnArenaReset()).
+*********************************************************************************************************
+*/
+
+static  void  HTTPsMem_TxnBlkFree (HTTPs_CONN    *p_conn,
+                                   MEM_DYN_POOL  *p_pool,
+                                   void          *p_blk,
+                                   CPU_SIZE_T     len,
+                                   LIB_ERR       *p_err)
+{
+    CPU_SIZE_T  len_blk;
+
+
+    if (p_conn->TxnArenaPtr == DEF_NULL) {
+        Mem_DynPoolBlkFree(p_pool, p_blk, p_err);
+        return;
+    }
+
+    len_blk = HTTPs_MEM_ALIGN_LEN(len);
+                                                                /* Reclaim blk on top of the arena (see Note #1).       */
+    if ((CPU_INT08U *)p_blk + len_blk == p_conn->TxnArenaPtr + p_conn->TxnArenaLenUsed) {
+        p_conn->TxnArenaLenUsed -= len_blk;
+    }
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                       HTTPsMem_TxnArenaReset()
+*
+* Description : Release every transaction object block of the connection at once by resetting its transaction
+*               arena.
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceStart().
+*
+*               p_conn      Pointer to the connection.
+*               ------      Argument validated in HTTPsSock_ConnAccept().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPsMem_ConnClr().
+*
+* Note(s)     : (1) The lists are dropped without being walked. The release statistics are updated with the
+*                   number of blocks that were still in the lists.
+*********************************************************************************************************
+*/
+
+static  void  HTTPsMem_TxnArenaReset (HTTPs_INSTANCE  *p_instance,
+                                      HTTPs_CONN      *p_conn)
+{
+    HTTPs_INSTANCE_STATS  *p_ctr_stats;
+
+
+    if (p_conn->TxnArenaPtr == DEF_NULL) {                      /* Blks are released to the pools by the caller.        */
+        return;
+    }
+
+    HTTPs_SET_PTR_STATS(p_ctr_stats, p_instance);
+
+#if (HTTPs_CFG_QUERY_STR_EN == DEF_ENABLED)
+    HTTPs_STATS_OCTET_INC(p_ctr_stats->Req_StatKeyValReleaseCtr, p_conn->QueryStrBlkAcquiredCtr);
+    p_conn->QueryStrListPtr        = DEF_NULL;
+    p_conn->QueryStrBlkAcquiredCtr = 0u;
+#endif
+
+#if (HTTPs_CFG_FORM_EN == DEF_ENABLED)
+    HTTPs_STATS_OCTET_INC(p_ctr_stats->Req_StatKeyValReleaseCtr, p_conn->FormBlkAcquiredCtr);
+    p_conn->FormDataListPtr        = DEF_NULL;
+    p_conn->FormBlkAcquiredCtr     = 0u;
+#endif
+
+#if ((HTTPs_CFG_HDR_RX_EN == DEF_ENABLED) || \
+     (HTTPs_CFG_HDR_TX_EN == DEF_ENABLED))
+    if (p_conn->HdrType == HTTPs_HDR_TYPE_RESP) {
+        HTTPs_STATS_OCTET_INC(p_ctr_stats->Resp_StatHdrReleaseCtr, p_conn->HdrCtr);
+    } else {
+        HTTPs_STATS_OCTET_INC(p_ctr_stats->Req_StatHdrReleaseCtr,  p_conn->HdrCtr);
+    }
+    p_conn->HdrListPtr             = DEF_NULL;
+    p_conn->HdrCtr                 = 0u;
+#endif
+
+    p_conn->TxnArenaLenUsed        = 0u;
+
+   (void)p_ctr_stats;
+}
+
+
+/*
+*********************************************************************************************************
+*                                     HTTPsMem_DeflateBlkLenGet()
+*
+* Description : Get the length of a deflate block.
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceStart().
+*
+* Return(s)   : Length of the block.
+*
+* Caller(s)   : HTTPsMem_ConnPoolInit().
+*
+* Note(s)     : (1) See HTTPsMem_DeflateGet() Note #2.
+*********************************************************************************************************
+*/
+#if (HTTPs_CFG_DEFLATE_EN == DEF_ENABLED)
+static  CPU_SIZE_T  HTTPsMem_DeflateBlkLenGet (HTTPs_INSTANCE  *p_instance)
+{
+    const  HTTPs_DEFLATE_CFG  *p_cfg_deflate = p_instance->CfgPtr->DeflateCfgPtr;
+           CPU_SIZE_T          blk_len;
+
+
+    blk_len = HTTPs_MEM_ALIGN_LEN(sizeof(HTTPs_DEFLATE_CTX))
+            + HTTPs_MEM_ALIGN_LEN(p_cfg_deflate->HashTblLen * sizeof(CPU_INT16U))
+            + HTTPs_MEM_ALIGN_LEN(p_cfg_deflate->WinLen)
+            + p_instance->DeflateOutLenMax
+            + HTTPs_DEFLATE_CHUNK_OVERHEAD_LEN;
+
+    return (blk_len);
+}
+#endif
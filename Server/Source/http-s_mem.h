@@ -81,6 +81,12 @@ HTTPs_INSTANCE      *HTTPsMem_InstanceGet                 (HTTPs_ERR           *
 
 void                 HTTPsMem_InstanceRelease             (HTTPs_INSTANCE      *p_instance);
 
+void                *HTTPsMem_SockEvtDataGet              (CPU_SIZE_T           size,
+                                                           HTTPs_ERR           *p_err);
+
+void                 HTTPsMem_WorkerInit                  (HTTPs_INSTANCE      *p_instance,
+                                                           HTTPs_ERR           *p_err);
+
                                                                 /* Conn functionalities.                */
 void                 HTTPsMem_ConnPoolInit                (HTTPs_INSTANCE      *p_instance,
                                                            HTTPs_ERR           *p_err);
@@ -104,6 +110,14 @@ void                 HTTPsMem_TokenRelease                (HTTPs_INSTANCE      *
                                                            HTTPs_CONN          *p_conn);
 #endif
 
+#if (HTTPs_CFG_DEFLATE_EN == DEF_ENABLED)
+HTTPs_DEFLATE_CTX   *HTTPsMem_DeflateGet                  (HTTPs_INSTANCE      *p_instance,
+                                                           HTTPs_CONN          *p_conn);
+
+void                 HTTPsMem_DeflateRelease              (HTTPs_INSTANCE      *p_instance,
+                                                           HTTPs_CONN          *p_conn);
+#endif
+
 #if (HTTPs_CFG_QUERY_STR_EN == DEF_ENABLED)
 HTTPs_KEY_VAL       *HTTPsMem_QueryStrKeyValBlkGet        (HTTPs_INSTANCE      *p_instance,
                                                            HTTPs_CONN          *p_conn,
@@ -108,6 +108,34 @@ static  CPU_CHAR            *HTTPsReq_HdrParseValGet                 (CPU_CHAR
                                                                       CPU_CHAR         *p_field_end,
                                                                       CPU_INT16U       *p_len_rem);
 
+#if (HTTPs_CFG_HDR_RX_EN == DEF_ENABLED)
+static  void                 HTTPsReq_HdrBlkAdd                      (HTTPs_INSTANCE   *p_instance,
+                                                                      HTTPs_CONN       *p_conn,
+                                                                      HTTP_HDR_FIELD    field,
+                                                                      CPU_CHAR         *p_field,
+                                                                      CPU_CHAR         *p_field_end,
+                                                                      HTTPs_ERR        *p_err);
+#endif
+
+#if (HTTPs_CFG_CONTENT_CODING_EN == DEF_ENABLED)
+static  void                 HTTPsReq_HdrParseAcceptEncoding         (HTTPs_CONN       *p_conn,
+                                                                      CPU_CHAR         *p_val,
+                                                                      CPU_INT16U        len);
+#endif
+
+#if (HTTPs_CFG_COND_REQ_EN == DEF_ENABLED)
+static  void                 HTTPsReq_HdrParseIfNoneMatch            (HTTPs_CONN       *p_conn,
+                                                                      CPU_CHAR         *p_val,
+                                                                      CPU_INT16U        len);
+#endif
+
+static  CPU_CHAR            *HTTPsReq_RxDelimSrch                    (HTTPs_CONN       *p_conn,
+                                                                      CPU_CHAR         *p_str,
+                                                                      HTTP_STR_DELIM    delim_set);
+
+static  void                 HTTPsReq_PipelineSave                   (HTTPs_INSTANCE   *p_instance,
+                                                                      HTTPs_CONN       *p_conn);
+
 #if (HTTPs_CFG_FORM_EN == DEF_ENABLED)
 static  CPU_BOOLEAN          HTTPsReq_BodyForm                       (HTTPs_INSTANCE   *p_instance,
                                                                       HTTPs_CONN       *p_conn,
@@ -128,8 +156,9 @@ static  CPU_BOOLEAN          HTTPsReq_BodyFormMultipartParse         (HTTPs_INST
                                                                       HTTPs_CONN       *p_conn,
                                                                       HTTPs_ERR        *p_err);
 
-static  CPU_CHAR            *HTTPsReq_BodyFormMultipartBoundarySrch  (CPU_CHAR         *p_boundary,
-                                                                      CPU_INT08U        boundary_len,
+static  void                 HTTPsReq_BodyFormMultipartBoundaryTblBuild(HTTPs_CONN     *p_conn);
+
+static  CPU_CHAR            *HTTPsReq_BodyFormMultipartBoundarySrch  (HTTPs_CONN       *p_conn,
                                                                       CPU_CHAR         *p_buf,
                                                                       CPU_INT16U        buf_len,
                                                                       CPU_CHAR        **p_boundary_sep);
@@ -233,6 +262,11 @@ void  HTTPsReq_Handle (HTTPs_INSTANCE  *p_instance,
                           p_conn->State = HTTPs_CONN_STATE_REQ_PARSE_URI;    /* ...go to the next step.                  */
                           break;
 
+                     case HTTPs_ERR_REQ_MORE_DATA_REQUIRED:                  /* If more data is required to complete...  */
+                          p_conn->SockState = HTTPs_SOCK_STATE_RX;           /* ...the Method, exit the state machine.   */
+                          done              = DEF_YES;
+                          break;
+
                      default:                                                /* If the Method parsing has failed...      */
                           HTTPs_ERR_INC(p_ctr_err->Req_ErrInvalidCtr);       /* ...generate an error...                  */
                           p_conn->ErrCode   = err;
@@ -473,6 +507,9 @@ void  HTTPsReq_Handle (HTTPs_INSTANCE  *p_instance,
 *                           section 8.2.
 *
 *                           See section 15.1.3 for security considerations.
+*
+*               (3) Data received after the end of the request (i.e. pipelined requests) is removed from
+*                   the data available to the body parsers. See HTTPsReq_PipelineSave().
 *********************************************************************************************************
 */
 
@@ -506,12 +543,13 @@ void  HTTPsReq_Body (HTTPs_INSTANCE  *p_instance,
 
                  p_conn->ReqContentLenRxd = 0u;                 /* Clear the length of data received variable.          */
 
+                 HTTPsReq_PipelineSave(p_instance, p_conn);     /* Keep data rxd after the req (see Note #3).           */
+
                                                                 /* SET CONN STATE AND SOCKET STATE FOR BODY PARSING.    */
                  if (p_conn->ReqContentLen == 0) {              /* If all data received (no body) ...                   */
                                                                 /* ... jump to response preparation.                    */
                      p_conn->SockState   = HTTPs_SOCK_STATE_NONE;
                      p_conn->State       = HTTPs_CONN_STATE_REQ_READY_SIGNAL;
-                     p_conn->RxBufLenRem = 0;
                      done                = DEF_YES;
 
                  } else {                                       /* If a body is present in the request received:        */
@@ -806,6 +844,7 @@ CPU_BOOLEAN  HTTPsReq_RdySignal (HTTPs_INSTANCE  *p_instance,
 *
 *                           HTTPs_ERR_REQ_FORMAT_INV                Impossible to parse request headers.
 *                            HTTPs_ERR_REQ_METHOD_NOT_SUPPORTED      Method not supported.
+*                           HTTPs_ERR_REQ_MORE_DATA_REQUIRED        More data must be received.
 * Return(s)   : none.
 *
 * Caller(s)   : HTTPsReq_Handle().
@@ -835,6 +874,14 @@ CPU_BOOLEAN  HTTPsReq_RdySignal (HTTPs_INSTANCE  *p_instance,
 *                       server. The methods GET and HEAD MUST be supported by all general-purpose servers. All
 *                       other methods are OPTIONAL; however, if the above methods are implemented, they MUST be
 *                       implemented with the same semantics as those specified in section 9.
+*
+*               (3) A request can be split over several receive operations, e.g. when the beginning of a
+*                   pipelined request is kept from the previous transaction (see HTTPsReq_PipelineSave()).
+*                   More data is therefore received until the method is complete or the buffer is full.
+*
+*               (4) Data without any printable character can't start a request & is discarded so that the
+*                   buffer never fills up with it. The request header deadline still bounds a client that
+*                   sends nothing else.
 *********************************************************************************************************
 */
 
@@ -854,14 +901,16 @@ static  void  HTTPsReq_MethodParse (HTTPs_INSTANCE  *p_instance,
 
     len = p_conn->RxBufLenRem;
 
-    if (len <= sizeof(HTTP_STR_METHOD_GET)) {                   /* Check minimum length of RxBuf.                       */
-       *p_err = HTTPs_ERR_REQ_FORMAT_INVALID;
+    if (len <= sizeof(HTTP_STR_METHOD_GET)) {                   /* Check minimum length of RxBuf (see Note #3).         */
+       *p_err = HTTPs_ERR_REQ_MORE_DATA_REQUIRED;
         return;
     }
                                                                 /* Move the start ptr to the first printable ASCII char.*/
     p_request_method_start = HTTP_StrGraphSrchFirst(p_conn->RxBufPtr, len);
-    if (p_request_method_start == DEF_NULL) {
-       *p_err = HTTPs_ERR_REQ_FORMAT_INVALID;
+    if (p_request_method_start == DEF_NULL) {                   /* Discard the data (see Note #4).                      */
+        p_conn->RxBufPtr    += len;
+        p_conn->RxBufLenRem  = 0u;
+       *p_err = HTTPs_ERR_REQ_MORE_DATA_REQUIRED;
         return;
     }
 
@@ -869,9 +918,15 @@ static  void  HTTPsReq_MethodParse (HTTPs_INSTANCE  *p_instance,
 
     len -= skipped_chars;                                       /* Disregard illegal, non-printable ASCII characters.   */
                                                                 /* Find the end of method string.                       */
-    p_request_method_end =  Str_Char_N(p_request_method_start, len, ASCII_CHAR_SPACE);
+    p_request_method_end =  HTTP_StrDelimSrch(p_request_method_start,
+                                              len,
+                                             (HTTP_STR_DELIM_SPACE | HTTP_STR_DELIM_NULL));
     if (p_request_method_end == DEF_NULL) {
-       *p_err = HTTPs_ERR_REQ_FORMAT_INVALID;
+        if (p_conn->RxBufLenRem < p_conn->BufLen) {             /* If the buffer is not full ...                        */
+           *p_err = HTTPs_ERR_REQ_MORE_DATA_REQUIRED;           /* ... rx more data (see Note #3).                      */
+        } else {
+           *p_err = HTTPs_ERR_REQ_FORMAT_INVALID;
+        }
         return;
     }
 
@@ -1002,6 +1057,8 @@ static  void  HTTPsReq_MethodParse (HTTPs_INSTANCE  *p_instance,
 *                       order to properly interpret the request. Servers SHOULD respond to invalid Request-URIs with an
 *                       appropriate status code.
 *
+*               (2) The URI ends at the first space or at the '?' that starts the query string, whichever comes
+*                   first. Both are searched in the same pass over the request line.
 *********************************************************************************************************
 */
 
@@ -1027,18 +1084,22 @@ static  CPU_BOOLEAN  HTTPsReq_URI_Parse (HTTPs_INSTANCE  *p_instance,
        *p_err = HTTPs_ERR_REQ_FORMAT_INVALID;
         return (is_query_found);
     }
-                                                                /* Find the end of the URI including the potential...   */
-                                                                /* ...query str.                                        */
-    len -= p_request_uri_start - p_conn->RxBufPtr ;
-    p_request_uri_end =  Str_Char_N(p_request_uri_start, len, ASCII_CHAR_SPACE);
+                                                                /* Find the end of the URI or the '?' of the query...   */
+                                                                /* ...str in one pass (see Note #2).                    */
+    p_request_uri_end = HTTPsReq_RxDelimSrch(p_conn,
+                                             p_request_uri_start,
+                                            (HTTP_STR_DELIM_SPACE | HTTP_STR_DELIM_QUESTION_MARK));
+    p_request_uri_separator = DEF_NULL;
     if (p_request_uri_end != DEF_NULL) {
+        if (*p_request_uri_end == ASCII_CHAR_QUESTION_MARK) {
+            p_request_uri_separator = p_request_uri_end;
+        }
         len = p_request_uri_end - p_request_uri_start;          /* Recalculate the len to narrow the search.            */
     }
-                                                                /* Try to find a '?' for query string.                  */
-    p_request_uri_separator = Str_Char_N(p_request_uri_start, len, ASCII_CHAR_QUESTION_MARK);
+
     if (p_request_uri_separator == DEF_NULL) {                  /* If no query string or a full    URI is found...      */
         if (p_request_uri_end == DEF_NULL) {
-            if (p_conn->RxBufPtr != p_conn->BufPtr) {           /* ...and if the buffer is not full...                  */
+            if (p_conn->RxBufLenRem < p_conn->BufLen) {         /* ...and if the buffer is not full...                  */
                                                                 /* ... get more data.                                   */
                *p_err = HTTPs_ERR_REQ_MORE_DATA_REQUIRED;
             } else {
@@ -1135,6 +1196,15 @@ static  CPU_BOOLEAN  HTTPsReq_URI_Parse (HTTPs_INSTANCE  *p_instance,
 *                   characters are replaced by '%HH', a percent sign and two hexadecimal digits representing
 *                   the ASCII code of the character. Line breaks are represented as "CR LF" pairs
 *                   (i.e., '%0D%0A').
+*
+*               (4) Each field ends at the first '&', space or CRLF. The three are searched in a single pass,
+*                   so each character of the query string is only read once :
+*
+*                   (a) A space ends the query string.
+*
+*                   (b) A CRLF ends the request line before the end of the query string was found.
+*
+*                   (c) A CR that isn't followed by a LF is part of the field.
 *********************************************************************************************************
 */
 
@@ -1142,11 +1212,10 @@ static  void  HTTPsReq_QueryStrParse (HTTPs_INSTANCE  *p_instance,
                                       HTTPs_CONN      *p_conn,
                                       HTTPs_ERR       *p_err)
 {
-    CPU_CHAR     *p_req_line_end   = DEF_NULL;
-    CPU_CHAR     *p_query_str_end  = DEF_NULL;
     CPU_CHAR     *p_field_start    = DEF_NULL;
     CPU_CHAR     *p_field_end      = DEF_NULL;
     CPU_INT32U    len              = p_conn->RxBufLenRem;
+    CPU_INT32U    len_srch         = 0;
     CPU_INT32U    len_rd           = 0;
     CPU_INT32U    key_val_pair_len = 0;
     CPU_BOOLEAN   done             = DEF_NO;
@@ -1155,35 +1224,40 @@ static  void  HTTPsReq_QueryStrParse (HTTPs_INSTANCE  *p_instance,
 #endif
 
 
-                                                                /* Check for the end of the request line.               */
-    p_req_line_end = Str_Str_N(p_conn->RxBufPtr, STR_CR_LF, len);
-    if (p_req_line_end != DEF_NULL) {
-        len = p_req_line_end - p_conn->RxBufPtr;
-    }
-
-                                                                /* Check for the end of the query string.               */
-    p_query_str_end = Str_Char_N(p_conn->RxBufPtr, len, ASCII_CHAR_SPACE);
-    if (p_query_str_end != DEF_NULL) {
-        len = p_query_str_end - p_conn->RxBufPtr + 1;           /* If found, set the query length.                      */
-    }
-
     p_field_start = p_conn->RxBufPtr;
 
     while (done == DEF_NO) {
-                                                                /* Search for the query string char separator (&).      */
-        p_field_end = Str_Char_N(p_field_start, len, ASCII_CHAR_AMPERSAND);
-        if (p_field_end == DEF_NULL) {                          /* If not found, check if it's the last query string.   */
-            if (p_query_str_end == DEF_NULL) {
-                if (len == p_conn->BufLen) {
-                   *p_err = HTTPs_ERR_CFG_INVALID_BUF_LEN;
-                } else {
-                   *p_err = HTTPs_ERR_REQ_MORE_DATA_REQUIRED;
-                }
-                goto exit_update;
+                                                                /* Srch the end of the field (see Note #4).             */
+        p_field_end = HTTP_StrDelimSrch(p_field_start,
+                                        len,
+                                       (HTTP_STR_DELIM_AMPERSAND | HTTP_STR_DELIM_SPACE |
+                                        HTTP_STR_DELIM_CR        | HTTP_STR_DELIM_NULL));
+        while ((p_field_end  != DEF_NULL) &&
+               (*p_field_end == ASCII_CHAR_CARRIAGE_RETURN)) {
+            len_srch = len - (p_field_end - p_field_start + 1u);
+            if ((len_srch       >  0u) &&                       /* CRLF ends the req line (see Note #4b).               */
+                (p_field_end[1] == ASCII_CHAR_LINE_FEED)) {
+                len         = p_field_end - p_field_start;
+                p_field_end = DEF_NULL;
+            } else {                                            /* Lone CR is part of the field (see Note #4c).         */
+                p_field_end = HTTP_StrDelimSrch(p_field_end + 1,
+                                                len_srch,
+                                               (HTTP_STR_DELIM_AMPERSAND | HTTP_STR_DELIM_SPACE |
+                                                HTTP_STR_DELIM_CR        | HTTP_STR_DELIM_NULL));
+            }
+        }
+
+        if (p_field_end == DEF_NULL) {                          /* If not found, the query str end wasn't rx'd.         */
+            if (len == p_conn->BufLen) {
+               *p_err = HTTPs_ERR_CFG_INVALID_BUF_LEN;
             } else {
-                done        = DEF_YES;                          /* Last field of query string.                          */
-                p_field_end = p_query_str_end;
+               *p_err = HTTPs_ERR_REQ_MORE_DATA_REQUIRED;
             }
+            goto exit_update;
+        }
+
+        if (*p_field_end == ASCII_CHAR_SPACE) {                 /* Last field of query string (see Note #4a).           */
+            done = DEF_YES;
         }
 
                                                                 /* Get the length of the key-value pair found.          */
@@ -1388,15 +1462,16 @@ static  void  HTTPsReq_ProtocolVerParse (HTTPs_INSTANCE  *p_instance,
     }
 
     skipped_chars        = p_protocol_ver_start - p_conn->RxBufPtr;
-
-    len                 -= skipped_chars;                       /* Disregard illegal, non-printable ASCII characters.   */
-                                                                /* Find the end of the request line.                    */
-    p_protocol_ver_end   = Str_Str_N(p_protocol_ver_start, STR_CR_LF, len);
-                                                                /* Update RxBufLenRem to reflect nbr of skipped chars.  */
+                                                                /* Disregard illegal, non-printable ASCII characters.   */
     p_conn->RxBufLenRem -= skipped_chars;
+    p_conn->RxBufPtr     = p_protocol_ver_start;
+                                                                /* Find the end of the request line.                    */
+    p_protocol_ver_end   = HTTPsReq_RxDelimSrch(p_conn,
+                                                p_protocol_ver_start,
+                                                HTTP_STR_DELIM_CR);
 
     if (p_protocol_ver_end == DEF_NULL) {                       /* If not found, check to get more data.                */
-        if (p_conn->RxBufPtr != p_conn->BufPtr) {
+        if (p_conn->RxBufLenRem < p_conn->BufLen) {
            *p_err = HTTPs_ERR_REQ_MORE_DATA_REQUIRED;
         } else {
            *p_err = HTTPs_ERR_REQ_FORMAT_INVALID;
@@ -1540,6 +1615,13 @@ static  void  HTTPsReq_ProtocolVerParse (HTTPs_INSTANCE  *p_instance,
 *                   "Boundary delimiters must not appear within the encapsulated material, and must be no longer than 70 characters,
 *                    not counting the two leading hyphens."
 *
+*               (5) The Accept-Encoding header is parsed by the server to select a pre-compressed file variant,
+*                   but it is still offered to the OnReqHdrRxHook so that the application can keep it.
+*
+*               (6) The If-None-Match & If-Modified-Since headers are parsed by the server to answer
+*                   conditional requests (see HTTPsResp_FileOpen()). As in Note #5, they are still offered to
+*                   the OnReqHdrRxHook. An invalid If-Modified-Since date is ignored (RFC #7232, section 3.3).
+*
 *********************************************************************************************************
 */
 
@@ -1554,13 +1636,8 @@ static  void  HTTPsReq_HdrParse (HTTPs_INSTANCE  *p_instance,
            HTTP_HDR_FIELD         field;
            CPU_INT16U             len;
            HTTPs_INSTANCE_STATS  *p_ctr_stats;
-#if (HTTPs_CFG_HDR_RX_EN == DEF_ENABLED)
-           CPU_CHAR              *p_str;
-           HTTPs_INSTANCE_ERRS   *p_ctr_errs;
-           HTTP_DICT             *p_field_dict_entry;
-           HTTP_HDR_BLK          *p_req_hdr_blk;
-           HTTP_HDR_VAL_TYPE      val_type;
-           CPU_BOOLEAN            keep;
+#if (HTTPs_CFG_COND_REQ_EN == DEF_ENABLED)
+           CPU_BOOLEAN            valid;
 #endif
 #if ((HTTPs_CFG_FORM_EN           == DEF_ENABLED) && \
      (HTTPs_CFG_FORM_MULTIPART_EN == DEF_ENABLED))
@@ -1573,9 +1650,6 @@ static  void  HTTPsReq_HdrParse (HTTPs_INSTANCE  *p_instance,
 
 
     HTTPs_SET_PTR_STATS(p_ctr_stats, p_instance);
-#if (HTTPs_CFG_HDR_RX_EN == DEF_ENABLED)
-    HTTPs_SET_PTR_ERRS( p_ctr_errs,  p_instance);
-#endif
 
 #if ((HTTPs_CFG_HDR_RX_EN       == DEF_ENABLED) || \
      (HTTPs_CFG_ABSOLUTE_URI_EN == DEF_ENABLED))
@@ -1586,9 +1660,9 @@ static  void  HTTPsReq_HdrParse (HTTPs_INSTANCE  *p_instance,
 
     p_field = p_conn->RxBufPtr;                                 /* Ptr should be prev moved to beginning of req hdr.    */
     while (p_field  != DEF_NULL) {                              /* Analyze each field in the req hdr section.           */
-        p_field_end  = Str_Str_N(p_field,                       /* Find end of the field.                               */
-                                 STR_CR_LF,
-                                 p_conn->RxBufLenRem);
+        p_field_end  = HTTPsReq_RxDelimSrch(p_conn,             /* Find end of the field.                               */
+                                            p_field,
+                                            HTTP_STR_DELIM_CR);
 
 
                                                                 /* ------------------ ANALYZE FIELD ------------------- */
@@ -1603,12 +1677,6 @@ static  void  HTTPsReq_HdrParse (HTTPs_INSTANCE  *p_instance,
                                          len);
             if (field_key != HTTP_DICT_KEY_INVALID) {
                 field = (HTTP_HDR_FIELD)field_key;
-#if (HTTPs_CFG_HDR_RX_EN == DEF_ENABLED)
-                                                                /* Get field dictionary entry.                          */
-                p_field_dict_entry = HTTP_Dict_EntryGet(HTTP_Dict_HdrField,
-                                                        HTTP_Dict_HdrFieldSize,
-                                                        field);
-#endif
 
                                                                 /* ----------------- STO FIELD VALUE ------------------ */
                 switch (field) {
@@ -1698,6 +1766,8 @@ static  void  HTTPsReq_HdrParse (HTTPs_INSTANCE  *p_instance,
                                               p_conn->FormBoundaryPtr[len] = ASCII_CHAR_NULL;
 
                                               p_conn->FormBoundaryLen      = len;
+                                                                /* Prepare the boundary srch for the body.              */
+                                              HTTPsReq_BodyFormMultipartBoundaryTblBuild(p_conn);
                                           }
 #endif
                                           break;
@@ -1781,63 +1851,78 @@ static  void  HTTPsReq_HdrParse (HTTPs_INSTANCE  *p_instance,
                          break;
 
 
-                    default:
+#if (HTTPs_CFG_CONTENT_CODING_EN == DEF_ENABLED)
+                                                                /* ------------------ ACCEPT ENCODING ----------------- */
+                    case HTTP_HDR_FIELD_ACCEPT_ENCODING:
+                         p_val = HTTPsReq_HdrParseValGet(p_field,
+                                                         HTTP_STR_HDR_FIELD_ACCEPT_ENCODING_LEN,
+                                                         p_field_end,
+                                                        &len);
+                         if (p_val != DEF_NULL) {
+                             len = p_field_end - p_val;
+                             HTTPsReq_HdrParseAcceptEncoding(p_conn, p_val, len);
+                         }
+                                                                /* Hdr is also passed to the app (see Note #5).         */
 #if (HTTPs_CFG_HDR_RX_EN == DEF_ENABLED)
-                         if ((p_cfg->HdrRxCfgPtr != DEF_NULL) &&
-                             (p_cfg->HooksPtr    != DEF_NULL)) {
-                             keep = p_cfg->HooksPtr->OnReqHdrRxHook(p_instance,
-                                                                    p_conn,
-                                                                    p_cfg->Hooks_CfgPtr,
-                                                                    field);
+                         HTTPsReq_HdrBlkAdd(p_instance, p_conn, field, p_field, p_field_end, p_err);
+                         if (*p_err != HTTPs_ERR_NONE) {
+                             return;
+                         }
+#endif
+                         break;
+#endif
 
-                             if ((keep                              == DEF_YES                  ) &&
-                                 (p_cfg->HdrRxCfgPtr->NbrPerConnMax != LIB_MEM_BLK_QTY_UNLIMITED)) {
-                                 if (p_conn->HdrCtr >= p_cfg->HdrRxCfgPtr->NbrPerConnMax) {
-                                    *p_err = HTTPs_ERR_REQ_HDR_OVERFLOW;
-                                     return;
-                                 }
-                             }
 
-                             if (keep == DEF_YES) {
-                                val_type = HTTP_HDR_VAL_TYPE_STR_DYN;   /* Only string data type supported.             */
+#if (HTTPs_CFG_COND_REQ_EN == DEF_ENABLED)
+                                                                /* ------------------ IF NONE MATCH ------------------- */
+                    case HTTP_HDR_FIELD_IF_NONE_MATCH:
+                         p_val = HTTPsReq_HdrParseValGet(p_field,
+                                                         HTTP_STR_HDR_FIELD_IF_NONE_MATCH_LEN,
+                                                         p_field_end,
+                                                        &len);
+                         if (p_val != DEF_NULL) {
+                             len = p_field_end - p_val;
+                             HTTPsReq_HdrParseIfNoneMatch(p_conn, p_val, len);
+                         }
+                                                                /* Hdr is also passed to the app (see Note #6).         */
+#if (HTTPs_CFG_HDR_RX_EN == DEF_ENABLED)
+                         HTTPsReq_HdrBlkAdd(p_instance, p_conn, field, p_field, p_field_end, p_err);
+                         if (*p_err != HTTPs_ERR_NONE) {
+                             return;
+                         }
+#endif
+                         break;
 
-                                                                /* -------------- GET REQ HDR FIELD BLK --------------- */
-                                p_req_hdr_blk = HTTPsMem_ReqHdrGet(                p_instance,
-                                                                                   p_conn,
-                                                                   (HTTP_HDR_FIELD)field,
-                                                                                   val_type,
-                                                                                   p_err);
-                                if (p_req_hdr_blk == DEF_NULL) {
-                                    return;
-                                }
-
-                                p_val = HTTPsReq_HdrParseValGet(p_field,
-                                                                p_field_dict_entry->StrLen,
-                                                                p_field_end,
-                                                               &len);
-                                if (p_val != DEF_NULL) {
-                                    len = p_field_end - p_val;
-
-                                    if (len >= p_cfg->HdrRxCfgPtr->DataLenMax) {
-                                        HTTPs_ERR_INC(p_ctr_errs->Req_ErrHdrDataLenInv);
-                                       *p_err = HTTPS_ERR_REQ_HDR_INVALID_VAL_LEN;
-                                        return;
-                                    }
 
-                                                                /* ------------ UPDATE REQ HDR FIELD PARAM ------------ */
-                                    Mem_Copy((void       *) p_req_hdr_blk->ValPtr,
-                                             (const void *) p_val,
-                                             (CPU_SIZE_T  ) len);
-                                                                /* Store only string.                                   */
-                                    p_str                 = (CPU_CHAR *)p_req_hdr_blk->ValPtr + len;
-                                   *p_str                 =  ASCII_CHAR_NULL;
-                                    p_req_hdr_blk->ValLen =  len + 1;
-
-                                } else {
-                                   *p_err = HTTPs_ERR_REQ_MORE_DATA_REQUIRED;
-                                    return;
-                                }
-                            }
+                                                                /* ---------------- IF MODIFIED SINCE ----------------- */
+                    case HTTP_HDR_FIELD_IF_MODIFIED_SINCE:
+                         p_val = HTTPsReq_HdrParseValGet(p_field,
+                                                         HTTP_STR_HDR_FIELD_IF_MODIFIED_SINCE_LEN,
+                                                         p_field_end,
+                                                        &len);
+                         if (p_val != DEF_NULL) {
+                             len   = p_field_end - p_val;
+                             valid = HTTP_StrDateParse(p_val, len, &p_conn->CondReqTS);
+                             if (valid == DEF_OK) {             /* See Note #6.                                         */
+                                 DEF_BIT_SET(p_conn->CondFlags, HTTPs_FLAG_COND_REQ_MODIFIED_SINCE);
+                             }
+                         }
+                                                                /* Hdr is also passed to the app (see Note #6).         */
+#if (HTTPs_CFG_HDR_RX_EN == DEF_ENABLED)
+                         HTTPsReq_HdrBlkAdd(p_instance, p_conn, field, p_field, p_field_end, p_err);
+                         if (*p_err != HTTPs_ERR_NONE) {
+                             return;
+                         }
+#endif
+                         break;
+#endif
+
+
+                    default:
+#if (HTTPs_CFG_HDR_RX_EN == DEF_ENABLED)
+                         HTTPsReq_HdrBlkAdd(p_instance, p_conn, field, p_field, p_field_end, p_err);
+                         if (*p_err != HTTPs_ERR_NONE) {
+                             return;
                          }
 #endif
                          break;
@@ -1857,7 +1942,7 @@ static  void  HTTPsReq_HdrParse (HTTPs_INSTANCE  *p_instance,
             return;
 
         } else {                                                /* More data req'd to complete processing.              */
-            if (p_conn->RxBufPtr != p_conn->BufPtr) {           /* Check if the buffer is not full.                     */
+            if (p_conn->RxBufLenRem < p_conn->BufLen) {         /* Check if the buffer is not full.                     */
                *p_err = HTTPs_ERR_REQ_MORE_DATA_REQUIRED;
             } else {
                *p_err = HTTPs_ERR_REQ_FORMAT_INVALID;
@@ -1867,6 +1952,134 @@ static  void  HTTPsReq_HdrParse (HTTPs_INSTANCE  *p_instance,
     }
 }
 
+/*
+*********************************************************************************************************
+*                                         HTTPsReq_HdrBlkAdd()
+*
+* Description : Offer a request header field to the application & store its value if it is kept.
+*
+* Argument(s) : p_instance      Pointer to the instance.
+*               ----------      Argument validated in HTTPs_InstanceStart().
+*
+*               p_conn          Pointer to the connection.
+*               ------          Argument validated in HTTPsSock_ConnAccept().
+*
+*               field           Header field type.
+*
+*               p_field         Pointer to the beginning of the field line.
+*               -------         Argument validated in HTTPsReq_HdrParse().
+*
+*               p_field_end     Pointer to the end of the field line.
+*               -----------     Argument validated in HTTPsReq_HdrParse().
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   HTTPs_ERR_NONE                          Header field processed.
+*
+*                                   HTTPs_ERR_REQ_HDR_OVERFLOW              Too many header fields kept.
+*                                   HTTPS_ERR_REQ_HDR_INVALID_VAL_LEN       Header field value too long.
+*                                   HTTPs_ERR_REQ_MORE_DATA_REQUIRED        Header field value not found.
+*
+*                                   ---------- RETURNED BY HTTPsMem_ReqHdrGet() : ----------
+*                                   See HTTPsMem_ReqHdrGet() for additional return error codes.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPsReq_HdrParse().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+#if (HTTPs_CFG_HDR_RX_EN == DEF_ENABLED)
+static  void  HTTPsReq_HdrBlkAdd (HTTPs_INSTANCE  *p_instance,
+                                  HTTPs_CONN      *p_conn,
+                                  HTTP_HDR_FIELD   field,
+                                  CPU_CHAR        *p_field,
+                                  CPU_CHAR        *p_field_end,
+                                  HTTPs_ERR       *p_err)
+{
+    const  HTTPs_CFG             *p_cfg;
+           HTTPs_INSTANCE_ERRS   *p_ctr_errs;
+           HTTP_DICT             *p_field_dict_entry;
+           HTTP_HDR_BLK          *p_req_hdr_blk;
+           HTTP_HDR_VAL_TYPE      val_type;
+           CPU_CHAR              *p_val;
+           CPU_CHAR              *p_str;
+           CPU_INT16U             len;
+           CPU_BOOLEAN            keep;
+
+
+    HTTPs_SET_PTR_ERRS(p_ctr_errs, p_instance);
+
+    p_cfg = p_instance->CfgPtr;
+
+   *p_err = HTTPs_ERR_NONE;
+
+    if ((p_cfg->HdrRxCfgPtr == DEF_NULL) ||
+        (p_cfg->HooksPtr    == DEF_NULL)) {
+        return;
+    }
+
+    keep = p_cfg->HooksPtr->OnReqHdrRxHook(p_instance,
+                                           p_conn,
+                                           p_cfg->Hooks_CfgPtr,
+                                           field);
+    if (keep != DEF_YES) {
+        return;
+    }
+
+    if (p_cfg->HdrRxCfgPtr->NbrPerConnMax != LIB_MEM_BLK_QTY_UNLIMITED) {
+        if (p_conn->HdrCtr >= p_cfg->HdrRxCfgPtr->NbrPerConnMax) {
+           *p_err = HTTPs_ERR_REQ_HDR_OVERFLOW;
+            return;
+        }
+    }
+
+    val_type = HTTP_HDR_VAL_TYPE_STR_DYN;                       /* Only string data type supported.                     */
+
+                                                                /* -------------- GET REQ HDR FIELD BLK --------------- */
+    p_req_hdr_blk = HTTPsMem_ReqHdrGet(p_instance,
+                                       p_conn,
+                                       field,
+                                       val_type,
+                                       p_err);
+    if (p_req_hdr_blk == DEF_NULL) {
+        return;
+    }
+                                                                /* Get field dictionary entry.                          */
+    p_field_dict_entry = HTTP_Dict_EntryGet(HTTP_Dict_HdrField,
+                                            HTTP_Dict_HdrFieldSize,
+                                            field);
+
+    p_val = HTTPsReq_HdrParseValGet(p_field,
+                                    p_field_dict_entry->StrLen,
+                                    p_field_end,
+                                   &len);
+    if (p_val == DEF_NULL) {
+       *p_err = HTTPs_ERR_REQ_MORE_DATA_REQUIRED;
+        return;
+    }
+
+    len = p_field_end - p_val;
+    if (len >= p_cfg->HdrRxCfgPtr->DataLenMax) {
+        HTTPs_ERR_INC(p_ctr_errs->Req_ErrHdrDataLenInv);
+       *p_err = HTTPS_ERR_REQ_HDR_INVALID_VAL_LEN;
+        return;
+    }
+
+                                                                /* ------------ UPDATE REQ HDR FIELD PARAM ------------ */
+    Mem_Copy((void       *) p_req_hdr_blk->ValPtr,
+             (const void *) p_val,
+             (CPU_SIZE_T  ) len);
+                                                                /* Store only string.                                   */
+    p_str                 = (CPU_CHAR *)p_req_hdr_blk->ValPtr + len;
+   *p_str                 =  ASCII_CHAR_NULL;
+    p_req_hdr_blk->ValLen =  len + 1;
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                   HTTPsReq_HdrParseFieldValGet()
@@ -1924,7 +2137,9 @@ static  CPU_CHAR  *HTTPsReq_HdrParseValGet (CPU_CHAR    *p_field,
     p_val     =  p_field + field_len;
     len       = (p_field_end - p_val);
 
-    p_val     =  Str_Char_N(p_val, len, ASCII_CHAR_COLON);      /* Field val located after ':' (see Note #1a).          */
+    p_val     =  HTTP_StrDelimSrch(p_val,                       /* Field val located after ':' (see Note #1a).          */
+                                   len,
+                                  (HTTP_STR_DELIM_COLON | HTTP_STR_DELIM_NULL));
     p_val++;
 
     len       = (p_field_end - p_val);
@@ -1936,6 +2151,447 @@ static  CPU_CHAR  *HTTPsReq_HdrParseValGet (CPU_CHAR    *p_field,
 }
 
 
+/*
+*********************************************************************************************************
+*                                   HTTPsReq_HdrParseAcceptEncoding()
+*
+* Description : Parse the codings of an Accept-Encoding header value.
+*
+* Argument(s) : p_conn      Pointer to the connection.
+*               ------      Argument validated in HTTPsSock_ConnAccept().
+*
+*               p_val       Pointer to the beginning of the field value.
+*               -----       Argument validated in HTTPsReq_HdrParse().
+*
+*               len         Field value length.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPsReq_HdrParse().
+*
+* Note(s)     : (1) RFC #7231, section "5.3.4 Accept-Encoding" states that :
+*
+*                       Accept-Encoding  = #( codings [ weight ] )
+*                       codings          = content-coding / "identity" / "*"
+*
+*                   (a) A coding with a qvalue of 0 is "not acceptable". Any other qvalue accepts the coding;
+*                       the server doesn't rank the accepted codings by qvalue (see HTTPsResp_FileOpen()).
+*
+*                   (b) "*" matches any available coding not explicitly listed in the header field.
+*
+*               (2) Accepted codings are accumulated in 'ContentCodingFlags', so that a request with several
+*                   Accept-Encoding headers accepts the codings of all of them.
+*********************************************************************************************************
+*/
+
+#if (HTTPs_CFG_CONTENT_CODING_EN == DEF_ENABLED)
+static  void  HTTPsReq_HdrParseAcceptEncoding (HTTPs_CONN  *p_conn,
+                                               CPU_CHAR    *p_val,
+                                               CPU_INT16U   len)
+{
+    CPU_CHAR     *p_end;
+    CPU_CHAR     *p_coding;
+    CPU_CHAR     *p_coding_end;
+    CPU_CHAR     *p_next;
+    CPU_CHAR     *p_char;
+    CPU_INT32U    coding_key;
+    CPU_INT16U    coding_len;
+    HTTP_DICT    *p_entry;
+    HTTPs_FLAGS   coding_flag;
+    HTTPs_FLAGS   flags_listed;
+    HTTPs_FLAGS   flags_accepted;
+    CPU_BOOLEAN   any;
+    CPU_BOOLEAN   q_zero;
+
+
+    p_end          = p_val + len;
+    flags_listed   = HTTPs_FLAG_NONE;
+    flags_accepted = HTTPs_FLAG_NONE;
+    any            = DEF_NO;
+
+    while (p_val < p_end) {
+                                                                /* ------------------ FIND NEXT CODING ---------------- */
+        p_next = Str_Char_N(p_val, (p_end - p_val), ASCII_CHAR_COMMA);
+        if (p_next == DEF_NULL) {
+            p_next = p_end;
+        }
+
+        p_coding = p_val;
+        while ((p_coding < p_next) &&
+               ((*p_coding == ASCII_CHAR_SPACE) || (*p_coding == ASCII_CHAR_CHARACTER_TABULATION))) {
+            p_coding++;
+        }
+
+        p_coding_end = p_coding;
+        while (( p_coding_end <  p_next)                          &&
+               (*p_coding_end != ASCII_CHAR_SEMICOLON)            &&
+               (*p_coding_end != ASCII_CHAR_SPACE)                &&
+               (*p_coding_end != ASCII_CHAR_CHARACTER_TABULATION)) {
+            p_coding_end++;
+        }
+        coding_len = p_coding_end - p_coding;
+
+                                                                /* ------------------ PARSE QVALUE -------------------- */
+        q_zero = DEF_NO;                                        /* See Note #1a.                                        */
+        p_char = Str_Char_N(p_coding_end, (p_next - p_coding_end), ASCII_CHAR_SEMICOLON);
+        if (p_char != DEF_NULL) {
+            p_char++;
+            while ((p_char < p_next) &&
+                   ((*p_char == ASCII_CHAR_SPACE) || (*p_char == ASCII_CHAR_CHARACTER_TABULATION))) {
+                p_char++;
+            }
+            if (((p_char + 2)            <  p_next)                   &&
+                (ASCII_TO_LOWER(*p_char) == ASCII_CHAR_LATIN_LOWER_Q) &&
+                (p_char[1]               == ASCII_CHAR_EQUALS_SIGN)   &&
+                (p_char[2]               == ASCII_CHAR_DIGIT_ZERO)) {
+                q_zero  = DEF_YES;
+                p_char += 3;
+                if ((p_char < p_next) && (*p_char == ASCII_CHAR_FULL_STOP)) {
+                    p_char++;
+                    while ((p_char < p_next) && (ASCII_IS_DIG(*p_char) == DEF_YES)) {
+                        if (*p_char != ASCII_CHAR_DIGIT_ZERO) {
+                            q_zero = DEF_NO;
+                        }
+                        p_char++;
+                    }
+                }
+            }
+        }
+
+                                                                /* ------------------- MATCH CODING ------------------- */
+        if ((coding_len == 1u) &&
+            (*p_coding  == ASCII_CHAR_ASTERISK)) {              /* See Note #1b.                                        */
+            any = (q_zero == DEF_NO) ? DEF_YES : DEF_NO;
+
+        } else if (coding_len > 0u) {
+            coding_key  = HTTP_Dict_KeyGet(HTTP_Dict_HdrFieldContentCodingVal,
+                                           HTTP_Dict_HdrFieldContentCodingValSize,
+                                           p_coding,
+                                           DEF_NO,
+                                           coding_len);
+            coding_flag = HTTPs_FLAG_NONE;
+            if (coding_key != HTTP_DICT_KEY_INVALID) {          /* Dict entries are matched over the shortest len.      */
+                p_entry = HTTP_Dict_EntryGet(HTTP_Dict_HdrFieldContentCodingVal,
+                                             HTTP_Dict_HdrFieldContentCodingValSize,
+                                             coding_key);
+                if ((p_entry         != DEF_NULL) &&
+                    (p_entry->StrLen == coding_len)) {
+                    switch (coding_key) {
+                        case HTTP_HDR_FIELD_CONTENT_CODING_GZIP:
+                             coding_flag = HTTPs_FLAG_CONTENT_CODING_REQ_GZIP;
+                             break;
+
+                        case HTTP_HDR_FIELD_CONTENT_CODING_BR:
+                             coding_flag = HTTPs_FLAG_CONTENT_CODING_REQ_BR;
+                             break;
+
+                        default:
+                             break;
+                    }
+                }
+            }
+
+            DEF_BIT_SET(flags_listed, coding_flag);
+            if (q_zero == DEF_NO) {
+                DEF_BIT_SET(flags_accepted, coding_flag);
+            }
+        }
+
+        p_val = p_next + 1;
+    }
+
+    if (any == DEF_YES) {
+        DEF_BIT_SET(flags_accepted, (HTTPs_FLAG_CONTENT_CODING_REQ_ALL & ~flags_listed));
+    }
+                                                                /* See Note #2.                                         */
+    DEF_BIT_SET(p_conn->ContentCodingFlags, flags_accepted);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                    HTTPsReq_HdrParseIfNoneMatch()
+*
+* Description : Parse the entity tags of an If-None-Match header value.
+*
+* Argument(s) : p_conn      Pointer to the connection.
+*               ------      Argument validated in HTTPsSock_ConnAccept().
+*
+*               p_val       Pointer to the beginning of the field value.
+*               -----       Argument validated in HTTPsReq_HdrParse().
+*
+*               len         Field value length.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPsReq_HdrParse().
+*
+* Note(s)     : (1) RFC #7232, section "3.2 If-None-Match" states that :
+*
+*                       If-None-Match = "*" / 1#entity-tag
+*                       entity-tag    = [ weak ] opaque-tag
+*                       weak          = %x57.2F ; "W/", case-sensitive
+*
+*                   (a) The weak comparison function MUST be used, so that the weakness indicator is ignored.
+*
+*                   (b) Once the header is received, If-Modified-Since MUST be ignored. The header is flagged
+*                       even when none of its tags was issued by the server, so that the full resp is sent.
+*
+*               (2) The server issues a tag per file variant (see 'http-s.h  CONDITIONAL REQUEST DEFINES'), so
+*                   any tag of the list may match the file that is requested. The tags of that format are
+*                   kept, up to HTTPs_COND_REQ_TAG_NBR_MAX; the other tags are ignored.
+*********************************************************************************************************
+*/
+
+#if (HTTPs_CFG_COND_REQ_EN == DEF_ENABLED)
+static  void  HTTPsReq_HdrParseIfNoneMatch (HTTPs_CONN  *p_conn,
+                                            CPU_CHAR    *p_val,
+                                            CPU_INT16U   len)
+{
+    CPU_CHAR    *p_end;
+    CPU_CHAR    *p_tag;
+    CPU_CHAR    *p_next;
+    CPU_INT32U   nbr[2];
+    CPU_INT08U   dig_ix;
+    CPU_INT08U   dig_val;
+    CPU_CHAR     c;
+
+
+                                                                /* See Note #1b.                                        */
+    DEF_BIT_SET(p_conn->CondFlags, HTTPs_FLAG_COND_REQ_NONE_MATCH);
+
+    p_end = p_val + len;
+    while (p_val < p_end) {
+                                                                /* -------------------- FIND NEXT TAG ----------------- */
+        p_next = Str_Char_N(p_val, (p_end - p_val), ASCII_CHAR_COMMA);
+        if (p_next == DEF_NULL) {
+            p_next = p_end;
+        }
+
+        p_tag = p_val;
+        while ((p_tag < p_next) &&
+               ((*p_tag == ASCII_CHAR_SPACE) || (*p_tag == ASCII_CHAR_CHARACTER_TABULATION))) {
+            p_tag++;
+        }
+
+        if ((p_tag < p_next) && (*p_tag == ASCII_CHAR_ASTERISK)) {
+            DEF_BIT_SET(p_conn->CondFlags, HTTPs_FLAG_COND_REQ_NONE_MATCH_ANY);
+            return;
+        }
+
+        if (((p_tag + 2) <= p_next)                   &&
+            ( p_tag[0]   == ASCII_CHAR_LATIN_UPPER_W) &&
+            ( p_tag[1]   == ASCII_CHAR_SOLIDUS)) {              /* Skip weakness indicator (see Note #1a).              */
+            p_tag += 2;
+        }
+
+                                                                /* ------------------- PARSE SERVER TAG --------------- */
+        if (((p_tag + HTTPs_ETAG_STR_LEN)   <= p_next)                   &&
+            ( p_tag[0]                       == ASCII_CHAR_QUOTATION_MARK) &&
+            ( p_tag[HTTPs_ETAG_STR_LEN - 1u] == ASCII_CHAR_QUOTATION_MARK)) {
+            nbr[0] = 0u;
+            nbr[1] = 0u;
+            for (dig_ix = 0u; dig_ix < (2u * HTTPs_ETAG_HEX_DIG_LEN); dig_ix++) {
+                c = p_tag[dig_ix + 1u];
+                if (ASCII_IS_DIG(c) == DEF_YES) {
+                    dig_val = c - ASCII_CHAR_DIGIT_ZERO;
+                } else if ((ASCII_TO_LOWER(c) >= ASCII_CHAR_LATIN_LOWER_A) &&
+                           (ASCII_TO_LOWER(c) <= ASCII_CHAR_LATIN_LOWER_F)) {
+                    dig_val = (ASCII_TO_LOWER(c) - ASCII_CHAR_LATIN_LOWER_A) + 10u;
+                } else {
+                    break;
+                }
+                nbr[dig_ix / HTTPs_ETAG_HEX_DIG_LEN] = (nbr[dig_ix / HTTPs_ETAG_HEX_DIG_LEN] << 4u) | dig_val;
+            }
+
+            if ((dig_ix                == (2u * HTTPs_ETAG_HEX_DIG_LEN)) &&
+                (p_conn->CondReqTagNbr <  HTTPs_COND_REQ_TAG_NBR_MAX )) {   /* See Note #2.                             */
+                p_conn->CondReqTagTbl[p_conn->CondReqTagNbr]     = nbr[0];
+                p_conn->CondReqTagSizeTbl[p_conn->CondReqTagNbr] = nbr[1];
+                p_conn->CondReqTagNbr++;
+                DEF_BIT_SET(p_conn->CondFlags, HTTPs_FLAG_COND_REQ_NONE_MATCH_TAG);
+            }
+        }
+
+        p_val = p_next + 1;
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        HTTPsReq_RxDelimSrch()
+*
+* Description : Search the received data for the delimiter that ends the token being parsed.
+*
+* Argument(s) : p_conn      Pointer to the connection.
+*               ------      Argument validated in HTTPsSock_ConnAccept().
+*
+*               p_str       Pointer to the beginning of the token, within the received data.
+*
+*               delim_set   Set of delimiters that end the token (see HTTP_StrDelimSrch()).
+*
+* Return(s)   : Pointer to the delimiter, if found.
+*
+*               DEF_NULL,                 otherwise.
+*
+* Caller(s)   : HTTPsReq_URI_Parse(),
+*               HTTPsReq_ProtocolVerParse(),
+*               HTTPsReq_HdrParse().
+*
+* Note(s)     : (1) When a token is split across receptions, the parser is called again with the same token
+*                   once more data is received. The length of the received data already searched is kept in
+*                   'RxBufScanLen', relative to 'RxBufPtr', so that the search resumes with the new data:
+*
+*                   (a) 'RxBufScanLen' is cleared when the delimiter is found, since the caller then consumes
+*                       the token.
+*
+*                   (b) The callers MUST NOT move 'RxBufPtr' between a search that fails & the next one.
+*
+*               (2) A CR only ends the token when it's followed by a LF. A CR received last is searched again
+*                   with the next data.
+*
+*               (3) The search stops at a NULL character, like Str_Char_N() & Str_Str_N(); the token is never
+*                   found.
+*********************************************************************************************************
+*/
+
+static  CPU_CHAR  *HTTPsReq_RxDelimSrch (HTTPs_CONN      *p_conn,
+                                         CPU_CHAR        *p_str,
+                                         HTTP_STR_DELIM   delim_set)
+{
+    CPU_CHAR  *p_srch;
+    CPU_CHAR  *p_rx_end;
+    CPU_CHAR  *p_delim;
+
+
+    p_rx_end = p_conn->RxBufPtr + p_conn->RxBufLenRem;
+    p_srch   = p_conn->RxBufPtr + p_conn->RxBufScanLen;         /* Resume after the data already srch'd (see Note #1).  */
+    if (p_srch < p_str) {
+        p_srch = p_str;
+    }
+
+    while (p_srch < p_rx_end) {
+        p_delim = HTTP_StrDelimSrch(p_srch,
+                                    p_rx_end - p_srch,
+                                   (delim_set | HTTP_STR_DELIM_NULL));
+        if (p_delim == DEF_NULL) {                              /* Srch'd up to the end or the NULL char (see Note #3). */
+            p_srch += Str_Len_N(p_srch, p_rx_end - p_srch);
+            break;
+        }
+
+        if (*p_delim != ASCII_CHAR_CARRIAGE_RETURN) {
+            p_conn->RxBufScanLen = 0u;                          /* See Note #1a.                                        */
+            return (p_delim);
+        }
+                                                                /* ---------------- CRLF (see Note #2) ---------------- */
+        if (p_delim + 1 >= p_rx_end) {                          /* LF not rxd yet.                                      */
+            p_srch = p_delim;
+            break;
+        }
+
+        if (p_delim[1] == ASCII_CHAR_LINE_FEED) {
+            p_conn->RxBufScanLen = 0u;
+            return (p_delim);
+        }
+
+        p_srch = p_delim + 1;                                   /* Lone CR is part of the token.                        */
+    }
+
+    p_conn->RxBufScanLen = (CPU_INT16U)(p_srch - p_conn->RxBufPtr);
+
+    return (DEF_NULL);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       HTTPsReq_PipelineSave()
+*
+* Description : (1) Keep the data received after the end of the request for the next transaction:
+*
+*                   (a) Remove the data from the data available to the body parsers.
+*                   (b) Move the data to the end of the connection buffer.
+*                   (c) Reduce the connection buffer length so the response doesn't overwrite it.
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceStart().
+*
+*               p_conn      Pointer to the connection.
+*               ------      Argument validated in HTTPsSock_ConnAccept().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPsReq_Body().
+*
+* Note(s)     : (2) RFC #7230, Section 6.3.2 'Pipelining' states that a client that supports persistent
+*                   connections MAY pipeline its requests and that the server MUST send the corresponding
+*                   responses in the same order that the requests were received. Since a connection processes
+*                   a single transaction at a time, responses are always transmitted in order.
+*
+*               (3) The data is kept only when:
+*
+*                   (a) The connection is persistent; otherwise it is closed after the response.
+*
+*                   (b) The request has no body. Requests with a body need the whole buffer for the body
+*                       parsers (see HTTPs_InstanceStart() form configuration validation).
+*
+*                   (c) It uses at most half of the buffer, so that the response keeps enough space.
+*
+*                   Otherwise, the data is discarded and the connection is closed after the response, so
+*                   that the client sends the unanswered requests again (see RFC #7230, Section 6.3.2).
+*
+*               (4) The data kept is restored as received data by HTTPsMem_ConnClr().
+*********************************************************************************************************
+*/
+
+static  void  HTTPsReq_PipelineSave (HTTPs_INSTANCE  *p_instance,
+                                     HTTPs_CONN      *p_conn)
+{
+#if (HTTPs_CFG_PERSISTENT_CONN_EN == DEF_ENABLED)
+    const  HTTPs_CFG             *p_cfg = p_instance->CfgPtr;
+           HTTPs_INSTANCE_STATS  *p_ctr_stats;
+           CPU_BOOLEAN            persistent;
+#endif
+           HTTPs_INSTANCE_ERRS   *p_ctr_err;
+           CPU_CHAR              *p_next;
+           CPU_INT16U             len_next;
+
+
+    HTTPs_SET_PTR_ERRS(p_ctr_err, p_instance);
+
+    if (p_conn->RxBufLenRem <= p_conn->ReqContentLen) {         /* No data after the req in the buf.                    */
+        return;
+    }
+                                                                /* Remove next req from the body data (see Note #1a).   */
+    len_next            = p_conn->RxBufLenRem - (CPU_INT16U)p_conn->ReqContentLen;
+    p_next              = p_conn->RxBufPtr    + p_conn->ReqContentLen;
+    p_conn->RxBufLenRem = (CPU_INT16U)p_conn->ReqContentLen;
+
+#if (HTTPs_CFG_PERSISTENT_CONN_EN == DEF_ENABLED)
+    HTTPs_SET_PTR_STATS(p_ctr_stats, p_instance);
+
+    persistent = DEF_BIT_IS_SET(p_conn->Flags, HTTPs_FLAG_CONN_PERSISTENT);
+    if ((p_cfg->ConnPersistentEn == DEF_ENABLED)          &&    /* See Note #3.                                         */
+        (persistent              == DEF_YES)              &&
+        (p_conn->ReqContentLen   == 0u)                   &&
+        (len_next                <= (p_conn->BufLen / 2u))) {
+                                                                /* Move next req at the end of the buf (see Note #1b).  */
+        p_conn->BufLen -= len_next;
+        Mem_Move(p_conn->BufPtr + p_conn->BufLen, p_next, len_next);
+        HTTPs_STATS_INC(p_ctr_stats->Req_StatPipelinedCtr);
+        return;
+    }
+
+    DEF_BIT_CLR(p_conn->Flags, HTTPs_FLAG_CONN_PERSISTENT);     /* Close the conn after the resp (see Note #3).         */
+#endif
+    HTTPs_ERR_INC(p_ctr_err->Req_ErrPipelineDiscardCtr);
+   (void)p_next;
+}
+
+
 /*
 *********************************************************************************************************
 *                                         HTTPsReq_BodyForm()
@@ -2103,9 +2759,9 @@ static  CPU_BOOLEAN  HTTPsReq_BodyFormAppParse (HTTPs_INSTANCE  *p_instance,
 
     while (done != DEF_YES) {
                                                                 /* ----------- VALIDATE CUR KEY/VAL PAIRS ------------- */
-        p_key_next = Str_Char_N(p_key_name,                     /* Srch beginning of next key/val pairs.                */
-                                p_conn->RxBufLenRem,
-                                ASCII_CHAR_AMPERSAND);
+        p_key_next = HTTP_StrDelimSrch(p_key_name,              /* Srch beginning of next key/val pairs.                */
+                                       p_conn->RxBufLenRem,
+                                      (HTTP_STR_DELIM_AMPERSAND | HTTP_STR_DELIM_NULL));
 
         if (p_key_next == DEF_NULL) {                           /* If next key/val pairs not found ...                  */
                                                                 /* ... determine if all data are received or next ...   */
@@ -2369,98 +3025,170 @@ exit:
 #endif
 
 
+/*
+*********************************************************************************************************
+*                             HTTPsReq_BodyFormMultipartBoundaryTblBuild()
+*
+* Description : Build the skip table of the boundary search.
+*
+* Argument(s) : p_conn      Pointer to the connection.
+*               ------      Argument validated in HTTPsSock_ConnAccept().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPsReq_HdrParse().
+*
+* Note(s)     : (1) The boundary is searched with the Boyer-Moore-Horspool algorithm; the pattern is the
+*                   boundary preceded by "--". For each octet value, the table holds the distance between the
+*                   last occurrence of the octet in the pattern, excluding its last octet, and the end of the
+*                   pattern. The pattern length is used for the octets that aren't in the pattern.
+*
+*               (2) The table is built once per request and is used for the whole body.
+*********************************************************************************************************
+*/
+#if ((HTTPs_CFG_FORM_EN           == DEF_ENABLED) && \
+     (HTTPs_CFG_FORM_MULTIPART_EN == DEF_ENABLED))
+static  void  HTTPsReq_BodyFormMultipartBoundaryTblBuild (HTTPs_CONN  *p_conn)
+{
+    CPU_INT08U  *p_tbl;
+    CPU_INT08U   pattern_len;
+    CPU_INT08U   ix;
+
+
+    p_tbl       = p_conn->FormBoundarySkipTblPtr;
+    pattern_len = HTTPs_STR_MULTIPART_DATA_START_LEN + p_conn->FormBoundaryLen;
+
+    Mem_Set(p_tbl, pattern_len, HTTPs_FORM_BOUNDARY_SKIP_TBL_LEN);
+
+    for (ix = 0u; ix < (pattern_len - 1u); ix++) {
+        if (ix < HTTPs_STR_MULTIPART_DATA_START_LEN) {          /* "--" before the boundary.                            */
+            p_tbl[(CPU_INT08U)ASCII_CHAR_HYPHEN_MINUS] = pattern_len - 1u - ix;
+        } else {
+            p_tbl[(CPU_INT08U)p_conn->FormBoundaryPtr[ix - HTTPs_STR_MULTIPART_DATA_START_LEN]] = pattern_len - 1u - ix;
+        }
+    }
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                               HTTPsReq_BodyFormMultipartBoundarySrch()
 *
 * Description : Search for first boundary in data buffer.
 *
-* Argument(s) : p_boundary      Pointer to string that contains the boundary to search for.
-*
-*               boundary_len    Boundary length.
+* Argument(s) : p_conn          Pointer to the connection.
+*               ------          Argument validated in HTTPsSock_ConnAccept().
 *
 *               p_buf           Pointer to buffer where to start to search in.
 *
 *               buf_len         Buffer length.
 *
-*               p_boundary_sep  Pointer that will be set if the buffer end with possible beginning of a boundary.
+*               p_boundary_sep  Pointer that will be set to the "--" before the boundary, if found. Otherwise, set
+*                               to the possible beginning of a boundary at the end of the buffer, or to a null
+*                               pointer if the buffer can't end with the beginning of a boundary.
 *
 * Return(s)   : Pointer to the boundary, if successfully found.
 *
 *               Null pointer, otherwise.
 *
-* Caller(s)   : HTTPsReq_BodyFormMultipartParse().
+* Caller(s)   : HTTPsReq_BodyFormMultipartCtrlParse(),
+*               HTTPsReq_BodyFormMultipartFileWr().
 *
-* Note(s)     : none.
+* Note(s)     : (1) The "--" & boundary are searched with the skip table built by
+*                   HTTPsReq_BodyFormMultipartBoundaryTblBuild(). The pattern is only compared where its last
+*                   octet matches; otherwise, the search skips ahead by the table value of the buffer octet
+*                   aligned with the end of the pattern.
+*
+*               (2) If the boundary isn't found, the end of the buffer is checked for the beginning of the
+*                   boundary delimiter (CRLF, "--" & boundary). Only the octets that can be part of the
+*                   delimiter, plus the two octets that the callers keep before the separator, are left for
+*                   the next search; the data already searched isn't searched again.
 *********************************************************************************************************
 */
 #if ((HTTPs_CFG_FORM_EN           == DEF_ENABLED) && \
      (HTTPs_CFG_FORM_MULTIPART_EN == DEF_ENABLED))
-static  CPU_CHAR  *HTTPsReq_BodyFormMultipartBoundarySrch (CPU_CHAR     *p_boundary,
-                                                           CPU_INT08U    boundary_len,
+static  CPU_CHAR  *HTTPsReq_BodyFormMultipartBoundarySrch (HTTPs_CONN   *p_conn,
                                                            CPU_CHAR     *p_buf,
                                                            CPU_INT16U    buf_len,
                                                            CPU_CHAR    **p_boundary_sep)
 {
-    CPU_CHAR    *p_boundary_found;
-    CPU_CHAR    *p_str;
-    CPU_INT16U   len;
-
-
-   (void)p_boundary_sep;
+    CPU_CHAR     *p_boundary;
+    CPU_INT08U   *p_tbl;
+    CPU_CHAR     *p_boundary_found;
+    CPU_CHAR      char_last;
+    CPU_CHAR      char_pattern;
+    CPU_INT08U    boundary_len;
+    CPU_INT08U    pattern_len;
+    CPU_INT16U    pos;
+    CPU_INT16U    len;
+    CPU_INT16U    ix;
+    CPU_BOOLEAN   match;
+
+
+    p_boundary_found = DEF_NULL;
+   *p_boundary_sep   = DEF_NULL;
 
     if (buf_len <= 0)  {
-       *p_boundary_sep = DEF_NULL;
-        p_boundary_found = DEF_NULL;
         goto exit;
     }
 
-    p_str = DEF_NULL;
-    len   = HTTPs_STR_MULTIPART_DATA_START_LEN;
-
-    p_str = HTTPs_StrMemSrch(p_buf,                             /* Search for boundary separator in the buffer.         */
-                             buf_len,
-                             HTTPs_STR_MULTIPART_DATA_START,
-                             len);
-    if (p_str == DEF_NULL) {
-        if ((p_buf[buf_len - 1] == ASCII_CHAR_CARRIAGE_RETURN) ||
-            (p_buf[buf_len - 1] == ASCII_CHAR_LINE_FEED)       ||
-            (p_buf[buf_len - 1] == ASCII_CHAR_HYPHEN_MINUS)   ) {
-            *p_boundary_sep   = p_buf + buf_len - 1;
-             p_boundary_found = DEF_NULL;
-             goto exit;
-        } else {
-            *p_boundary_sep   = DEF_NULL;
-             p_boundary_found = DEF_NULL;
-             goto exit;
+    p_boundary   = p_conn->FormBoundaryPtr;
+    p_tbl        = p_conn->FormBoundarySkipTblPtr;
+    boundary_len = p_conn->FormBoundaryLen;
+    pattern_len  = HTTPs_STR_MULTIPART_DATA_START_LEN + boundary_len;
+
+    if (boundary_len > 0u) {
+        char_last = p_boundary[boundary_len - 1u];
+    } else {
+        char_last = ASCII_CHAR_HYPHEN_MINUS;
+    }
+                                                                /* --------- SRCH "--" & BOUNDARY (see Note #1) ------- */
+    pos = 0u;
+    while ((pos + pattern_len) <= buf_len) {
+        if ((p_buf[pos + pattern_len - 1u] == char_last)               &&
+            (p_buf[pos]                    == ASCII_CHAR_HYPHEN_MINUS) &&
+            (p_buf[pos + 1u]               == ASCII_CHAR_HYPHEN_MINUS)) {
+            match = Mem_Cmp(&p_buf[pos + HTTPs_STR_MULTIPART_DATA_START_LEN],
+                             p_boundary,
+                             boundary_len);
+            if (match == DEF_YES) {
+               *p_boundary_sep   = &p_buf[pos];
+                p_boundary_found = &p_buf[pos + HTTPs_STR_MULTIPART_DATA_START_LEN];
+                goto exit;
+            }
         }
+        pos += p_tbl[(CPU_INT08U)p_buf[pos + pattern_len - 1u]];
+    }
+                                                                /* ------ SRCH PARTIAL DELIMITER (see Note #2) -------- */
+    len = HTTPs_STR_MULTIPART_DATA_END_LEN + boundary_len;      /* Delimiter len.                                       */
+    if (buf_len >= len) {
+        pos = buf_len - len + 1u;
+    } else {
+        pos = 0u;
     }
 
-   *p_boundary_sep = p_str;
-
-    len = buf_len - (p_str - p_buf);
-    if (len > boundary_len) {
-        p_boundary_found = HTTPs_StrMemSrch(p_str,              /* Search for boundary in the buffer.                   */
-                                            len,
-                                            p_boundary,
-                                            boundary_len);
-
-        p_str = p_buf + buf_len - boundary_len - HTTPs_STR_MULTIPART_DATA_START_LEN;
-
-                                                                /* Boundary is not found :                              */
-        if (( p_boundary_found == DEF_NULL) &&                  /* Case when separator "--" is found inside data, ...   */
-            (*p_boundary_sep    <  p_str)  ) {                  /* ... set separator before end of buffer in case ...   */
-                                                                /* ... start of boundary is at the end of buffer.       */
-             *p_boundary_sep = p_str;
+    for (; pos < buf_len; pos++) {
+        if (p_buf[pos] != ASCII_CHAR_CARRIAGE_RETURN) {
+            continue;
         }
-                                                                /* Boundary is found :                                  */
-        if (p_boundary_found != DEF_NULL) {                     /* Insure that separator "--" is just before boundary...*/
-           *p_boundary_sep = p_boundary_found - 2;              /* ... and not in data.                                 */
+
+        match = DEF_YES;
+        for (ix = 1u; ((pos + ix) < buf_len) && (match == DEF_YES); ix++) {
+            if (ix < HTTPs_STR_MULTIPART_DATA_END_LEN) {
+                char_pattern = HTTPs_STR_MULTIPART_DATA_END[ix];
+            } else {
+                char_pattern = p_boundary[ix - HTTPs_STR_MULTIPART_DATA_END_LEN];
+            }
+            if (p_buf[pos + ix] != char_pattern) {
+                match = DEF_NO;
+            }
         }
 
-    } else {
-        p_boundary_found = DEF_NULL;
-        goto exit;
+        if (match == DEF_YES) {
+           *p_boundary_sep = &p_buf[pos];
+            goto exit;
+        }
     }
 
 
@@ -2541,8 +3269,7 @@ static  CPU_BOOLEAN  HTTPsReq_BodyFormMultipartCtrlParse (HTTPs_INSTANCE  *p_ins
         case HTTPs_CONN_STATE_REQ_BODY_FORM_MULTIPART_INIT:
 
                                                                 /* Search for boundary token in the buffer.             */
-             p_boundary = HTTPsReq_BodyFormMultipartBoundarySrch(p_conn->FormBoundaryPtr,
-                                                                 p_conn->FormBoundaryLen,
+             p_boundary = HTTPsReq_BodyFormMultipartBoundarySrch(p_conn,
                                                                  p_conn->RxBufPtr,
                                                                  p_conn->RxBufLenRem,
                                                                 &p_boundary_sep);
@@ -2901,8 +3628,7 @@ static  CPU_BOOLEAN  HTTPsReq_BodyFormMultipartFileWr (HTTPs_INSTANCE  *p_instan
         case HTTPs_CONN_STATE_REQ_BODY_FORM_MULTIPART_FILE_WR:
              p_boundary_sep = DEF_NULL;
                                                                /* Search for boundary token in the buffer.             */
-             p_boundary = HTTPsReq_BodyFormMultipartBoundarySrch(p_conn->FormBoundaryPtr,
-                                                                 p_conn->FormBoundaryLen,
+             p_boundary = HTTPsReq_BodyFormMultipartBoundarySrch(p_conn,
                                                                  p_conn->RxBufPtr,
                                                                  p_conn->RxBufLenRem,
                                                                 &p_boundary_sep);
@@ -3017,7 +3743,11 @@ exit:
 * Caller(s)   : HTTPsReq_BodyFormAppKeyValBlkAdd(),
 *               HTTPsReq_QueryStrKeyValBlkAdd().
 *
-* Note(s)     : None.
+* Note(s)     : (1) The key & value are URL decoded straight from the receive buffer into the Key-Value block
+*                   strings. Since decoding never lengthens a string, limiting the source length to the
+*                   configured maximum also bounds the decoded length.
+*
+*               (2) A field without '=' has no key; the whole string is the value (HTTPs_KEY_VAL_TYPE_VAL).
 *********************************************************************************************************
 */
 #if ((HTTPs_CFG_QUERY_STR_EN == DEF_ENABLED) || \
@@ -3061,15 +3791,17 @@ static  CPU_BOOLEAN  HTTPsReq_URL_EncodeStrParse (HTTPs_INSTANCE  *p_instance,
     }
 
                                                                 /* Find separator "=".                                  */
-    p_str_sep = Str_Char_N(p_str, str_len, ASCII_CHAR_EQUALS_SIGN);
+    p_str_sep = HTTP_StrDelimSrch(p_str,
+                                  str_len,
+                                 (HTTP_STR_DELIM_EQUALS_SIGN | HTTP_STR_DELIM_NULL));
 
     p_str[str_len] = ASCII_CHAR_NULL;
 
     if (p_str_sep != DEF_NULL) {
         p_val = p_str_sep + 1;
         p_key = p_str;
-    } else {
-        p_val = p_str_sep;
+    } else {                                                    /* See Note #2.                                         */
+        p_val = p_str;
         p_key = DEF_NULL;
     }
 
@@ -3079,10 +3811,13 @@ static  CPU_BOOLEAN  HTTPsReq_URL_EncodeStrParse (HTTPs_INSTANCE  *p_instance,
 
         key_len = p_str_sep - p_key;
         key_len = DEF_MIN(key_len, key_len_cfg);
-
-        Str_Copy_N(p_key_val->KeyPtr,
-                   p_key,
-                   key_len);
+                                                                /* Decode while copying (see Note #1).                  */
+        result  = HTTP_URL_DecodeStr(p_key,
+                                     p_key_val->KeyPtr,
+                                    &key_len);
+        if (result == DEF_FAIL) {
+            return (DEF_FAIL);
+        }
 
         p_key_val->DataType = HTTPs_KEY_VAL_TYPE_PAIR;
 
@@ -3099,24 +3834,15 @@ static  CPU_BOOLEAN  HTTPsReq_URL_EncodeStrParse (HTTPs_INSTANCE  *p_instance,
     val_len = p_str + str_len - p_val;
     val_len = DEF_MIN(val_len, val_len_cfg);
 
-    Str_Copy_N(p_key_val->ValPtr,
-               p_val,
-               val_len);
-
-    p_key_val->ValPtr[val_len] = ASCII_CHAR_NULL;
-    p_key_val->ValLen          = val_len;
-
-    result = HTTP_URL_DecodeReplaceStr(p_key_val->KeyPtr,
-                                      &p_key_val->KeyLen);
+    result  = HTTP_URL_DecodeStr(p_val,
+                                 p_key_val->ValPtr,
+                                &val_len);
     if (result == DEF_FAIL) {
         return (DEF_FAIL);
     }
 
-    result = HTTP_URL_DecodeReplaceStr(p_key_val->ValPtr,
-                                      &p_key_val->ValLen);
-    if (result == DEF_FAIL) {
-        return (DEF_FAIL);
-    }
+    p_key_val->ValPtr[val_len] = ASCII_CHAR_NULL;
+    p_key_val->ValLen          = val_len;
 
     return (DEF_OK);
 }
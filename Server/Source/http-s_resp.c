@@ -38,6 +38,7 @@
 #include  "http-s_resp.h"
 #include  "http-s_mem.h"
 #include  "http-s_str.h"
+#include  "http-s_deflate.h"
 
 
 /*
@@ -106,6 +107,16 @@ static  CPU_SIZE_T           HTTPsResp_WrChunkedToBuf             (       CPU_CH
                                                                           CPU_SIZE_T                 data_len,
                                                                           CPU_SIZE_T                 len_dig_str_len);
 
+#if (HTTPs_CFG_DEFLATE_EN == DEF_ENABLED)
+static  void                 HTTPsResp_DeflateChunkWr             (       HTTPs_INSTANCE            *p_instance,
+                                                                          HTTPs_CONN                *p_conn,
+                                                                   const  CPU_CHAR                  *p_data,
+                                                                          CPU_SIZE_T                 data_len,
+                                                                   const  CPU_CHAR                  *p_data_ext,
+                                                                          CPU_SIZE_T                 data_ext_len,
+                                                                          CPU_BOOLEAN                last);
+#endif
+
 #if (HTTPs_CFG_TOKEN_PARSE_EN == DEF_ENABLED)
 static  CPU_BOOLEAN          HTTPsResp_DataTransferChunked        (       HTTPs_INSTANCE            *p_instance,
                                                                           HTTPs_CONN                *p_conn,
@@ -133,6 +144,21 @@ static  CPU_BOOLEAN          HTTPsResp_FileOpen                   (       HTTPs_
                                                                           HTTPs_CONN                *p_conn);
 #endif
 
+#if ((HTTPs_CFG_FS_PRESENT_EN       == DEF_ENABLED) && \
+     (HTTPs_CFG_CONTENT_CODING_EN    == DEF_ENABLED))
+static  void                *HTTPsResp_FileOpenCoded              (const  NET_FS_API                *p_fs_api,
+                                                                          CPU_CHAR                  *p_file_path,
+                                                                          CPU_SIZE_T                 path_len_max,
+                                                                   const  CPU_CHAR                  *p_ext);
+#endif
+
+#if ((HTTPs_CFG_FS_PRESENT_EN       == DEF_ENABLED) && \
+     (HTTPs_CFG_COND_REQ_EN          == DEF_ENABLED))
+static  void                 HTTPsResp_FileCondProcess            (       HTTPs_INSTANCE            *p_instance,
+                                                                          HTTPs_CONN                *p_conn,
+                                                                   const  NET_FS_API                *p_fs_api);
+#endif
+
 static  CPU_SIZE_T           HTTPsResp_DataRd                     (       HTTPs_INSTANCE            *p_instance,
                                                                           HTTPs_CONN                *p_conn,
                                                                           CPU_CHAR                  *p_dst,
@@ -279,7 +305,11 @@ exit:
 *
 * Caller(s)   : HTTPsConn_Process().
 *
-* Note(s)     : none.
+* Note(s)     : (2) When the header section is completed and the body is transferred with the standard
+*                   transfer, the first part of the body is read right after the header section in the
+*                   connection buffer so that the status line, the headers and the body are transmitted
+*                   with a single socket transmit call. Small responses therefore leave in one segment
+*                   instead of a header segment followed by a body segment.
 *********************************************************************************************************
 */
 
@@ -293,6 +323,7 @@ CPU_BOOLEAN  HTTPsResp_Handle (HTTPs_INSTANCE  *p_instance,
     CPU_BOOLEAN            body_present  = DEF_NO;
     CPU_BOOLEAN            chunk_en      = DEF_NO;
     CPU_BOOLEAN            chunk_hook_en = DEF_NO;
+    CPU_BOOLEAN            file_tx       = DEF_NO;
     HTTPs_ERR              err;
 
 
@@ -315,10 +346,11 @@ CPU_BOOLEAN  HTTPsResp_Handle (HTTPs_INSTANCE  *p_instance,
                                                                 /* 'break' intentionally omitted; MUST execute the ...  */
                                                                 /* ... following case :                            ...  */
                                                                 /* ... 'HTTPs_CONN_STATE_RESP_HDR'.                     */
-                                                                /* no break                                             */
         case HTTPs_CONN_STATE_RESP_HDR:
         case HTTPs_CONN_STATE_RESP_HDR_CONTENT_TYPE:
+        case HTTPs_CONN_STATE_RESP_HDR_CONTENT_CODING:
         case HTTPs_CONN_STATE_RESP_HDR_FILE_TRANSFER:
+        case HTTPs_CONN_STATE_RESP_HDR_VALIDATOR:
         case HTTPs_CONN_STATE_RESP_HDR_LOCATION:
         case HTTPs_CONN_STATE_RESP_HDR_CONN:
         case HTTPs_CONN_STATE_RESP_HDR_LIST:
@@ -358,9 +390,11 @@ CPU_BOOLEAN  HTTPsResp_Handle (HTTPs_INSTANCE  *p_instance,
                       p_conn->SockState = HTTPs_SOCK_STATE_NONE;
                       goto exit;
              }
-             break;
-
-
+             if (p_conn->State != HTTPs_CONN_STATE_RESP_FILE_STD) {
+                 break;
+             }
+                                                                /* 'break' intentionally omitted; body data is ...      */
+                                                                /* ... appended to the hdr section (see Note #2).       */
         case HTTPs_CONN_STATE_RESP_FILE_STD:
                                                                 /* ---------------- STANDARD TRANSFER ----------------- */
              body_done = HTTPsResp_DataTransferStd(p_instance, p_conn, &err);
@@ -369,7 +403,9 @@ CPU_BOOLEAN  HTTPsResp_Handle (HTTPs_INSTANCE  *p_instance,
                       if (body_done == DEF_YES) {
                           p_conn->State = HTTPs_CONN_STATE_RESP_COMPLETED;
                       }
-                      if (p_conn->TxDataLen > 0) {
+                      file_tx = DEF_BIT_IS_SET(p_conn->Flags, HTTPs_FLAG_RESP_FILE_TX);
+                      if ((p_conn->TxDataLen > 0) ||
+                          (file_tx           == DEF_YES)) {
                           p_conn->SockState = HTTPs_SOCK_STATE_TX;
                       } else {
                           p_conn->SockState = HTTPs_SOCK_STATE_NONE;
@@ -430,7 +466,11 @@ CPU_BOOLEAN  HTTPsResp_Handle (HTTPs_INSTANCE  *p_instance,
                       if (body_done == DEF_YES) {
                           p_conn->State = HTTPs_CONN_STATE_RESP_COMPLETED;
                       }
-                      p_conn->SockState = HTTPs_SOCK_STATE_TX;
+                      if (p_conn->TxDataLen > 0) {              /* A compressed chunk may be empty.                     */
+                          p_conn->SockState = HTTPs_SOCK_STATE_TX;
+                      } else {
+                          p_conn->SockState = HTTPs_SOCK_STATE_NONE;
+                      }
                       break;
 
                  default:
@@ -460,6 +500,11 @@ CPU_BOOLEAN  HTTPsResp_Handle (HTTPs_INSTANCE  *p_instance,
                  if (p_conn->TokenCtrlPtr != DEF_NULL) {
                      HTTPsMem_TokenRelease(p_instance, p_conn);
                  }
+#endif
+#if (HTTPs_CFG_DEFLATE_EN == DEF_ENABLED)
+                 if (p_conn->DeflateCtxPtr != DEF_NULL) {
+                     HTTPsMem_DeflateRelease(p_instance, p_conn);
+                 }
 #endif
              } else {                                           /* Complete tx before closing.                          */
                  p_conn->SockState = HTTPs_SOCK_STATE_TX;
@@ -547,6 +592,7 @@ void  HTTPsResp_DataComplete (HTTPs_INSTANCE  *p_instance,
                  HTTPs_ERR_INC(p_ctr_errs->File_ErrCloseNoFS_Ctr);
              }
              p_conn->DataPtr = DEF_NULL;
+             DEF_BIT_CLR(p_conn->Flags, HTTPs_FLAG_RESP_FILE_TX);
              break;
 
         case HTTPs_BODY_DATA_TYPE_NONE:
@@ -802,16 +848,25 @@ static  CPU_BOOLEAN  HTTPsResp_PrepareStatusCode (HTTPs_INSTANCE  *p_instance,
 *
 * Caller(s)   : HTTPsResp_Prepare().
 *
-* Note(s)     : none.
+* Note(s)     : (1) The file is opened once the transfer encoding is known, since a pre-compressed variant
+*                   of the file is only opened for a response that is not chunked (see HTTPsResp_FileOpen()).
+*
+*               (2) A chunked text response is compressed on the fly when the client accepts gzip & a deflate
+*                   block is available. Otherwise, the response is sent as is. In both cases, the response
+*                   depends on 'Accept-Encoding' & must carry a Vary header.
 *********************************************************************************************************
 */
 
 static  CPU_BOOLEAN  HTTPsResp_PrepareBodyData (HTTPs_INSTANCE  *p_instance,
                                                 HTTPs_CONN      *p_conn)
 {
-#if (HTTPs_CFG_TOKEN_PARSE_EN == DEF_ENABLED)
+#if ((HTTPs_CFG_TOKEN_PARSE_EN == DEF_ENABLED) || \
+     (HTTPs_CFG_DEFLATE_EN     == DEF_ENABLED))
     const  HTTPs_CFG            *p_cfg            = p_instance->CfgPtr;
            CPU_BOOLEAN           chunk_en         = DEF_NO;
+#endif
+#if (HTTPs_CFG_DEFLATE_EN == DEF_ENABLED)
+           HTTPs_DEFLATE_CTX    *p_deflate_ctx;
 #endif
            CPU_BOOLEAN           is_body_data_rdy = DEF_NO;
            HTTPs_INSTANCE_ERRS  *p_ctr_err;
@@ -829,11 +884,6 @@ static  CPU_BOOLEAN  HTTPsResp_PrepareBodyData (HTTPs_INSTANCE  *p_instance,
                  goto exit;
              }
 
-             is_body_data_rdy = HTTPsResp_FileOpen(p_instance,  /* Open file.                                           */
-                                                   p_conn);
-             if (is_body_data_rdy != DEF_YES) {
-                 goto exit;
-             }
                                                                 /* Get Content Type from file extension.                */
              if (p_conn->RespContentType == HTTP_CONTENT_TYPE_UNKNOWN) {
                  p_conn->RespContentType = HTTP_GetContentTypeFromFileExt(p_conn->PathPtr,
@@ -859,6 +909,12 @@ static  CPU_BOOLEAN  HTTPsResp_PrepareBodyData (HTTPs_INSTANCE  *p_instance,
 #else
              DEF_BIT_CLR(p_conn->Flags, HTTPs_FLAG_RESP_CHUNKED);
 #endif
+
+             is_body_data_rdy = HTTPsResp_FileOpen(p_instance,  /* Open file (see Note #1).                             */
+                                                   p_conn);
+             if (is_body_data_rdy != DEF_YES) {
+                 goto exit;
+             }
 #else
              HTTPs_ERR_INC(p_ctr_err->File_ErrOpenNoFS_Ctr);
              is_body_data_rdy = DEF_NO;
@@ -922,6 +978,29 @@ exit:
         return (DEF_FAIL);
     }
 
+#if (HTTPs_CFG_DEFLATE_EN == DEF_ENABLED)
+                                                                /* ------------- SET STREAMING COMPRESSION ------------ */
+    chunk_en = DEF_BIT_IS_SET_ANY(p_conn->Flags, (HTTPs_FLAG_RESP_CHUNKED | HTTPs_FLAG_RESP_CHUNKED_HOOK));
+    if ( (p_cfg->DeflateCfgPtr    != DEF_NULL)                         &&
+         (p_conn->RespBodyDataType != HTTPs_BODY_DATA_TYPE_NONE)        &&
+         (chunk_en                 == DEF_YES)                          &&
+        ((p_conn->RespContentType  == HTTP_CONTENT_TYPE_HTML)           ||
+         (p_conn->RespContentType  == HTTP_CONTENT_TYPE_PLAIN)          ||
+         (p_conn->RespContentType  == HTTP_CONTENT_TYPE_CSS)            ||
+         (p_conn->RespContentType  == HTTP_CONTENT_TYPE_JS)             ||
+         (p_conn->RespContentType  == HTTP_CONTENT_TYPE_JSON))) {
+                                                                /* See Note #2.                                         */
+        DEF_BIT_SET(p_conn->ContentCodingFlags, HTTPs_FLAG_CONTENT_CODING_RESP_VARY);
+
+        if (DEF_BIT_IS_SET(p_conn->ContentCodingFlags, HTTPs_FLAG_CONTENT_CODING_REQ_GZIP) == DEF_YES) {
+            p_deflate_ctx = HTTPsMem_DeflateGet(p_instance, p_conn);
+            if (p_deflate_ctx != DEF_NULL) {
+                DEF_BIT_SET(p_conn->ContentCodingFlags, HTTPs_FLAG_CONTENT_CODING_RESP_GZIP);
+            }
+        }
+    }
+#endif
+
     return (DEF_OK);
 }
 
@@ -1085,12 +1164,14 @@ static  void  HTTPsResp_StatusLine (HTTPs_INSTANCE  *p_instance,
 * Description : (1) Prepare response headers:
 *
 *                   (a) Add content type   header field
-*                   (b) Add content transfer header field
+*                   (b) Add content coding header fields (Content-Encoding & Vary)
+*                   (c) Add content transfer header field
 *                       (i)  Content length
 *                       (ii) Transfer Encoding
 *
-*                   (c) Add location       header field
-*                   (d) Add connection     header field
+*                   (d) Add validator      header fields (ETag & Last-Modified)
+*                   (e) Add location       header field
+*                   (f) Add connection     header field
 *                   (3) Copy end of response section
 *
 * Argument(s) : p_instance  Pointer to the instance.
@@ -1140,6 +1221,14 @@ static  void  HTTPsResp_StatusLine (HTTPs_INSTANCE  *p_instance,
 *                       semantics of response- header fields if all parties in the communication recognize them
 *                       to be response-header fields. Unrecognized header fields are treated as entity-header
 *                       fields.
+*
+*               (4) The Content-Encoding & Vary header fields are written by the same state. The buffer
+*                   position is only updated once both fields are copied, so that they are both copied again
+*                   when the buffer runs out of space between them. The ETag & Last-Modified header fields
+*                   are written the same way.
+*
+*               (5) A response without body, such as '304 Not Modified', skips the content type & content
+*                   transfer header fields but keeps the Vary & validator header fields.
 *********************************************************************************************************
 */
 
@@ -1171,7 +1260,7 @@ static  void  HTTPsResp_Hdr (HTTPs_INSTANCE  *p_instance,
         switch (p_conn->State) {
             case HTTPs_CONN_STATE_RESP_HDR:
                  if (p_conn->RespBodyDataType == HTTPs_BODY_DATA_TYPE_NONE) {
-                     p_conn->State = HTTPs_CONN_STATE_RESP_HDR_LOCATION;
+                     p_conn->State = HTTPs_CONN_STATE_RESP_HDR_CONTENT_CODING;
                  } else {
                      p_conn->State = HTTPs_CONN_STATE_RESP_HDR_CONTENT_TYPE;
                  }
@@ -1201,7 +1290,68 @@ static  void  HTTPsResp_Hdr (HTTPs_INSTANCE  *p_instance,
                  }
 
                  p_buf_wr      = p_str;
-                 p_conn->State = HTTPs_CONN_STATE_RESP_HDR_FILE_TRANSFER;
+                 p_conn->State = HTTPs_CONN_STATE_RESP_HDR_CONTENT_CODING;
+                 break;
+
+
+            case HTTPs_CONN_STATE_RESP_HDR_CONTENT_CODING:
+#if (HTTPs_CFG_CONTENT_CODING_EN == DEF_ENABLED)
+                                                                    /* ------ ADD CONTENT ENCODING & VARY HDR FIELDS ------ */
+                 p_str = p_buf_wr;                              /* See Note #4.                                         */
+                 if (DEF_BIT_IS_SET_ANY(p_conn->ContentCodingFlags, (HTTPs_FLAG_CONTENT_CODING_RESP_GZIP |
+                                                                     HTTPs_FLAG_CONTENT_CODING_RESP_BR)) == DEF_YES) {
+                     buf_len = p_conn->BufLen - p_conn->TxDataLen - (p_str - p_buf);
+                     p_str   = HTTPsResp_HdrFieldAdd(p_instance,
+                                                     p_conn,
+                                                     p_str,
+                                                     buf_len,
+                                                     HTTP_HDR_FIELD_CONTENT_ENCODING,
+                                                     DEF_NULL,
+                                                     0,
+                                                     p_err);
+                     switch (*p_err) {
+                         case HTTPs_ERR_NONE:
+                              break;
+
+                         case HTTPs_ERR_RESP_BUF_NO_MORE_SPACE:
+                              p_conn->State = HTTPs_CONN_STATE_RESP_HDR_CONTENT_CODING;
+                              goto exit;
+
+                         default:
+                              goto exit;
+                     }
+                 }
+
+                 if (DEF_BIT_IS_SET(p_conn->ContentCodingFlags, HTTPs_FLAG_CONTENT_CODING_RESP_VARY) == DEF_YES) {
+                     buf_len = p_conn->BufLen - p_conn->TxDataLen - (p_str - p_buf);
+                     p_str   = HTTPsResp_HdrFieldAdd(p_instance,
+                                                     p_conn,
+                                                     p_str,
+                                                     buf_len,
+                                                     HTTP_HDR_FIELD_VARY,
+                                                     DEF_NULL,
+                                                     0,
+                                                     p_err);
+                     switch (*p_err) {
+                         case HTTPs_ERR_NONE:
+                              break;
+
+                         case HTTPs_ERR_RESP_BUF_NO_MORE_SPACE:
+                              p_conn->State = HTTPs_CONN_STATE_RESP_HDR_CONTENT_CODING;
+                              goto exit;
+
+                         default:
+                              goto exit;
+                     }
+                 }
+
+                 p_buf_wr      = p_str;
+#endif
+                 if (p_conn->RespBodyDataType == HTTPs_BODY_DATA_TYPE_NONE) {
+                     p_conn->State = HTTPs_CONN_STATE_RESP_HDR_VALIDATOR;
+                 } else {
+                     p_conn->State = HTTPs_CONN_STATE_RESP_HDR_FILE_TRANSFER;
+                 }
                  break;
 
 
@@ -1264,6 +1414,62 @@ static  void  HTTPsResp_Hdr (HTTPs_INSTANCE  *p_instance,
                      }
                  }
                  p_buf_wr = p_str;
+                 p_conn->State = HTTPs_CONN_STATE_RESP_HDR_VALIDATOR;
+                 break;
+
+
+            case HTTPs_CONN_STATE_RESP_HDR_VALIDATOR:
+#if (HTTPs_CFG_COND_REQ_EN == DEF_ENABLED)
+                                                                    /* ------- ADD ETAG & LAST MODIFIED HDR FIELDS -------- */
+                 p_str = p_buf_wr;                              /* See Note #4.                                         */
+                 if (DEF_BIT_IS_SET(p_conn->CondFlags, HTTPs_FLAG_COND_RESP_ETAG) == DEF_YES) {
+                     buf_len = p_conn->BufLen - p_conn->TxDataLen - (p_str - p_buf);
+                     p_str   = HTTPsResp_HdrFieldAdd(p_instance,
+                                                     p_conn,
+                                                     p_str,
+                                                     buf_len,
+                                                     HTTP_HDR_FIELD_ETAG,
+                                                     DEF_NULL,
+                                                     0,
+                                                     p_err);
+                     switch (*p_err) {
+                         case HTTPs_ERR_NONE:
+                              break;
+
+                         case HTTPs_ERR_RESP_BUF_NO_MORE_SPACE:
+                              p_conn->State = HTTPs_CONN_STATE_RESP_HDR_VALIDATOR;
+                              goto exit;
+
+                         default:
+                              goto exit;
+                     }
+                 }
+
+                 if (DEF_BIT_IS_SET(p_conn->CondFlags, HTTPs_FLAG_COND_RESP_LAST_MODIFIED) == DEF_YES) {
+                     buf_len = p_conn->BufLen - p_conn->TxDataLen - (p_str - p_buf);
+                     p_str   = HTTPsResp_HdrFieldAdd(p_instance,
+                                                     p_conn,
+                                                     p_str,
+                                                     buf_len,
+                                                     HTTP_HDR_FIELD_LAST_MODIFIED,
+                                                     DEF_NULL,
+                                                     0,
+                                                     p_err);
+                     switch (*p_err) {
+                         case HTTPs_ERR_NONE:
+                              break;
+
+                         case HTTPs_ERR_RESP_BUF_NO_MORE_SPACE:
+                              p_conn->State = HTTPs_CONN_STATE_RESP_HDR_VALIDATOR;
+                              goto exit;
+
+                         default:
+                              goto exit;
+                     }
+                 }
+
+                 p_buf_wr      = p_str;
+#endif
                  p_conn->State = HTTPs_CONN_STATE_RESP_HDR_LOCATION;
                  break;
 
@@ -1492,6 +1698,9 @@ static  CPU_CHAR  *HTTPsResp_HdrFieldAdd (HTTPs_INSTANCE   *p_instance,
            CPU_CHAR         *p_str;
            CPU_CHAR         *p_path;
            CPU_BOOLEAN       add_end_field;
+#if (HTTPs_CFG_CONTENT_CODING_EN == DEF_ENABLED)
+           CPU_INT32U        coding;
+#endif
 #if (HTTPs_CFG_ABSOLUTE_URI_EN == DEF_ENABLED)
            CPU_SIZE_T        len_host;
            CPU_SIZE_T        len_tot;
@@ -1663,6 +1872,105 @@ static  CPU_CHAR  *HTTPsResp_HdrFieldAdd (HTTPs_INSTANCE   *p_instance,
              break;
 
 
+#if (HTTPs_CFG_CONTENT_CODING_EN == DEF_ENABLED)
+        case HTTP_HDR_FIELD_CONTENT_ENCODING:
+             coding = DEF_BIT_IS_SET(p_conn->ContentCodingFlags, HTTPs_FLAG_CONTENT_CODING_RESP_BR) ?
+                      HTTP_HDR_FIELD_CONTENT_CODING_BR : HTTP_HDR_FIELD_CONTENT_CODING_GZIP;
+
+             p_entry = HTTP_Dict_EntryGet(HTTP_Dict_HdrFieldContentCodingVal,
+                                          HTTP_Dict_HdrFieldContentCodingValSize,
+                                          coding);
+             if (p_entry == DEF_NULL) {
+                *p_err = HTTPs_ERR_HDR_FIELD_VAL_UNKNOWN;
+                 return (DEF_NULL);
+             }
+
+             if (p_entry->StrLen > buf_len) {                   /* Validate value len and buf len.                      */
+                 if (buf_len == p_conn->BufLen) {
+                    *p_err = HTTPs_ERR_CFG_INVALID_BUF_LEN;
+                 } else {
+                    *p_err = HTTPs_ERR_RESP_BUF_NO_MORE_SPACE;
+                 }
+                 return (DEF_NULL);
+             }
+
+            (void)Str_Copy_N(p_str, p_entry->StrPtr, p_entry->StrLen); /* Copy string to the buffer.                    */
+             p_str += p_entry->StrLen;                                 /* Increment buffer pointer.                     */
+             break;
+
+
+        case HTTP_HDR_FIELD_VARY:                               /* Resp varies with the Accept-Encoding req hdr.        */
+             p_entry = HTTP_Dict_EntryGet(HTTP_Dict_HdrField,
+                                          HTTP_Dict_HdrFieldSize,
+                                          HTTP_HDR_FIELD_ACCEPT_ENCODING);
+             if (p_entry == DEF_NULL) {
+                *p_err = HTTPs_ERR_HDR_FIELD_VAL_UNKNOWN;
+                 return (DEF_NULL);
+             }
+
+             if (p_entry->StrLen > buf_len) {                   /* Validate value len and buf len.                      */
+                 if (buf_len == p_conn->BufLen) {
+                    *p_err = HTTPs_ERR_CFG_INVALID_BUF_LEN;
+                 } else {
+                    *p_err = HTTPs_ERR_RESP_BUF_NO_MORE_SPACE;
+                 }
+                 return (DEF_NULL);
+             }
+
+            (void)Str_Copy_N(p_str, p_entry->StrPtr, p_entry->StrLen); /* Copy string to the buffer.                    */
+             p_str += p_entry->StrLen;                                 /* Increment buffer pointer.                     */
+             break;
+#endif
+
+
+#if (HTTPs_CFG_COND_REQ_EN == DEF_ENABLED)
+        case HTTP_HDR_FIELD_ETAG:                               /* See 'http-s.h  CONDITIONAL REQUEST DEFINES'.         */
+             if (HTTPs_ETAG_STR_LEN > buf_len) {                /* Validate value len and buf len.                      */
+                 if (buf_len == p_conn->BufLen) {
+                    *p_err = HTTPs_ERR_CFG_INVALID_BUF_LEN;
+                 } else {
+                    *p_err = HTTPs_ERR_RESP_BUF_NO_MORE_SPACE;
+                 }
+                 return (DEF_NULL);
+             }
+
+            *p_str = ASCII_CHAR_QUOTATION_MARK;
+             p_str++;
+            (void)Str_FmtNbr_Int32U(p_conn->CondRespTag,
+                                    HTTPs_ETAG_HEX_DIG_LEN,
+                                    DEF_NBR_BASE_HEX,
+                                    ASCII_CHAR_DIGIT_ZERO,
+                                    DEF_YES,
+                                    DEF_NO,
+                                    p_str);
+             p_str += HTTPs_ETAG_HEX_DIG_LEN;
+            (void)Str_FmtNbr_Int32U(p_conn->DataLen,
+                                    HTTPs_ETAG_HEX_DIG_LEN,
+                                    DEF_NBR_BASE_HEX,
+                                    ASCII_CHAR_DIGIT_ZERO,
+                                    DEF_YES,
+                                    DEF_NO,
+                                    p_str);
+             p_str += HTTPs_ETAG_HEX_DIG_LEN;
+            *p_str = ASCII_CHAR_QUOTATION_MARK;
+             p_str++;
+             break;
+
+
+        case HTTP_HDR_FIELD_LAST_MODIFIED:
+             p_str = HTTP_StrDateWr(p_conn->CondRespTS, p_str, buf_len);
+             if (p_str == DEF_NULL) {                           /* Validate value len and buf len.                      */
+                 if (buf_len == p_conn->BufLen) {
+                    *p_err = HTTPs_ERR_CFG_INVALID_BUF_LEN;
+                 } else {
+                    *p_err = HTTPs_ERR_RESP_BUF_NO_MORE_SPACE;
+                 }
+                 return (DEF_NULL);
+             }
+             break;
+#endif
+
+
         default:
 #if (HTTPs_CFG_HDR_TX_EN == DEF_ENABLED)
              if (p_cfg->HdrTxCfgPtr != DEF_NULL) {
@@ -1737,6 +2045,24 @@ static  CPU_CHAR  *HTTPsResp_HdrFieldAdd (HTTPs_INSTANCE   *p_instance,
 *                                            | entity-header ) CRLF)  ; Section 7.1
 *                                           CRLF
 *                                           [ message-body ]          ; Section 7.2
+*
+*               (2) Static data (see HTTPs_RespBodySetParamStaticData()) is immutable for the whole
+*                   transaction, so it is transmitted straight from the application memory instead of being
+*                   copied in the connection buffer :
+*
+*                   (a) Once the buffer is empty, the transmit pointer is set on the remaining static data.
+*                       Since the transmit length is a 16-bit value, larger data is transmitted in pieces of
+*                       at most DEF_INT_16U_MAX_VAL octets.
+*
+*                   (b) When the header section is still pending in the buffer, the static data is copied
+*                       after it only if it fits entirely, so that small responses are still transmitted with
+*                       a single transmit call (see HTTPsResp_Handle() Note #2). Otherwise, the header
+*                       section is transmitted first.
+*
+*               (3) When the dynamic file system provides a transmit API (see HTTPs_FS_TX_API), the file
+*                   data is transmitted straight from the file by HTTPsSock_ConnDataTx() once the connection
+*                   buffer is empty. The header section and the first part of the file are still transmitted
+*                   together from the buffer.
 *********************************************************************************************************
 */
 
@@ -1744,11 +2070,42 @@ static  CPU_BOOLEAN  HTTPsResp_DataTransferStd (HTTPs_INSTANCE  *p_instance,
                                                 HTTPs_CONN      *p_conn,
                                                 HTTPs_ERR       *p_err)
 {
-    void         *p_buf    = p_conn->TxBufPtr + p_conn->TxDataLen;
-    CPU_SIZE_T    buf_size = p_conn->BufLen   - p_conn->TxDataLen;
-    CPU_SIZE_T    size     = 0;
-    CPU_BOOLEAN   done     = DEF_NO;
+    const  HTTPs_CFG         *p_cfg    = p_instance->CfgPtr;
+    const  HTTPs_CFG_FS_DYN  *p_fs_dyn;
+           void              *p_buf    = p_conn->TxBufPtr + p_conn->TxDataLen;
+           CPU_SIZE_T         buf_size = p_conn->BufLen   - p_conn->TxDataLen;
+           CPU_SIZE_T         size     = 0;
+           CPU_SIZE_T         data_len;
+           CPU_BOOLEAN        done     = DEF_NO;
+
+
+                                                                /* ----------- TX STATIC DATA FROM APP MEM ------------ */
+    if (p_conn->RespBodyDataType == HTTPs_BODY_DATA_TYPE_STATIC_DATA) {
+        data_len = p_conn->DataLen - p_conn->DataFixPosCur;
+        if (p_conn->TxDataLen == 0u) {                          /* Tx from the app data (see Note #2a).                 */
+            data_len               =  DEF_MIN(data_len, DEF_INT_16U_MAX_VAL);
+            p_conn->TxBufPtr       = (CPU_CHAR *)p_conn->DataPtr + p_conn->DataFixPosCur;
+            p_conn->TxDataLen      = (CPU_INT16U)data_len;
+            p_conn->DataFixPosCur += data_len;
+            p_conn->DataTxdLen    += data_len;
+            goto exit_validate;
+        }
 
+        if (data_len > buf_size) {                              /* Tx the hdr section first (see Note #2b).             */
+            goto exit_validate;
+        }
+    }
+                                                                /* ----------------- TX FILE FROM FS ------------------ */
+    if ((p_conn->RespBodyDataType == HTTPs_BODY_DATA_TYPE_FILE) &&
+        (p_cfg->FS_Type           == HTTPs_FS_TYPE_DYN)         &&
+        (p_conn->TxDataLen        == 0u)                        &&
+        (p_conn->DataTxdLen       <  p_conn->DataLen)) {
+        p_fs_dyn = (HTTPs_CFG_FS_DYN *)p_cfg->FS_CfgPtr;
+        if (p_fs_dyn->FS_TxAPI_Ptr != DEF_NULL) {               /* Let the sock layer tx from the file (see Note #3).   */
+            DEF_BIT_SET(p_conn->Flags, HTTPs_FLAG_RESP_FILE_TX);
+            goto exit_validate;
+        }
+    }
 
                                                                 /* ------------------- RD FILE DATA ------------------- */
     size = HTTPsResp_DataRd (      p_instance,
@@ -1761,6 +2118,9 @@ static  CPU_BOOLEAN  HTTPsResp_DataTransferStd (HTTPs_INSTANCE  *p_instance,
         p_conn->DataTxdLen += size;
 
     }
+
+
+exit_validate:
                                                                 /* ------------ VALIDATE FILE RD COMPLETED ------------ */
     if (p_conn->DataTxdLen >= p_conn->DataLen) {                /* If file is completely read.                          */
         done = DEF_YES;
@@ -1847,6 +2207,19 @@ static  CPU_BOOLEAN  HTTPsResp_DataTransferChunkedWithHook (HTTPs_INSTANCE  *p_i
                  p_conn->State = HTTPs_CONN_STATE_RESP_DATA_CHUNKED_HOOK;
              }
 
+#if (HTTPs_CFG_DEFLATE_EN == DEF_ENABLED)
+             if (p_conn->DeflateCtxPtr != DEF_NULL) {
+                 HTTPsResp_DeflateChunkWr(p_instance,
+                                          p_conn,
+                                          p_conn->TxBufPtr + max_hdr_size,
+                                          len_to_tx,
+                                          DEF_NULL,
+                                          0u,
+                                          DEF_NO);
+                 break;
+             }
+#endif
+
              p_conn->TxDataLen = HTTPsResp_WrChunkedToBuf(p_conn->TxBufPtr,
                                                           p_conn->BufLen,
                                                           len_to_tx,
@@ -1855,6 +2228,19 @@ static  CPU_BOOLEAN  HTTPsResp_DataTransferChunkedWithHook (HTTPs_INSTANCE  *p_i
 
 
         case HTTPs_CONN_STATE_RESP_DATA_CHUNKED_FINALIZE:
+#if (HTTPs_CFG_DEFLATE_EN == DEF_ENABLED)
+             if (p_conn->DeflateCtxPtr != DEF_NULL) {           /* Flush the stream & tx the last chunk.                */
+                 HTTPsResp_DeflateChunkWr(p_instance,
+                                          p_conn,
+                                          DEF_NULL,
+                                          0u,
+                                          DEF_NULL,
+                                          0u,
+                                          DEF_YES);
+                 done = DEF_YES;
+                 break;
+             }
+#endif
                                                                 /* 1 is for the str length taken by a 0u in hex          */
              p_conn->TxDataLen = HTTPsResp_WrChunkedToBuf(p_conn->TxBufPtr,
                                                           p_conn->BufLen,
@@ -1900,7 +2286,8 @@ exit:
 *
 * Return(s)   : Return the length of the the encoded data.
 *
-* Caller(s)   : HTTPsResp_DataTransferChunkedWithHook().
+* Caller(s)   : HTTPsResp_DataTransferChunkedWithHook(),
+*               HTTPsResp_DeflateChunkWr().
 *
 * Note(s)     : None.
 *********************************************************************************************************
@@ -1928,6 +2315,110 @@ static  CPU_SIZE_T  HTTPsResp_WrChunkedToBuf (CPU_CHAR   *p_buf,
 }
 
 
+/*
+*********************************************************************************************************
+*                                      HTTPsResp_DeflateChunkWr()
+*
+* Description : Compress body data into the output buffer of the deflate block & encapsulate it into a chunk.
+*
+* Argument(s) : p_instance      Pointer to the instance.
+*               ----------      Argument validated in HTTPs_InstanceStart().
+*
+*               p_conn          Pointer to the connection.
+*               ------          Argument validated in HTTPsSock_ConnAccept().
+*
+*               p_data          Pointer to the data to compress.
+*
+*               data_len        Length of the data.
+*
+*               p_data_ext      Pointer to the data to compress after 'p_data' (see Note #1).
+*
+*               data_ext_len    Length of the data.
+*
+*               last            DEF_YES, if the stream must be flushed & the last chunk appended.
+*                               DEF_NO,  otherwise.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPsResp_DataTransferChunked(),
+*               HTTPsResp_DataTransferChunkedWithHook().
+*
+* Note(s)     : (1) The file data & the token value that follows it are compressed in the same chunk, so a
+*                   token does not require a chunk of its own.
+*
+*               (2) The compressor returns no output only when it has no input, i.e. when the hook or the
+*                   file returned no data for a chunk that is not the last one. The connection then has no
+*                   data to transmit & the next data is requested right away.
+*
+*               (3) The next data is read, or written by the hook, at the transmit buffer pointer, which is
+*                   reset to the connection buffer only once a chunk is transmitted. With no chunk to
+*                   transmit, it MUST be reset here; otherwise, the next data would be put in the deflate
+*                   output buffer & compressed over itself.
+*********************************************************************************************************
+*/
+#if (HTTPs_CFG_DEFLATE_EN == DEF_ENABLED)
+static  void  HTTPsResp_DeflateChunkWr (       HTTPs_INSTANCE  *p_instance,
+                                               HTTPs_CONN      *p_conn,
+                                        const  CPU_CHAR        *p_data,
+                                               CPU_SIZE_T       data_len,
+                                        const  CPU_CHAR        *p_data_ext,
+                                               CPU_SIZE_T       data_ext_len,
+                                               CPU_BOOLEAN      last)
+{
+    HTTPs_DEFLATE_CTX     *p_ctx = p_conn->DeflateCtxPtr;
+    HTTPs_INSTANCE_STATS  *p_ctr_stats;
+    CPU_CHAR              *p_out;
+    CPU_SIZE_T             buf_len;
+    CPU_SIZE_T             out_len;
+    CPU_SIZE_T             tx_len;
+    CPU_INT08U             nbr_dig;
+
+
+    HTTPs_SET_PTR_STATS(p_ctr_stats, p_instance);
+
+    buf_len = p_ctx->OutLenMax + HTTPs_DEFLATE_CHUNK_OVERHEAD_LEN;
+    nbr_dig = HTTP_StrSizeHexDigReq(p_ctx->OutLenMax);
+    p_out   = p_ctx->OutBufPtr + nbr_dig + STR_CR_LF_LEN;
+    out_len = 0u;
+                                                                /* --------------------- COMPRESS --------------------- */
+    if (data_len > 0u) {
+        out_len += HTTPsDeflate_Wr(p_ctx, (const CPU_INT08U *)p_data,     data_len,     (CPU_INT08U *)p_out);
+    }
+    if (data_ext_len > 0u) {                                    /* See Note #1.                                         */
+        out_len += HTTPsDeflate_Wr(p_ctx, (const CPU_INT08U *)p_data_ext, data_ext_len, (CPU_INT08U *)p_out + out_len);
+    }
+    if (last == DEF_YES) {
+        out_len += HTTPsDeflate_Finish(p_ctx, (CPU_INT08U *)p_out + out_len);
+    }
+
+    HTTPs_STATS_OCTET_INC(p_ctr_stats->Resp_StatDeflateOctetInCtr,  data_len + data_ext_len);
+    HTTPs_STATS_OCTET_INC(p_ctr_stats->Resp_StatDeflateOctetOutCtr, out_len);
+
+                                                                /* ------------------- WR CHUNK(S) -------------------- */
+    tx_len = 0u;
+    if (out_len > 0u) {                                         /* See Note #2.                                         */
+        tx_len = HTTPsResp_WrChunkedToBuf(p_ctx->OutBufPtr,
+                                          buf_len,
+                                          out_len,
+                                          nbr_dig);
+    }
+    if (last == DEF_YES) {                                      /* 1 is for the str length taken by a 0u in hex.        */
+        tx_len += HTTPsResp_WrChunkedToBuf(p_ctx->OutBufPtr + tx_len,
+                                           buf_len          - tx_len,
+                                           0u,
+                                           1u);
+    }
+
+    if (tx_len > 0u) {                                          /* See Note #3.                                         */
+        p_conn->TxBufPtr = p_ctx->OutBufPtr;
+    } else {
+        p_conn->TxBufPtr = p_conn->BufPtr;
+    }
+    p_conn->TxDataLen = (CPU_INT16U)tx_len;
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                    HTTPsResp_FileTransferChunked()
@@ -1998,12 +2489,17 @@ static  CPU_BOOLEAN  HTTPsResp_DataTransferChunked (HTTPs_INSTANCE  *p_instance,
            CPU_CHAR              *p_token_str;
            CPU_CHAR              *p_token_val_start;
            CPU_CHAR              *p_token_val_end;
-           CPU_CHAR              *p_token_val_data;
+           CPU_CHAR              *p_token_val_data = DEF_NULL;
            CPU_CHAR              *p_wr;
            HTTPs_INSTANCE_ERRS   *p_ctr_err;
            HTTPs_INSTANCE_STATS  *p_ctr_stat;
            CPU_SIZE_T             size_buf_data;
            CPU_SIZE_T             size_rd;
+#if (HTTPs_CFG_DEFLATE_EN == DEF_ENABLED)
+           CPU_SIZE_T             size_data;
+           CPU_SIZE_T             size_token;
+           CPU_BOOLEAN            last_chunk;
+#endif
            CPU_INT08U             nbr_dig;
            CPU_INT32S             offset;
            CPU_BOOLEAN            tx_buf;
@@ -2210,6 +2706,36 @@ static  CPU_BOOLEAN  HTTPsResp_DataTransferChunked (HTTPs_INSTANCE  *p_instance,
                  p_conn->TokenCtrlPtr->TxLen = (p_token_val_end + STR_CR_LF_LEN) - p_token_val_start;
              }
 
+#if (HTTPs_CFG_DEFLATE_EN == DEF_ENABLED)
+                                                                /* ------------- PREPARE COMPRESSED CHUNK ------------- */
+             if (p_conn->DeflateCtxPtr != DEF_NULL) {
+                 size_data  = 0u;
+                 size_token = 0u;
+                 if (tx_buf == DEF_YES) {
+                     size_data           = size_buf_data;
+                     p_conn->DataTxdLen += size_buf_data;
+                 }
+                 if (tx_token == DEF_YES) {
+                     size_token = p_conn->TokenCtrlPtr->ValLen;
+                 }
+                 last_chunk = ((tx_buf   == DEF_NO) &&
+                               (tx_token == DEF_NO)) ? DEF_YES : DEF_NO;
+
+                 HTTPsResp_DeflateChunkWr(p_instance,           /* File data & token val in one chunk.                  */
+                                          p_conn,
+                                          p_buf_data,
+                                          size_data,
+                                          p_token_val_data,
+                                          size_token,
+                                          last_chunk);
+
+                 p_conn->SockState = HTTPs_SOCK_STATE_TX;
+                 p_conn->State     = (last_chunk == DEF_YES) ? HTTPs_CONN_STATE_RESP_DATA_CHUNKED_TX_LAST_CHUNK :
+                                                               HTTPs_CONN_STATE_RESP_DATA_CHUNKED;
+                 break;
+             }
+#endif
+
 
                                                                 /* ------------- PREPARE FILE DATA CHUNK -------------- */
              if (tx_buf == DEF_YES) {
@@ -2566,7 +3092,22 @@ static  void  HTTPsResp_DfltErrPageSet (HTTPs_INSTANCE  *p_instance,
 *
 * Caller(s)   : HTTPsResp_PrepareBodyData().
 *
-* Note(s)     : none.
+* Note(s)     : (1) When the client accepts a content coding, the pre-compressed variant of the file is
+*                   opened instead, if present. The variant is named after the file with the coding extension
+*                   appended (e.g. 'index.html.br'):
+*
+*                   (a) Variants are only searched when the response is not chunked, since the token
+*                       replacement can't parse compressed data.
+*
+*                   (b) "br" is preferred over "gzip" since it compresses better. The qvalues of the
+*                       Accept-Encoding header are not ranked (see HTTPsReq_HdrParseAcceptEncoding()).
+*
+*                   (c) The Vary header is added to every response that may have been coded, whether a
+*                       variant is found or not, so that caches keep the responses apart.
+*
+*               (2) The validators of the opened file are evaluated against the conditional request headers
+*                   once the file variant & its size are known. An unchanged file is closed & answered with
+*                   a '304 Not Modified' response without reading its data.
 *********************************************************************************************************
 */
 #if (HTTPs_CFG_FS_PRESENT_EN == DEF_ENABLED)
@@ -2582,6 +3123,10 @@ static  CPU_BOOLEAN  HTTPsResp_FileOpen (HTTPs_INSTANCE  *p_instance,
 #if (HTTPs_CFG_ABSOLUTE_URI_EN == DEF_ENABLED)
            CPU_BOOLEAN            location_needed;
 #endif
+#if (HTTPs_CFG_CONTENT_CODING_EN == DEF_ENABLED)
+           CPU_SIZE_T             path_len_max;
+           HTTPs_FLAGS            coding_flags;
+#endif
 
 
     HTTPs_SET_PTR_ERRS( p_ctr_errs,  p_instance);
@@ -2644,10 +3189,47 @@ static  CPU_BOOLEAN  HTTPsResp_FileOpen (HTTPs_INSTANCE  *p_instance,
     }
 #endif
 
+    p_conn->DataPtr = DEF_NULL;
+
+#if (HTTPs_CFG_CONTENT_CODING_EN == DEF_ENABLED)
+                                                                /* -------------- OPEN PRE-COMPRESSED FILE ------------ */
+    coding_flags = HTTPs_FLAG_NONE;
+                                                                /* See Note #1a.                                        */
+    if (DEF_BIT_IS_CLR(p_conn->Flags, HTTPs_FLAG_RESP_CHUNKED) == DEF_YES) {
+                                                                /* See Note #1c.                                        */
+        DEF_BIT_SET(coding_flags, HTTPs_FLAG_CONTENT_CODING_RESP_VARY);
+
+        path_len_max = p_conn->PathLenMax - (p_file_path - p_conn->PathPtr);
+                                                                /* See Note #1b.                                        */
+        if (DEF_BIT_IS_SET(p_conn->ContentCodingFlags, HTTPs_FLAG_CONTENT_CODING_REQ_BR) == DEF_YES) {
+            p_conn->DataPtr = HTTPsResp_FileOpenCoded(p_fs_api,
+                                                      p_file_path,
+                                                      path_len_max,
+                                                      HTTPs_STR_FILE_EXT_BR);
+            if (p_conn->DataPtr != DEF_NULL) {
+                DEF_BIT_SET(coding_flags, HTTPs_FLAG_CONTENT_CODING_RESP_BR);
+            }
+        }
+
+        if ((p_conn->DataPtr == DEF_NULL) &&
+            (DEF_BIT_IS_SET(p_conn->ContentCodingFlags, HTTPs_FLAG_CONTENT_CODING_REQ_GZIP) == DEF_YES)) {
+            p_conn->DataPtr = HTTPsResp_FileOpenCoded(p_fs_api,
+                                                      p_file_path,
+                                                      path_len_max,
+                                                      HTTPs_STR_FILE_EXT_GZIP);
+            if (p_conn->DataPtr != DEF_NULL) {
+                DEF_BIT_SET(coding_flags, HTTPs_FLAG_CONTENT_CODING_RESP_GZIP);
+            }
+        }
+    }
+#endif
+
                                                                 /* -------------------- OPEN FILE --------------------- */
-    p_conn->DataPtr = p_fs_api->Open(p_file_path,
-                                     NET_FS_FILE_MODE_OPEN,
-                                     NET_FS_FILE_ACCESS_RD);
+    if (p_conn->DataPtr == DEF_NULL) {
+        p_conn->DataPtr = p_fs_api->Open(p_file_path,
+                                         NET_FS_FILE_MODE_OPEN,
+                                         NET_FS_FILE_ACCESS_RD);
+    }
     if (p_conn->DataPtr != DEF_NULL) {                          /* If file opened successfully...                       */
         HTTPs_STATS_INC(p_ctr_stats->FS_StatOpenedCtr);
 
@@ -2666,11 +3248,233 @@ static  CPU_BOOLEAN  HTTPsResp_FileOpen (HTTPs_INSTANCE  *p_instance,
         return (DEF_FAIL);
     }
 
+#if (HTTPs_CFG_CONTENT_CODING_EN == DEF_ENABLED)
+    DEF_BIT_SET(p_conn->ContentCodingFlags, coding_flags);
+#endif
+
+#if (HTTPs_CFG_COND_REQ_EN == DEF_ENABLED)
+    HTTPsResp_FileCondProcess(p_instance, p_conn, p_fs_api);    /* See Note #2.                                         */
+#endif
+
     return (DEF_OK);
 }
 #endif
 
 
+/*
+*********************************************************************************************************
+*                                       HTTPsResp_FileOpenCoded()
+*
+* Description : Open the pre-compressed variant of a file.
+*
+* Argument(s) : p_fs_api        Pointer to the file system API.
+*               --------        Argument validated in HTTPsResp_FileOpen().
+*
+*               p_file_path     Pointer to the file path.
+*               -----------     Argument validated in HTTPsResp_FileOpen().
+*
+*               path_len_max    Size of the buffer holding the file path.
+*
+*               p_ext           Pointer to the coding extension to append to the path.
+*
+* Return(s)   : Pointer to the file handle, if the variant is successfully opened.
+*
+*               DEF_NULL,                   otherwise.
+*
+* Caller(s)   : HTTPsResp_FileOpen().
+*
+* Note(s)     : (1) The extension is appended in the path buffer itself and removed once the variant is
+*                   opened, so that no copy of the path is needed. The variant is not searched when the
+*                   buffer can't hold the extension.
+*********************************************************************************************************
+*/
+
+#if ((HTTPs_CFG_FS_PRESENT_EN       == DEF_ENABLED) && \
+     (HTTPs_CFG_CONTENT_CODING_EN    == DEF_ENABLED))
+static  void  *HTTPsResp_FileOpenCoded (const  NET_FS_API  *p_fs_api,
+                                               CPU_CHAR    *p_file_path,
+                                               CPU_SIZE_T   path_len_max,
+                                        const  CPU_CHAR    *p_ext)
+{
+    CPU_SIZE_T   path_len;
+    void        *p_file;
+
+
+    path_len = Str_Len_N(p_file_path, path_len_max);
+    if ((path_len + HTTPs_STR_FILE_EXT_CODING_LEN) >= path_len_max) {
+        return (DEF_NULL);                                      /* See Note #1.                                         */
+    }
+
+   (void)Str_Copy_N(&p_file_path[path_len],                     /* Append the coding ext.                               */
+                     p_ext,
+                     HTTPs_STR_FILE_EXT_CODING_LEN + 1u);
+
+    p_file = p_fs_api->Open(p_file_path,
+                            NET_FS_FILE_MODE_OPEN,
+                            NET_FS_FILE_ACCESS_RD);
+
+    p_file_path[path_len] = ASCII_CHAR_NULL;                    /* Restore the path.                                    */
+
+    return (p_file);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      HTTPsResp_FileCondProcess()
+*
+* Description : (1) Process the conditional request headers against the validators of the opened file:
+*
+*                   (a) Get the entity tag & the modification date of the file
+*                   (b) Evaluate If-None-Match or If-Modified-Since
+*                   (c) Set the '304 Not Modified' response
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceStart().
+*
+*               p_conn      Pointer to the connection.
+*               ------      Argument validated in HTTPsSock_ConnAccept().
+*
+*               p_fs_api    Pointer to the file system API.
+*               --------    Argument validated in HTTPsResp_FileOpen().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPsResp_FileOpen().
+*
+* Note(s)     : (2) The validators only describe a successful response whose body is the file data. Chunked
+*                   responses are built by the token replacement & are never validated.
+*
+*               (3) The entity tag is the tag stored by the static file system, if any. Otherwise, the
+*                   modification date of the file is used. The file size is always part of the tag (see
+*                   'http-s.h  CONDITIONAL REQUEST DEFINES'), so that the coded variants get distinct tags.
+*
+*               (4) RFC #7232, section "6 Precedence" states that :
+*
+*                   (a) If-None-Match is evaluated first. If-Modified-Since is only evaluated when
+*                       If-None-Match is not present.
+*
+*                   (b) Both preconditions are only evaluated for the GET & HEAD methods.
+*
+*                   (c) If-None-Match is false when any of its tags matches the tag of the file. A client may
+*                       send the tags of all the coded variants of the file it holds.
+*
+*               (5) RFC #7232, section "4.1 304 Not Modified" states that the response carries the same
+*                   ETag & Vary header fields as a '200 OK' response would. Other representation metadata,
+*                   such as Content-Encoding, SHOULD NOT be sent. The connection stays persistent since the
+*                   response has no body.
+*********************************************************************************************************
+*/
+
+#if ((HTTPs_CFG_FS_PRESENT_EN       == DEF_ENABLED) && \
+     (HTTPs_CFG_COND_REQ_EN          == DEF_ENABLED))
+static  void  HTTPsResp_FileCondProcess (       HTTPs_INSTANCE  *p_instance,
+                                                HTTPs_CONN      *p_conn,
+                                         const  NET_FS_API      *p_fs_api)
+{
+    const  HTTPs_CFG             *p_cfg;
+    const  HTTPs_CFG_FS_STATIC   *p_cfg_fs_static;
+           NET_FS_DATE_TIME       date_time;
+           CPU_BOOLEAN            tag_valid;
+           CPU_BOOLEAN            valid;
+           CPU_BOOLEAN            not_modified;
+           CPU_INT08U             tag_ix;
+           HTTPs_INSTANCE_STATS  *p_ctr_stats;
+
+
+    p_cfg = p_instance->CfgPtr;
+                                                                /* See Note #2.                                         */
+    if ((p_conn->StatusCode                                    != HTTP_STATUS_OK) ||
+        (DEF_BIT_IS_SET(p_conn->Flags, HTTPs_FLAG_RESP_CHUNKED) == DEF_YES)) {
+        return;
+    }
+
+                                                                /* ---------------- GET FILE VALIDATORS --------------- */
+    tag_valid = DEF_NO;                                         /* See Note #3.                                         */
+    if (p_cfg->FS_Type == HTTPs_FS_TYPE_STATIC) {
+        p_cfg_fs_static = (const HTTPs_CFG_FS_STATIC *)p_cfg->FS_CfgPtr;
+        if (p_cfg_fs_static->FileETagGet != DEF_NULL) {
+            tag_valid = p_cfg_fs_static->FileETagGet(p_conn->DataPtr, &p_conn->CondRespTag);
+        }
+    }
+
+    if (p_fs_api->DateTimeCreate != DEF_NULL) {
+        valid = p_fs_api->DateTimeCreate(p_conn->DataPtr, &date_time);
+        if (valid == DEF_OK) {                                  /* Dates out of the 'http.h' range are not tx'd.        */
+            valid = HTTP_DateToTS(date_time.Yr,
+                                  date_time.Month,
+                                  date_time.Day,
+                                  date_time.Hr,
+                                  date_time.Min,
+                                  date_time.Sec,
+                                 &p_conn->CondRespTS);
+        }
+        if (valid == DEF_OK) {
+            DEF_BIT_SET(p_conn->CondFlags, HTTPs_FLAG_COND_RESP_LAST_MODIFIED);
+            if (tag_valid != DEF_OK) {
+                p_conn->CondRespTag = p_conn->CondRespTS;
+                tag_valid           = DEF_OK;
+            }
+        }
+    }
+
+    if (tag_valid == DEF_OK) {
+        DEF_BIT_SET(p_conn->CondFlags, HTTPs_FLAG_COND_RESP_ETAG);
+    }
+
+                                                                /* --------------- EVALUATE PRECONDITIONS ------------- */
+    if ((p_conn->Method != HTTP_METHOD_GET) &&                  /* See Note #4b.                                        */
+        (p_conn->Method != HTTP_METHOD_HEAD)) {
+        return;
+    }
+
+    not_modified = DEF_NO;
+    if (DEF_BIT_IS_SET(p_conn->CondFlags, HTTPs_FLAG_COND_REQ_NONE_MATCH) == DEF_YES) {
+        if (DEF_BIT_IS_SET(p_conn->CondFlags, HTTPs_FLAG_COND_REQ_NONE_MATCH_ANY) == DEF_YES) {
+            not_modified = DEF_YES;
+
+        } else if (DEF_BIT_IS_SET(p_conn->CondFlags, (HTTPs_FLAG_COND_REQ_NONE_MATCH_TAG |
+                                                      HTTPs_FLAG_COND_RESP_ETAG)) == DEF_YES) {
+                                                                /* See Note #4c.                                        */
+            for (tag_ix = 0u; tag_ix < p_conn->CondReqTagNbr; tag_ix++) {
+                if ((p_conn->CondReqTagTbl[tag_ix]     == p_conn->CondRespTag) &&
+                    (p_conn->CondReqTagSizeTbl[tag_ix] == p_conn->DataLen)) {
+                    not_modified = DEF_YES;
+                    break;
+                }
+            }
+        }
+
+    } else if (DEF_BIT_IS_SET(p_conn->CondFlags, (HTTPs_FLAG_COND_REQ_MODIFIED_SINCE |  /* See Note #4a.            */
+                                                  HTTPs_FLAG_COND_RESP_LAST_MODIFIED)) == DEF_YES) {
+        if (p_conn->CondRespTS <= p_conn->CondReqTS) {
+            not_modified = DEF_YES;
+        }
+    }
+
+    if (not_modified != DEF_YES) {
+        return;
+    }
+
+                                                                /* ------------- SET NOT MODIFIED RESPONSE ------------ */
+    HTTPs_SET_PTR_STATS(p_ctr_stats, p_instance);
+    HTTPs_STATS_INC(p_ctr_stats->FS_StatClosedCtr);
+    p_fs_api->Close(p_conn->DataPtr);                           /* File data is not rd.                                 */
+
+    p_conn->DataPtr          = DEF_NULL;
+    p_conn->RespBodyDataType = HTTPs_BODY_DATA_TYPE_NONE;
+    p_conn->StatusCode       = HTTP_STATUS_NOT_MODIFIED;
+#if (HTTPs_CFG_CONTENT_CODING_EN == DEF_ENABLED)                /* See Note #5.                                         */
+    DEF_BIT_CLR(p_conn->ContentCodingFlags, (HTTPs_FLAG_CONTENT_CODING_RESP_GZIP |
+                                             HTTPs_FLAG_CONTENT_CODING_RESP_BR));
+#endif
+
+    HTTPs_STATS_INC(p_ctr_stats->Resp_StatStatusCodeNotModifiedCtr);
+}
+#endif
+
+
 /*
 *********************************************************************************************************
 *                                          HTTPsResp_DataRd()
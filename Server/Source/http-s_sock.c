@@ -36,7 +36,9 @@
 #define    HTTPs_SOCK_MODULE
 
 #include  "http-s_sock.h"
+#include  "http-s_conn.h"
 #include  "http-s_mem.h"
+#include  "http-s_task.h"
 
 
 /*
@@ -47,7 +49,29 @@
 *********************************************************************************************************
 */
 
-#define  HTTPs_SOCK_SEL_TIMEOUT_MS                          1u
+#define  HTTPs_SOCK_SEL_TIMEOUT_MS                          1u  /* Wait period of a stopping instance without conn.     */
+#define  HTTPs_SOCK_SEL_IDLE_TIMEOUT_MS                  1000u  /* Max wait when conns are established.                 */
+
+#define  HTTPs_SOCK_CONN_TMR_TICK_MS                     1000u  /* Period of the conn tmr wheel.                        */
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL DATA TYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+typedef  struct  https_sock_evt_sel_data {                      /* Select socket event backend data.                    */
+    NET_SOCK_DESC   DescRd;                                     /* Registered rd  events.                               */
+    NET_SOCK_DESC   DescWr;                                     /* Registered wr  events.                               */
+    NET_SOCK_DESC   DescErr;                                    /* Registered err events.                               */
+    NET_SOCK_DESC   DescListen;                                 /* Listen sockets.                                      */
+    NET_SOCK_QTY    NbrMax;                                     /* Highest registered sock nbr + 1.                     */
+    HTTPs_CONN     *ConnTbl[NET_SOCK_NBR_SOCK];                 /* Conn registered for each sock ID.                    */
+    NET_SOCK_ID     SelAbortSockID;                             /* Sock used to abort the pending sel.                  */
+} HTTPs_SOCK_EVT_SEL_DATA;
 
 
 /*
@@ -58,8 +82,73 @@
 *********************************************************************************************************
 */
 
-static  void  HTTPsSock_ConnAccept (HTTPs_INSTANCE  *p_instance,
-                                    NET_SOCK_ID      sock_listen_id);
+static  void               HTTPsSock_ConnAccept      (HTTPs_INSTANCE    *p_instance,
+                                                      NET_SOCK_ID        sock_listen_id);
+
+static  HTTPs_INSTANCE    *HTTPsSock_ConnAdmit       (HTTPs_INSTANCE    *p_instance);
+
+static  void               HTTPsSock_ConnReject      (HTTPs_INSTANCE    *p_instance,
+                                                      NET_SOCK_ID        sock_id);
+
+static  CPU_BOOLEAN        HTTPsSock_ConnFileTx      (HTTPs_INSTANCE    *p_instance,
+                                                      HTTPs_CONN        *p_conn);
+
+static  void               HTTPsSock_ConnRdyAdd      (HTTPs_INSTANCE    *p_instance,
+                                                      HTTPs_CONN        *p_conn);
+
+static  void               HTTPsSock_ConnTmrStop     (HTTPs_INSTANCE    *p_instance,
+                                                      HTTPs_CONN        *p_conn);
+
+static  void               HTTPsSock_ConnTmrExpire   (HTTPs_INSTANCE    *p_instance);
+
+static  HTTPs_INSTANCE    *HTTPsSock_WorkerSel       (HTTPs_INSTANCE    *p_instance);
+
+static  CPU_BOOLEAN        HTTPsSock_WorkerConnPost  (HTTPs_INSTANCE    *p_worker,
+                                                      NET_SOCK_ID        sock_id,
+                                                      NET_SOCK_ADDR     *p_client_addr);
+
+static  void               HTTPsSock_ListenEvtSet    (HTTPs_INSTANCE    *p_instance,
+                                                      CPU_BOOLEAN        en);
+
+                                                                /* Select socket event backend.                         */
+static  void               HTTPsSock_EvtSelInit      (HTTPs_INSTANCE    *p_instance,
+                                                      HTTPs_ERR         *p_err);
+
+static  void               HTTPsSock_EvtSelListenSet (HTTPs_INSTANCE    *p_instance,
+                                                      NET_SOCK_ID        sock_id,
+                                                      CPU_BOOLEAN        en);
+
+static  void               HTTPsSock_EvtSelConnSet   (HTTPs_INSTANCE    *p_instance,
+                                                      HTTPs_CONN        *p_conn,
+                                                      HTTPs_FLAGS        interest);
+
+static  NET_SOCK_QTY       HTTPsSock_EvtSelWait      (HTTPs_INSTANCE    *p_instance,
+                                                      NET_SOCK_TIMEOUT  *p_timeout,
+                                                      HTTPs_ERR         *p_err);
+
+static  void               HTTPsSock_EvtSelWake      (HTTPs_INSTANCE    *p_instance);
+
+
+/*
+*********************************************************************************************************
+*                                      SOCKET EVENT BACKEND API
+*
+* Note(s) : (1) Default socket event backend used when 'SockEvtAPI_Ptr' is not set in the instance
+*               configuration. The registered socket descriptors are kept between passes and only the
+*               sockets reported by NetSock_Sel() are dispatched to the instance.
+*
+*           (2) Other backends (e.g. epoll on a host port) can be provided by the application with the same
+*               API structure & set in the instance configuration.
+*********************************************************************************************************
+*/
+                                                                /* Select socket event backend API fnct ptrs :          */
+const  HTTPs_SOCK_EVT_API  HTTPsSock_EvtAPI_Sel = {
+                                                     HTTPsSock_EvtSelInit,        /*   Init.                        */
+                                                     HTTPsSock_EvtSelListenSet,   /*   Listen sock set.             */
+                                                     HTTPsSock_EvtSelConnSet,     /*   Conn sock set.               */
+                                                     HTTPsSock_EvtSelWait,        /*   Wait.                        */
+                                                     HTTPsSock_EvtSelWake         /*   Wake.                        */
+                                                  };
 
 
 /*
@@ -95,7 +184,8 @@ static  void  HTTPsSock_ConnAccept (HTTPs_INSTANCE  *p_instance,
 *
 * Caller(s)   : HTTPs_InstanceStart().
 *
-* Note(s)     : none.
+* Note(s)     : (2) The listen queue size is a signed 16-bit value, so the number of connections of the
+*                   instance is clamped to NET_SOCK_Q_SIZE_MAX.
 *********************************************************************************************************
 */
 
@@ -111,6 +201,7 @@ NET_SOCK_ID  HTTPsSock_ListenInit (const  HTTPs_CFG                 *p_cfg,
     NET_SOCK_ADDR_LEN     sock_addr_len;
     CPU_INT08U           *p_addr;
     NET_SOCK_ADDR_LEN     addr_len;
+    NET_SOCK_Q_SIZE       q_size;
     NET_ERR               err;
 
 
@@ -255,7 +346,13 @@ NET_SOCK_ID  HTTPsSock_ListenInit (const  HTTPs_CFG                 *p_cfg,
 
 
                                                                 /* ------------------- LISTEN SOCK -------------------- */
-   (void)NetSock_Listen(sock_id, p_cfg->ConnNbrMax, &err);
+    if (p_cfg->ConnNbrMax > NET_SOCK_Q_SIZE_MAX) {              /* See Note #2.                                         */
+        q_size = NET_SOCK_Q_SIZE_MAX;
+    } else {
+        q_size = (NET_SOCK_Q_SIZE)p_cfg->ConnNbrMax;
+    }
+
+   (void)NetSock_Listen(sock_id, q_size, &err);
     if (err != NET_SOCK_ERR_NONE) {
        (void)NetSock_Close(sock_id, &err);
        *p_err = HTTPs_ERR_SOCK_LISTEN;
@@ -355,9 +452,11 @@ void  HTTPsSock_ListenClose(HTTPs_INSTANCE  *p_instance,
 *
 * Description : (1) Update connections that are ready to be processed.
 *
-*                   (a) Prepare socket descriptor
-*                   (b) Socket select
-*                   (c) Update connection states
+*                   (a) Update listen sockets registration
+*                   (b) Wait for socket events or an instance wake up
+*                   (c) Expire connection deadlines
+*                   (d) Resume connections waiting for the application
+*                   (e) Return number of connections ready
 *
 * Argument(s) : p_instance  Pointer to the instance.
 *               ----------  Argument validated in HTTPs_InstanceStart().
@@ -372,265 +471,174 @@ void  HTTPsSock_ListenClose(HTTPs_INSTANCE  *p_instance,
 *                   and thus the protocol version (and the connection's persistence status) are unknown
 *                   to the instance at this point. However, if the instance is closing gracefully we will
 *                   allow the connection's inactivity timeout to expire.
+*
+*               (2) Connection sockets are registered with the socket event backend by
+*                   HTTPsSock_ConnEvtUpdate() when their socket state changes. Ready connections are queued
+*                   in the instance ready list by the backend, so no connection list walk is required here.
+*
+*               (3) The backend MUST NOT block when connections are already in the ready list, i.e.
+*                   connections without socket operation to wait for.
+*
+*               (4) A worker other than the primary worker has no listen socket registered. When it has no
+*                   connection, nothing could wake up the backend so the worker pends on its signal instead.
+*                   Once the worker is stopping, it no longer pends so the stop can complete.
+*                   See HTTPsTask_WorkerSignalPend().
+*
+*               (5) The instance task does not wake up periodically while its connections wait for socket
+*                   events or for the application :
+*
+*                   (a) The wait is aborted by HTTPsSock_InstanceWake() when the instance is stopped, when a
+*                       connection is handed off or when the application calls HTTPs_InstanceWakeUp().
+*
+*                   (b) Connections waiting for the application (see HTTPsSock_ConnEvtPoll()) are resumed
+*                       when the instance is woken up. They are also resumed when a wait times out, so an
+*                       application that never calls HTTPs_InstanceWakeUp() is still polled, at most every
+*                       HTTPs_SOCK_SEL_IDLE_TIMEOUT_MS.
+*
+*                   (c) A wake up requested before the backend starts waiting is seen by the backend, which
+*                       then does not wait (see HTTPsSock_EvtSelWait() Note #4). Only a wake up requested in
+*                       the few instructions between that check & the start of the wait can be missed, so the
+*                       wait is still bounded by HTTPs_SOCK_SEL_IDLE_TIMEOUT_MS.
+*
+*               (6) While a connection deadline is pending, the wait is bounded by the connection timer wheel
+*                   period so that the wheel is advanced at least once per period. See
+*                   HTTPsSock_ConnTmrExpire().
 *********************************************************************************************************
 */
 
 NET_SOCK_QTY  HTTPsSock_ConnSel (HTTPs_INSTANCE  *p_instance,
                                  CPU_BOOLEAN      accept)
 {
-    const  HTTPs_CFG            *p_cfg;
-           HTTPs_CONN           *p_conn;
+    const  HTTPs_SOCK_EVT_API   *p_evt_api;
            HTTPs_INSTANCE_ERRS  *p_ctr_err;
            NET_SOCK_TIMEOUT     *p_sock_timeout;
            NET_SOCK_TIMEOUT      sock_timeout;
-           NET_SOCK_QTY          sock_nbr_rdy;
-           NET_SOCK_DESC         sock_desc_rd;
-           NET_SOCK_DESC         sock_desc_wr;
-           NET_SOCK_DESC         sock_desc_err;
-           NET_SOCK_QTY          sock_nbr_max;
-           NET_SOCK_RTN_CODE     sel_rtn_code;
+           CPU_INT32U            timeout_ms;
+           HTTPs_CONN           *p_conn;
+           HTTPs_CONN           *p_conn_next;
 #if (HTTPs_CFG_PERSISTENT_CONN_EN == DEF_ENABLED)
            NET_SOCK             *p_sock;
            CPU_BOOLEAN           persistent;
 #endif
-           CPU_BOOLEAN           child_present;
-           NET_ERR               err;
+           NET_SOCK_QTY          sock_nbr_rdy;
+           CPU_BOOLEAN           wake_req;
+           HTTPs_ERR             err;
 
 
     HTTPs_SET_PTR_ERRS(p_ctr_err, p_instance);
-    p_cfg = p_instance->CfgPtr;
-
-    child_present = DEF_NO;
-
-                                                                /* ---------------- PREPARE SOCK DESC ----------------- */
-    NET_SOCK_DESC_INIT(&sock_desc_rd);
-    NET_SOCK_DESC_INIT(&sock_desc_wr);
-    NET_SOCK_DESC_INIT(&sock_desc_err);
-
-    sock_nbr_rdy = 0;
-    sock_nbr_max = 0;
-
-    if (accept == DEF_YES) {
-        switch (p_cfg->SockSel) {
-            case HTTPs_SOCK_SEL_IPv4:
-#ifdef NET_IPv4_MODULE_EN
-                 NET_SOCK_DESC_SET(p_instance->SockListenID_IPv4, &sock_desc_rd);
-                 sock_nbr_max = p_instance->SockListenID_IPv4 + 1;
-#endif
-                 break;
-
-
-            case HTTPs_SOCK_SEL_IPv6:
-#ifdef NET_IPv6_MODULE_EN
-                 NET_SOCK_DESC_SET(p_instance->SockListenID_IPv6, &sock_desc_rd);
-                 sock_nbr_max = p_instance->SockListenID_IPv6 + 1;
-#endif
-                 break;
+    p_evt_api = p_instance->SockEvtAPI_Ptr;
 
+                                                                /* ------------- UPDATE LISTEN SOCK EVENTS ------------ */
+    if (accept != p_instance->SockListenEvtEn) {
+        HTTPsSock_ListenEvtSet(p_instance, accept);
+        p_instance->SockListenEvtEn = accept;
+    }
 
-            case HTTPs_SOCK_SEL_IPv4_IPv6:
-#ifdef NET_IPv4_MODULE_EN
-                 NET_SOCK_DESC_SET(p_instance->SockListenID_IPv4, &sock_desc_rd);
-                 sock_nbr_max = p_instance->SockListenID_IPv4 + 1;
-#endif
-#ifdef NET_IPv6_MODULE_EN
-                 NET_SOCK_DESC_SET(p_instance->SockListenID_IPv6, &sock_desc_rd);
-                 if (sock_nbr_max < p_instance->SockListenID_IPv6) {
-                     sock_nbr_max = p_instance->SockListenID_IPv6 + 1;
-                 } else if (sock_nbr_max == p_instance->SockListenID_IPv6) {
-                     sock_nbr_max = p_instance->SockListenID_IPv6 + 1;
-                 }
-#endif
-                 break;
 
+#if (HTTPs_CFG_PERSISTENT_CONN_EN == DEF_ENABLED)               /* -------------- CHK INSTANCE CLOSING ---------------- */
+    if (accept == DEF_NO) {
+        p_conn = p_instance->ConnFirstPtr;
+        while (p_conn != DEF_NULL) {                            /* Check if conn is deemed persistent. See Note (1).    */
+            persistent = DEF_BIT_IS_SET(p_conn->Flags, HTTPs_FLAG_CONN_PERSISTENT)      ||
+                         (p_conn->ProtocolVer                  == HTTP_PROTOCOL_VER_1_1 &&
+                          p_instance->CfgPtr->ConnPersistentEn == DEF_TRUE);
+
+            if ((persistent        == DEF_TRUE) &&
+                (p_conn->SockState == HTTPs_SOCK_STATE_RX)) {
+                p_sock = NetSock_GetObj(p_conn->SockID);        /* Check if instance is in the midst of closing.        */
+                if (p_sock != DEF_NULL) {
+                    p_sock = NetSock_GetObj(p_sock->ID_SockParent);
+                    if (p_sock == DEF_NULL) {                   /* If listen sock is free, consider instance is closing.*/
+                                                                /* Wait for idle timeout expiry; do not process RX state*/
+                                                                /* Force RESP_COMPLETED state. (See HTTPsConn_Process())*/
+                        p_conn->SockState = HTTPs_SOCK_STATE_NONE;
+                        p_conn->State     = HTTPs_CONN_STATE_RESP_COMPLETED;
+                        HTTPsSock_ConnEvtUpdate(p_instance, p_conn);
+                    }
+                }
+            }
 
-            default:
-                 break;
+            p_conn = p_conn->ConnNextPtr;
         }
     }
+#endif
 
-    p_conn = p_instance->ConnFirstPtr;
-    while (p_conn != DEF_NULL) {
-        child_present = DEF_YES;
-        switch (p_conn->SockState) {
-            case HTTPs_SOCK_STATE_RX:                           /* Conn rdy to receive data.                            */
-                 NET_SOCK_DESC_SET(p_conn->SockID, &sock_desc_rd);
-                 NET_SOCK_DESC_SET(p_conn->SockID, &sock_desc_err);
-                 break;
-
-
-            case HTTPs_SOCK_STATE_TX:                           /* Conn rdy to tx data.                                 */
-                 NET_SOCK_DESC_SET(p_conn->SockID, &sock_desc_wr);
-                 NET_SOCK_DESC_SET(p_conn->SockID, &sock_desc_err);
-                 break;
 
+                                                                /* ---------------- WAIT WORKER SIGNAL ---------------- */
+    if ((p_instance->WorkerParentPtr != DEF_NULL) &&            /* See Note #4.                                         */
+        (accept                      == DEF_YES)  &&
+        (p_instance->ConnFirstPtr    == DEF_NULL) &&
+        (p_instance->ConnRdyFirstPtr == DEF_NULL)) {
+        HTTPsTask_WorkerSignalPend(p_instance);
+        return (0);
+    }
 
-            case HTTPs_SOCK_STATE_ERR:                          /* Conn is wainting for sock err.                       */
-            case HTTPs_SOCK_STATE_CLOSE:
-            case HTTPs_SOCK_STATE_NONE:
-                 NET_SOCK_DESC_SET(p_conn->SockID, &sock_desc_err);
-                 sock_nbr_rdy++;                                /* Socket close completed in HTTPsConn_Close().         */
-                 break;
+                                                                /* ----------------- CHK WAKE UP REQ ------------------ */
+    wake_req = DEF_NO;
+    HTTPsTask_LockAcquire(p_instance->ConnSelAbortLockObj, &err);
+    if (err == HTTPs_ERR_NONE) {
+        wake_req            = p_instance->WakeReq;
+        p_instance->WakeReq = DEF_NO;
+        HTTPsTask_LockRelease(p_instance->ConnSelAbortLockObj);
+    }
 
+                                                                /* ------------------ WAIT SOCK EVT ------------------- */
+    if ((p_instance->ConnRdyFirstPtr != DEF_NULL) ||            /* See Note #3.                                         */
+        (wake_req                    == DEF_YES)) {
+        timeout_ms = 0u;
 
-            default:
-                 break;
-        }
+    } else if ((accept                   == DEF_NO) &&
+               (p_instance->ConnFirstPtr == DEF_NULL)) {
+        timeout_ms = HTTPs_SOCK_SEL_TIMEOUT_MS;
 
-        if (sock_nbr_max <= p_conn->SockID) {                   /* Update highest sock nbr.                             */
-            sock_nbr_max = p_conn->SockID + 1;
-        } else if ((sock_nbr_max   == p_conn->SockID) &&
-                   (p_conn->SockID == 0)             ) {
-            sock_nbr_max = p_conn->SockID + 1;
-        }
+    } else if (p_instance->ConnFirstPtr != DEF_NULL) {          /* See Note #5c.                                        */
+        timeout_ms = HTTPs_SOCK_SEL_IDLE_TIMEOUT_MS;
 
-        p_conn = p_conn->ConnNextPtr;
+    } else {                                                    /* Wait for new conn indefinitely.                      */
+        timeout_ms = DEF_INT_32U_MAX_VAL;
     }
 
+    if ((p_instance->ConnTmrCtr >  0u) &&                       /* See Note #6.                                         */
+        (timeout_ms             >  HTTPs_SOCK_CONN_TMR_TICK_MS)) {
+        timeout_ms = HTTPs_SOCK_CONN_TMR_TICK_MS;
+    }
 
-                                                                /* -------------------- SOCK SEL ---------------------- */
-    if ((accept        == DEF_YES) &&
-        (child_present == DEF_NO) ) {
+    if (timeout_ms == DEF_INT_32U_MAX_VAL) {
         p_sock_timeout = DEF_NULL;
     } else {
-        sock_timeout.timeout_sec =  0;
-        sock_timeout.timeout_us  =  HTTPs_SOCK_SEL_TIMEOUT_MS * DEF_TIME_NBR_uS_PER_SEC / DEF_TIME_NBR_mS_PER_SEC;
+        sock_timeout.timeout_sec =   timeout_ms / DEF_TIME_NBR_mS_PER_SEC;
+        sock_timeout.timeout_us  =  (timeout_ms % DEF_TIME_NBR_mS_PER_SEC) * (DEF_TIME_NBR_uS_PER_SEC / DEF_TIME_NBR_mS_PER_SEC);
         p_sock_timeout           = &sock_timeout;
     }
 
-
-    sel_rtn_code = NetSock_Sel(sock_nbr_max,
-                              &sock_desc_rd,
-                              &sock_desc_wr,
-                              &sock_desc_err,
-                               p_sock_timeout,
-                              &err);
-    switch (err) {
-        case NET_SOCK_ERR_NONE:
-        case NET_SOCK_ERR_TIMEOUT:
-             sock_nbr_rdy += sel_rtn_code;
-             break;
-
-
-        case NET_INIT_ERR_NOT_COMPLETED:
-        case NET_SOCK_ERR_INVALID_DESC:
-        case NET_SOCK_ERR_INVALID_TIMEOUT:
-        case NET_SOCK_ERR_INVALID_SOCK:
-        case NET_SOCK_ERR_INVALID_TYPE:
-        case NET_SOCK_ERR_NOT_USED:
-        case NET_ERR_FAULT_LOCK_ACQUIRE:
-        default:
-             HTTPs_ERR_INC(p_ctr_err->Sock_ErrSelCtr);
-             return (sock_nbr_rdy);
+    sock_nbr_rdy = p_evt_api->Wait(p_instance, p_sock_timeout, &err);
+    if (err != HTTPs_ERR_NONE) {
+        HTTPs_ERR_INC(p_ctr_err->Sock_ErrSelCtr);
     }
 
-                                                                /* -------------- ACCEPT NEW CONNECTIONS -------------- */
-    if (accept == DEF_YES) {
-        switch (p_cfg->SockSel) {
-            case HTTPs_SOCK_SEL_IPv4:
-#ifdef NET_IPv4_MODULE_EN
-                 if (NET_SOCK_DESC_IS_SET(p_instance->SockListenID_IPv4, &sock_desc_rd)) {
-                     HTTPsSock_ConnAccept(p_instance, p_instance->SockListenID_IPv4);
-                 }
-#endif
-                 break;
-
-
-            case HTTPs_SOCK_SEL_IPv6:
-#ifdef NET_IPv6_MODULE_EN
-                 if (NET_SOCK_DESC_IS_SET(p_instance->SockListenID_IPv6, &sock_desc_rd)) {
-                     HTTPsSock_ConnAccept(p_instance, p_instance->SockListenID_IPv6);
-                 }
-#endif
-                 break;
-
-
-            case HTTPs_SOCK_SEL_IPv4_IPv6:
-#ifdef NET_IPv4_MODULE_EN
-                 if (NET_SOCK_DESC_IS_SET(p_instance->SockListenID_IPv4, &sock_desc_rd)) {
-                     HTTPsSock_ConnAccept(p_instance, p_instance->SockListenID_IPv4);
-                 }
-#endif
-#ifdef NET_IPv6_MODULE_EN
-                 if (NET_SOCK_DESC_IS_SET(p_instance->SockListenID_IPv6, &sock_desc_rd)) {
-                     HTTPsSock_ConnAccept(p_instance, p_instance->SockListenID_IPv6);
-                 }
-#endif
-                 break;
-
+                                                                /* ------------ EXPIRE CONN DEADLINES ----------------- */
+    HTTPsSock_ConnTmrExpire(p_instance);
 
-            default:
-                 break;
-        }
+                                                                /* --------------- RESUME POLLING CONN ---------------- */
+    if ((wake_req     == DEF_NO) &&                             /* See Note #5b.                                        */
+       ((timeout_ms   == 0u)     ||
+        (sock_nbr_rdy >  0u))) {
+        return (p_instance->ConnRdyCtr);
     }
 
-
-                                                                /* ------------ UPDATE CONN SOCK STATE  --------------- */
-    p_conn = p_instance->ConnFirstPtr;
+    p_conn                       = p_instance->ConnPollFirstPtr;
+    p_instance->ConnPollFirstPtr = DEF_NULL;
+    p_instance->ConnPollCtr      = 0u;
     while (p_conn != DEF_NULL) {
-#if (HTTPs_CFG_PERSISTENT_CONN_EN == DEF_ENABLED)               /* Check if conn is deemed persistent. See Note (1).    */
-        persistent = DEF_BIT_IS_SET(p_conn->Flags, HTTPs_FLAG_CONN_PERSISTENT)      ||
-                     (p_conn->ProtocolVer                  == HTTP_PROTOCOL_VER_1_1 &&
-                      p_instance->CfgPtr->ConnPersistentEn == DEF_TRUE);
-
-        if (persistent == DEF_TRUE) {
-            p_sock = NetSock_GetObj(p_conn->SockID);            /* Check if instance is in the midst of closing.        */
-            if (p_sock != DEF_NULL) {
-                p_sock = NetSock_GetObj(p_sock->ID_SockParent);
-                if (p_sock == DEF_NULL && !accept) {            /* If listen sock is free, consider instance is closing.*/
-                    if (p_conn->SockState == HTTPs_SOCK_STATE_RX) {
-                                                                /* Wait for idle timeout expiry; do not process RX state*/
-                                                                /* Force RESP_COMPLETED state. (See HTTPsConn_Process())*/
-                        p_conn->SockState = HTTPs_SOCK_STATE_NONE;
-                        p_conn->State     = HTTPs_CONN_STATE_RESP_COMPLETED;
-                    }
-                }
-            }
-        }
-#endif
-        switch (p_conn->SockState) {
-            case HTTPs_SOCK_STATE_RX:                           /* Conn rdy to receive data.                            */
-                 if (NET_SOCK_DESC_IS_SET(p_conn->SockID, &sock_desc_rd)) {
-                     DEF_BIT_SET(p_conn->SockFlags, HTTPs_FLAG_SOCK_RDY_RD);    /* Sock rdy.                            */
-                 }
-
-                 if (NET_SOCK_DESC_IS_SET(p_conn->SockID, &sock_desc_err)) {
-                     DEF_BIT_SET(p_conn->SockFlags, HTTPs_FLAG_SOCK_RDY_ERR);   /* Sock Err is pending.                 */
-                     p_conn->SockState  = HTTPs_SOCK_STATE_ERR;
-                 }
-                 break;
-
-
-            case HTTPs_SOCK_STATE_TX:
-                 if (NET_SOCK_DESC_IS_SET(p_conn->SockID, &sock_desc_wr)) {
-                     DEF_BIT_SET(p_conn->SockFlags, HTTPs_FLAG_SOCK_RDY_WR);    /* Sock rdy.                            */
-                 }
-
-                 if (NET_SOCK_DESC_IS_SET(p_conn->SockID, &sock_desc_err)) {
-                     DEF_BIT_SET(p_conn->SockFlags, HTTPs_FLAG_SOCK_RDY_ERR);   /* Sock Err is pending.                 */
-                     p_conn->SockState  = HTTPs_SOCK_STATE_ERR;
-                 }
-                 break;
-
-
-            case HTTPs_SOCK_STATE_ERR:
-            case HTTPs_SOCK_STATE_NONE:                         /* Conn needs to be processed.                          */
-                 if (NET_SOCK_DESC_IS_SET(p_conn->SockID, &sock_desc_err)) {
-                     DEF_BIT_SET(p_conn->SockFlags, HTTPs_FLAG_SOCK_RDY_ERR);   /* Sock Err is pending.                 */
-                     p_conn->SockState  = HTTPs_SOCK_STATE_ERR;
-                 }
-                 sock_nbr_rdy++;
-                 break;
-
-
-            default:
-                 break;
-        }
-
-        p_conn = p_conn->ConnNextPtr;
+        p_conn_next             = p_conn->ConnPollNextPtr;
+        p_conn->ConnPollNextPtr = DEF_NULL;
+        p_conn->ConnPollPrevPtr = DEF_NULL;
+        DEF_BIT_CLR(p_conn->SockFlags, (HTTPs_FLAGS)HTTPs_FLAG_SOCK_EVT_POLL);
+        HTTPsSock_ConnRdyAdd(p_instance, p_conn);
+        p_conn = p_conn_next;
     }
 
-    return (sock_nbr_rdy);
+    return (p_instance->ConnRdyCtr);
 }
 
 
@@ -652,7 +660,19 @@ NET_SOCK_QTY  HTTPsSock_ConnSel (HTTPs_INSTANCE  *p_instance,
 *
 * Caller(s)   : HTTPsConn_Process().
 *
-* Note(s)     : none.
+* Note(s)     : (1) Data is received after the data not yet parsed, which stays where it is in the buffer.
+*                   The data not yet parsed is only moved back to the beginning of the buffer when the free
+*                   space at the end of the buffer is smaller than the space already parsed at its beginning,
+*                   so each move at least doubles the space available to receive. The number of octets moved
+*                   is counted in 'Sock_StatOctetRxMovedCtr'.
+*
+*               (2) While the request body is received, no more than the remaining body length is received
+*                   so that the next request (see HTTPsReq_PipelineSave()) stays in the socket receive queue
+*                   and is not mixed with the body data.
+*
+*               (3) Once the whole body is in the buffer, nothing more is received. A body parser that still
+*                   requires data is given a request shorter than its Content-Length, so the request is
+*                   rejected as malformed.
 *********************************************************************************************************
 */
 
@@ -663,6 +683,8 @@ CPU_BOOLEAN  HTTPsSock_ConnDataRx (HTTPs_INSTANCE  *p_instance,
     NET_SOCK_ADDR_LEN      addr_len_client;
     CPU_INT16U             rx_len;
     CPU_INT32U             buf_len;
+    CPU_INT32U             buf_len_head;
+    CPU_INT32U             body_len_rem;
     HTTPs_INSTANCE_STATS  *p_ctr_stats;
     HTTPs_INSTANCE_ERRS   *p_ctr_err;
     CPU_BOOLEAN            rtn_val;
@@ -672,14 +694,48 @@ CPU_BOOLEAN  HTTPsSock_ConnDataRx (HTTPs_INSTANCE  *p_instance,
     HTTPs_SET_PTR_STATS(p_ctr_stats, p_instance);
     HTTPs_SET_PTR_ERRS( p_ctr_err,   p_instance);
 
-    if ((p_conn->RxBufLenRem > 0) &&
-        (p_conn->RxBufPtr   != p_conn->BufPtr)) {               /* If data is still present in the rx buf.              */
+    if (p_conn->RxBufLenRem == 0u) {                            /* If all data parsed, rx from the beginning of buf.    */
+        p_conn->RxBufPtr = p_conn->BufPtr;
+    }
+
+    buf_len_head = p_conn->RxBufPtr - p_conn->BufPtr;
+    buf_len      = p_conn->BufLen   - buf_len_head - p_conn->RxBufLenRem;
+
+    if (buf_len < buf_len_head) {                               /* See Note #1.                                         */
                                                                 /* Move rem data to the beginning of the rx buf.        */
         Mem_Copy(p_conn->BufPtr, p_conn->RxBufPtr, p_conn->RxBufLenRem);
+        HTTPs_STATS_OCTET_INC(p_ctr_stats->Sock_StatOctetRxMovedCtr, p_conn->RxBufLenRem);
+        p_conn->RxBufPtr = p_conn->BufPtr;
+        buf_len         += buf_len_head;
     }
 
-    p_buf   = p_conn->BufPtr + p_conn->RxBufLenRem;
-    buf_len = p_conn->BufLen - p_conn->RxBufLenRem;
+    p_buf = p_conn->RxBufPtr + p_conn->RxBufLenRem;
+
+    switch (p_conn->State) {                                    /* Don't rx past the req body (see Note #2).            */
+        case HTTPs_CONN_STATE_REQ_BODY_DATA:
+        case HTTPs_CONN_STATE_REQ_BODY_FLUSH_DATA:
+        case HTTPs_CONN_STATE_REQ_BODY_FORM_APP_PARSE:
+        case HTTPs_CONN_STATE_REQ_BODY_FORM_MULTIPART_INIT:
+        case HTTPs_CONN_STATE_REQ_BODY_FORM_MULTIPART_PARSE:
+        case HTTPs_CONN_STATE_REQ_BODY_FORM_MULTIPART_FILE_OPEN:
+        case HTTPs_CONN_STATE_REQ_BODY_FORM_MULTIPART_FILE_WR:
+             body_len_rem = p_conn->ReqContentLenRxd + p_conn->RxBufLenRem;
+             if (body_len_rem < p_conn->ReqContentLen) {
+                 body_len_rem = p_conn->ReqContentLen - body_len_rem;
+                 buf_len      = DEF_MIN(buf_len, body_len_rem);
+             } else {                                           /* See Note #3.                                         */
+                 HTTPs_ERR_INC(p_ctr_err->Req_ErrInvalidCtr);
+                 p_conn->ErrCode   = HTTPs_ERR_REQ_FORMAT_INVALID;
+                 p_conn->State     = HTTPs_CONN_STATE_ERR_INTERNAL;
+                 p_conn->SockState = HTTPs_SOCK_STATE_NONE;
+                 rtn_val           = DEF_OK;
+                 goto exit;
+             }
+             break;
+
+        default:
+             break;
+    }
 
     if (buf_len == 0) {
         rtn_val = DEF_OK;
@@ -700,7 +756,6 @@ CPU_BOOLEAN  HTTPsSock_ConnDataRx (HTTPs_INSTANCE  *p_instance,
     switch (err) {
         case NET_SOCK_ERR_NONE:                                 /* Data received.                                       */
         case NET_SOCK_ERR_INVALID_DATA_SIZE:
-             p_conn->RxBufPtr      = p_conn->BufPtr;
              p_conn->RxBufLenRem  += rx_len;
              HTTPs_STATS_OCTET_INC(p_ctr_stats->Sock_StatOctetRxdCtr, rx_len);
              break;
@@ -710,7 +765,6 @@ CPU_BOOLEAN  HTTPsSock_ConnDataRx (HTTPs_INSTANCE  *p_instance,
         case NET_INIT_ERR_NOT_COMPLETED:
         case NET_SOCK_ERR_RX_Q_EMPTY:
         case NET_ERR_FAULT_LOCK_ACQUIRE:
-             p_conn->RxBufPtr = p_conn->BufPtr;
              HTTPs_ERR_INC(p_ctr_err->Sock_ErrRxCtr);
              rtn_val = DEF_FAIL;
              goto exit;
@@ -758,7 +812,8 @@ exit:
 *
 * Caller(s)   : HTTPsConn_Process().
 *
-* Note(s)     : none.
+* Note(s)     : (1) When the file data is transmitted by the file system (see HTTPsResp_DataTransferStd()
+*                   Note #3), the connection buffer is empty and the file is transmitted instead.
 *********************************************************************************************************
 */
 
@@ -769,12 +824,19 @@ CPU_BOOLEAN HTTPsSock_ConnDataTx (HTTPs_INSTANCE  *p_instance,
     NET_SOCK_RTN_CODE      tx_len;
     HTTPs_INSTANCE_STATS  *p_ctr_stats;
     HTTPs_INSTANCE_ERRS   *p_ctr_err;
+    CPU_BOOLEAN            file_tx;
     NET_ERR                err;
 
 
     HTTPs_SET_PTR_STATS(p_ctr_stats, p_instance);
     HTTPs_SET_PTR_ERRS( p_ctr_err,   p_instance);
 
+    file_tx = DEF_BIT_IS_SET(p_conn->Flags, HTTPs_FLAG_RESP_FILE_TX);
+    if ((file_tx           == DEF_YES) &&                       /* Tx from the file (see Note #1).                      */
+        (p_conn->TxDataLen == 0u)) {
+        return (HTTPsSock_ConnFileTx(p_instance, p_conn));
+    }
+
     addr_len_client = sizeof(p_conn->ClientAddr);
 
     tx_len = NetSock_TxDataTo(p_conn->SockID,
@@ -890,133 +952,1861 @@ void  HTTPsSock_ConnClose (HTTPs_INSTANCE  *p_instance,
 
 /*
 *********************************************************************************************************
-*********************************************************************************************************
-*                                           LOCAL FUNCTIONS
-*********************************************************************************************************
+*                                       HTTPsSock_ConnEvtUpdate()
+*
+* Description : (1) Update connection socket events after the connection has been processed:
+*
+*                   (a) Clear socket ready flags
+*                   (b) Queue connection in ready list, if no socket operation is required
+*                   (c) Update socket events registered with the backend, if changed
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceStart().
+*
+*               p_conn      Pointer to the connection.
+*               ------      Argument validated in HTTPsSock_ConnAccept().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPsConn_Process(),
+*               HTTPsSock_ConnSel(),
+*               HTTPsSock_ConnAccept().
+*
+* Note(s)     : (1) Connections in the NONE, ERR or CLOSE socket states do not wait for any socket event and
+*                   must be processed on the next pass (see HTTPsConn_Process()).
+*
+*               (2) A connection with a full receive buffer can't receive more data & must be processed on the
+*                   next pass to consume the data already received.
 *********************************************************************************************************
 */
 
+void  HTTPsSock_ConnEvtUpdate (HTTPs_INSTANCE  *p_instance,
+                               HTTPs_CONN      *p_conn)
+{
+    const  HTTPs_SOCK_EVT_API  *p_evt_api;
+           HTTPs_FLAGS          interest;
+
+
+    DEF_BIT_CLR(p_conn->SockFlags, (HTTPs_FLAGS)(HTTPs_FLAG_SOCK_RDY_RD |
+                                                 HTTPs_FLAG_SOCK_RDY_WR |
+                                                 HTTPs_FLAG_SOCK_RDY_ERR));
+
+    switch (p_conn->SockState) {
+        case HTTPs_SOCK_STATE_RX:                               /* Conn waits to receive data.                          */
+             interest = (HTTPs_FLAG_SOCK_RDY_RD | HTTPs_FLAG_SOCK_RDY_ERR);
+             if (p_conn->RxBufLenRem >= p_conn->BufLen) {       /* See Note #2.                                         */
+                 HTTPsSock_ConnRdyAdd(p_instance, p_conn);
+             }
+             break;
+
+
+        case HTTPs_SOCK_STATE_TX:                               /* Conn waits to tx data.                               */
+             interest = (HTTPs_FLAG_SOCK_RDY_WR | HTTPs_FLAG_SOCK_RDY_ERR);
+             break;
+
+
+        case HTTPs_SOCK_STATE_ERR:                              /* See Note #1.                                         */
+        case HTTPs_SOCK_STATE_CLOSE:
+        case HTTPs_SOCK_STATE_NONE:
+        default:
+             interest = HTTPs_FLAG_NONE;
+             HTTPsSock_ConnRdyAdd(p_instance, p_conn);
+             break;
+    }
+
+    if (interest != p_conn->SockEvtInterest) {
+        p_evt_api = p_instance->SockEvtAPI_Ptr;
+        p_evt_api->ConnSet(p_instance, p_conn, interest);
+        p_conn->SockEvtInterest = interest;
+    }
+}
+
+
 /*
 *********************************************************************************************************
-*                                          HTTPsSock_ConnAccept()
+*                                        HTTPsSock_ConnEvtPoll()
 *
-* Description : (1) Accept new incoming connection:
-*
-*                   (a) Accept incoming connection.
-*                   (b) Configure TCP   connection MSL timeout.
-*                   (b) Acquire free    connection structure for the new accepted connection request.
+* Description : Set a connection waiting for the application, i.e. without any socket event to wait for.
 *
 * Argument(s) : p_instance  Pointer to the instance.
 *               ----------  Argument validated in HTTPs_InstanceStart().
 *
+*               p_conn      Pointer to the connection.
+*               ------      Argument validated in HTTPsSock_ConnAccept().
+*
 * Return(s)   : none.
 *
-* Caller(s)   : HTTPsSock_ConnSel().
+* Caller(s)   : HTTPsConn_Process().
 *
-* Note(s)     : none.
+* Note(s)     : (1) The connection is kept in the instance poll list instead of the ready list, so it can't
+*                   keep the instance task busy. The whole poll list is moved to the ready list by
+*                   HTTPsSock_ConnSel() when the instance is woken up (see HTTPsSock_ConnSel() Note #5b), so
+*                   resuming connections never walks the idle connections.
 *********************************************************************************************************
 */
 
-static  void  HTTPsSock_ConnAccept (HTTPs_INSTANCE  *p_instance,
-                                    NET_SOCK_ID      sock_listen_id)
+void  HTTPsSock_ConnEvtPoll (HTTPs_INSTANCE  *p_instance,
+                             HTTPs_CONN      *p_conn)
 {
-        HTTPs_CONN            *p_conn;
-        HTTPs_INSTANCE_ERRS   *p_ctr_err;
-        HTTPs_INSTANCE_STATS  *p_ctr_stats;
-    const  HTTPs_CFG             *p_cfg = p_instance->CfgPtr;
-        NET_SOCK_ID            sock_id;
-        NET_SOCK_ADDR          client_addr;
-        NET_SOCK_ADDR_LEN      addr_len;
-        CPU_BOOLEAN            done;
-        NET_TCP_CONN_ID        conn_id_tcp;
-        NET_ERR                err_net;
+    const  HTTPs_SOCK_EVT_API  *p_evt_api;
+           CPU_BOOLEAN          polling;
 
 
-    HTTPs_SET_PTR_STATS(p_ctr_stats, p_instance);
-    HTTPs_SET_PTR_ERRS( p_ctr_err,   p_instance);
+    DEF_BIT_CLR(p_conn->SockFlags, (HTTPs_FLAGS)(HTTPs_FLAG_SOCK_RDY_RD |
+                                                 HTTPs_FLAG_SOCK_RDY_WR |
+                                                 HTTPs_FLAG_SOCK_RDY_ERR));
 
+    if (p_conn->SockEvtInterest != HTTPs_FLAG_NONE) {
+        p_evt_api = p_instance->SockEvtAPI_Ptr;
+        p_evt_api->ConnSet(p_instance, p_conn, HTTPs_FLAG_NONE);
+        p_conn->SockEvtInterest = HTTPs_FLAG_NONE;
+    }
 
-    done = DEF_NO;
-    while (done != DEF_YES) {
-        CPU_BOOLEAN  close_sock = DEF_NO;
-        CPU_BOOLEAN  flag       = DEF_DISABLED;
+    polling = DEF_BIT_IS_SET(p_conn->SockFlags, HTTPs_FLAG_SOCK_EVT_POLL);
+    if (polling == DEF_NO) {                                    /* Add conn to the instance poll list.                  */
+        p_conn->ConnPollPrevPtr      = DEF_NULL;
+        p_conn->ConnPollNextPtr      = p_instance->ConnPollFirstPtr;
+        if (p_instance->ConnPollFirstPtr != DEF_NULL) {
+            p_instance->ConnPollFirstPtr->ConnPollPrevPtr = p_conn;
+        }
+        p_instance->ConnPollFirstPtr = p_conn;
+        p_instance->ConnPollCtr++;
+        DEF_BIT_SET(p_conn->SockFlags, HTTPs_FLAG_SOCK_EVT_POLL);
+    }
+}
 
-                                                                /* ---------------- ACCEPT INCOMING REQ --------------- */
-        addr_len = sizeof(client_addr);
 
-        sock_id = NetSock_Accept(sock_listen_id,
-                                &client_addr,
+/*
+*********************************************************************************************************
+*                                       HTTPsSock_ConnEvtRemove()
+*
+* Description : Remove connection from the socket event backend, from the instance ready list and from
+*               the instance timer wheel.
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceStart().
+*
+*               p_conn      Pointer to the connection.
+*               ------      Argument validated in HTTPsSock_ConnAccept().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPsMem_ConnRelease().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  HTTPsSock_ConnEvtRemove (HTTPs_INSTANCE  *p_instance,
+                               HTTPs_CONN      *p_conn)
+{
+    const  HTTPs_SOCK_EVT_API  *p_evt_api;
+           HTTPs_CONN          *p_conn_next;
+           HTTPs_CONN          *p_conn_prev;
+           CPU_BOOLEAN          queued;
+           CPU_BOOLEAN          polling;
+
+
+    if (p_conn->SockEvtInterest != HTTPs_FLAG_NONE) {           /* ------------- UNREGISTER FROM BACKEND -------------- */
+        p_evt_api = p_instance->SockEvtAPI_Ptr;
+        p_evt_api->ConnSet(p_instance, p_conn, HTTPs_FLAG_NONE);
+        p_conn->SockEvtInterest = HTTPs_FLAG_NONE;
+    }
+
+    HTTPsSock_ConnTmrStop(p_instance, p_conn);                  /* ---------------- REMOVE FROM TMR ------------------- */
+
+    polling = DEF_BIT_IS_SET(p_conn->SockFlags, HTTPs_FLAG_SOCK_EVT_POLL);
+    if (polling == DEF_YES) {                                   /* ---------------- REMOVE FROM POLL ------------------ */
+        p_conn_prev = p_conn->ConnPollPrevPtr;
+        p_conn_next = p_conn->ConnPollNextPtr;
+
+        if (p_conn_prev == DEF_NULL) {
+            p_instance->ConnPollFirstPtr = p_conn_next;
+        } else {
+            p_conn_prev->ConnPollNextPtr = p_conn_next;
+        }
+
+        if (p_conn_next != DEF_NULL) {
+            p_conn_next->ConnPollPrevPtr = p_conn_prev;
+        }
+
+        p_instance->ConnPollCtr--;
+
+        p_conn->ConnPollNextPtr = DEF_NULL;
+        p_conn->ConnPollPrevPtr = DEF_NULL;
+        DEF_BIT_CLR(p_conn->SockFlags, (HTTPs_FLAGS)HTTPs_FLAG_SOCK_EVT_POLL);
+    }
+
+                                                                /* -------------- REMOVE FROM RDY LIST ---------------- */
+    queued = DEF_BIT_IS_SET(p_conn->SockFlags, HTTPs_FLAG_SOCK_EVT_QUEUED);
+    if (queued == DEF_NO) {
+        return;
+    }
+
+    p_conn_prev = p_conn->ConnRdyPrevPtr;
+    p_conn_next = p_conn->ConnRdyNextPtr;
+
+    if (p_conn_prev == DEF_NULL) {
+        p_instance->ConnRdyFirstPtr = p_conn_next;
+    } else {
+        p_conn_prev->ConnRdyNextPtr = p_conn_next;
+    }
+
+    if (p_conn_next == DEF_NULL) {
+        p_instance->ConnRdyLastPtr  = p_conn_prev;
+    } else {
+        p_conn_next->ConnRdyPrevPtr = p_conn_prev;
+    }
+
+    p_instance->ConnRdyCtr--;
+
+    p_conn->ConnRdyNextPtr = DEF_NULL;
+    p_conn->ConnRdyPrevPtr = DEF_NULL;
+    DEF_BIT_CLR(p_conn->SockFlags, (HTTPs_FLAGS)HTTPs_FLAG_SOCK_EVT_QUEUED);
+}
+
+
+/*
+*********************************************************************************************************
+*                                     HTTPsSock_ConnOverloadInit()
+*
+* Description : Initialize the admission control state & build the response transmitted to the connections
+*               rejected in overload.
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceInit().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPs_InstanceInit().
+*
+* Note(s)     : (1) The response only depends on the instance configuration, so it is built once & transmitted
+*                   as is for each rejected connection :
+*
+*                       HTTP/1.1 503 Service Unavailable
+*                       Content-Length: 0
+*                       Connection: close
+*                       Retry-After: <ConnOverloadRetryAfter_s>
+*********************************************************************************************************
+*/
+
+void  HTTPsSock_ConnOverloadInit (HTTPs_INSTANCE  *p_instance)
+{
+    const  HTTPs_CFG   *p_cfg;
+           CPU_CHAR    *p_str;
+           CPU_SIZE_T   len;
+
+
+    p_cfg = p_instance->CfgPtr;
+
+    p_instance->ConnOverloadActive = DEF_NO;
+
+                                                                /* ---------------- BUILD OVERLOAD RESP --------------- */
+    p_str = p_instance->ConnOverloadRespBuf;
+    len   = sizeof(HTTPs_CONN_OVERLOAD_RESP_STR_HDR) - 1u;
+    Mem_Copy(p_str, HTTPs_CONN_OVERLOAD_RESP_STR_HDR, len);
+    p_str += len;
+
+   (void)Str_FmtNbr_Int32U(p_cfg->ConnOverloadRetryAfter_s,
+                           DEF_INT_16U_NBR_DIG_MAX,
+                           DEF_NBR_BASE_DEC,
+                           ASCII_CHAR_NULL,
+                           DEF_NO,
+                           DEF_YES,
+                           p_str);
+    p_str += Str_Len_N(p_str, DEF_INT_16U_NBR_DIG_MAX);
+
+    Mem_Copy(p_str, STR_CR_LF STR_CR_LF, 2u * STR_CR_LF_LEN);
+    p_str += 2u * STR_CR_LF_LEN;
+
+    p_instance->ConnOverloadRespLen = (CPU_INT16U)(p_str - p_instance->ConnOverloadRespBuf);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        HTTPsSock_ConnTmrSet()
+*
+* Description : Set the transaction phase timed by the connection timer & arm the deadline of that phase.
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceStart().
+*
+*               p_conn      Pointer to the connection.
+*               ------      Argument validated in HTTPsSock_ConnAccept().
+*
+*               phase       Transaction phase to time :
+*
+*                               HTTPs_CONN_TMR_PHASE_NONE       No deadline.
+*                               HTTPs_CONN_TMR_PHASE_REQ_HDR    Request line & headers reception.
+*                               HTTPs_CONN_TMR_PHASE_REQ_BODY   Request body reception.
+*                               HTTPs_CONN_TMR_PHASE_IDLE       Persistent connection idle between requests.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPsConn_Process(),
+*               HTTPsSock_ConnTmrUpdate().
+*
+* Note(s)     : (1) The deadline of the previous phase is cancelled. A phase configured with a null timeout
+*                   has no deadline, only the connection inactivity timeout applies.
+*
+*               (2) The deadline covers the whole phase & is not pushed back when data is received, so a
+*                   client that sends its request a few octets at a time can't hold the connection.
+*
+*               (3) The instance timer wheel is a hashed timing wheel of HTTPs_CONN_TMR_WHEEL_SLOT_NBR slots,
+*                   one slot per HTTPs_SOCK_CONN_TMR_TICK_MS period :
+*
+*                   (a) The connection is inserted in the slot visited on the first period that ends after
+*                       its deadline. Deadlines further than one wheel revolution stay in their slot until
+*                       the revolution that reaches them.
+*
+*                   (b) Each slot is a doubly-linked list, so arming & cancelling a deadline is done in
+*                       constant time without walking the other connections.
+*
+*                   (c) When no deadline is pending, the wheel time base is re-synchronized on the current
+*                       time so that the wheel is never advanced over periods without deadlines.
+*
+*               (4) The phase deadline is recorded even if the phase has no timeout configured, so that idle
+*                   connections can be ordered from the least recently active (see HTTPsSock_ConnAdmit()).
+*********************************************************************************************************
+*/
+
+void  HTTPsSock_ConnTmrSet (HTTPs_INSTANCE        *p_instance,
+                            HTTPs_CONN            *p_conn,
+                            HTTPs_CONN_TMR_PHASE   phase)
+{
+    const  HTTPs_CFG   *p_cfg;
+           NET_TS_MS    ts_cur;
+           CPU_INT32U   timeout_ms;
+           CPU_INT32U   tick_nbr;
+           CPU_INT08U   slot_ix;
+
+
+    p_cfg = p_instance->CfgPtr;
+
+    HTTPsSock_ConnTmrStop(p_instance, p_conn);                  /* Cancel deadline of prev phase (see Note #1).         */
+    p_conn->TmrPhase = phase;
+
+    switch (phase) {
+        case HTTPs_CONN_TMR_PHASE_REQ_HDR:
+             timeout_ms = (CPU_INT32U)p_cfg->ConnReqHdrTimeout_s  * DEF_TIME_NBR_mS_PER_SEC;
+             break;
+
+
+        case HTTPs_CONN_TMR_PHASE_REQ_BODY:
+             timeout_ms = (CPU_INT32U)p_cfg->ConnReqBodyTimeout_s * DEF_TIME_NBR_mS_PER_SEC;
+             break;
+
+
+        case HTTPs_CONN_TMR_PHASE_IDLE:
+             timeout_ms = (CPU_INT32U)p_cfg->ConnIdleTimeout_s    * DEF_TIME_NBR_mS_PER_SEC;
+             break;
+
+
+        case HTTPs_CONN_TMR_PHASE_NONE:
+        default:
+             return;
+    }
+
+    ts_cur                 = NetUtil_TS_Get_ms();
+    p_conn->TmrDeadline_ms = ts_cur + timeout_ms;               /* See Note #4.                                         */
+
+    if (timeout_ms == 0u) {                                     /* No deadline for this phase.                          */
+        return;
+    }
+
+                                                                /* -------------------- ARM DEADLINE ------------------ */
+    if (p_instance->ConnTmrCtr == 0u) {                         /* See Note #3c.                                        */
+        p_instance->ConnTmrWheelTS_ms = ts_cur;
+    }
+                                                                /* Nbr of periods until deadline (see Note #3a).        */
+    tick_nbr = ((p_conn->TmrDeadline_ms - p_instance->ConnTmrWheelTS_ms) + (HTTPs_SOCK_CONN_TMR_TICK_MS - 1u))
+             /   HTTPs_SOCK_CONN_TMR_TICK_MS;
+    slot_ix  = (CPU_INT08U)((p_instance->ConnTmrWheelSlotIx + tick_nbr) & (HTTPs_CONN_TMR_WHEEL_SLOT_NBR - 1u));
+
+    p_conn->TmrSlotIx  = slot_ix;                               /* Insert conn at head of slot (see Note #3b).          */
+    p_conn->TmrPrevPtr = DEF_NULL;
+    p_conn->TmrNextPtr = p_instance->ConnTmrWheel[slot_ix];
+    if (p_conn->TmrNextPtr != DEF_NULL) {
+        p_conn->TmrNextPtr->TmrPrevPtr = p_conn;
+    }
+    p_instance->ConnTmrWheel[slot_ix] = p_conn;
+    p_instance->ConnTmrCtr++;
+
+    DEF_BIT_SET(p_conn->SockFlags, HTTPs_FLAG_SOCK_EVT_TMR);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       HTTPsSock_ConnTmrUpdate()
+*
+* Description : Update the transaction phase timed by the connection timer after the connection has been
+*               processed.
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceStart().
+*
+*               p_conn      Pointer to the connection.
+*               ------      Argument validated in HTTPsSock_ConnAccept().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPsConn_Process(),
+*               HTTPsSock_ConnAccept(),
+*               HTTPsSock_WorkerConnGet().
+*
+* Note(s)     : (1) The deadline is only re-armed when the phase changes (see HTTPsSock_ConnTmrSet() Note #2).
+*
+*               (2) A persistent connection waiting for its next request stays in the idle phase set by
+*                   HTTPsConn_Process() until the first octet of the request is received. A new connection
+*                   is in the request header phase as soon as it is accepted.
+*
+*               (3) An internal error may have to receive the remaining request body before the error
+*                   response is transmitted (see 'http-s_conn.c  HTTPsConn_ErrInternal()').
+*********************************************************************************************************
+*/
+
+void  HTTPsSock_ConnTmrUpdate (HTTPs_INSTANCE  *p_instance,
+                               HTTPs_CONN      *p_conn)
+{
+    HTTPs_CONN_TMR_PHASE  phase;
+
+
+    switch (p_conn->State) {
+        case HTTPs_CONN_STATE_REQ_INIT:                         /* See Note #2.                                         */
+             if ((p_conn->TmrPhase    == HTTPs_CONN_TMR_PHASE_IDLE) &&
+                 (p_conn->RxBufLenRem == 0u)) {
+                 phase = HTTPs_CONN_TMR_PHASE_IDLE;
+             } else {
+                 phase = HTTPs_CONN_TMR_PHASE_REQ_HDR;
+             }
+             break;
+
+
+        case HTTPs_CONN_STATE_REQ_PARSE_METHOD:
+        case HTTPs_CONN_STATE_REQ_PARSE_URI:
+        case HTTPs_CONN_STATE_REQ_PARSE_QUERY_STRING:
+        case HTTPs_CONN_STATE_REQ_PARSE_PROTOCOL_VERSION:
+        case HTTPs_CONN_STATE_REQ_PARSE_HDR:
+        case HTTPs_CONN_STATE_REQ_LINE_HDR_HOOK:
+             phase = HTTPs_CONN_TMR_PHASE_REQ_HDR;
+             break;
+
+
+        case HTTPs_CONN_STATE_REQ_BODY_INIT:
+        case HTTPs_CONN_STATE_REQ_BODY_DATA:
+        case HTTPs_CONN_STATE_REQ_BODY_FLUSH_DATA:
+        case HTTPs_CONN_STATE_REQ_BODY_FORM_APP_PARSE:
+        case HTTPs_CONN_STATE_REQ_BODY_FORM_MULTIPART_INIT:
+        case HTTPs_CONN_STATE_REQ_BODY_FORM_MULTIPART_PARSE:
+        case HTTPs_CONN_STATE_REQ_BODY_FORM_MULTIPART_FILE_OPEN:
+        case HTTPs_CONN_STATE_REQ_BODY_FORM_MULTIPART_FILE_WR:
+             phase = HTTPs_CONN_TMR_PHASE_REQ_BODY;
+             break;
+
+
+        case HTTPs_CONN_STATE_ERR_INTERNAL:                     /* See Note #3.                                         */
+             if (p_conn->SockState == HTTPs_SOCK_STATE_RX) {
+                 phase = HTTPs_CONN_TMR_PHASE_REQ_BODY;
+             } else {
+                 phase = HTTPs_CONN_TMR_PHASE_NONE;
+             }
+             break;
+
+
+        default:                                                /* App processing & resp tx have no deadline.           */
+             phase = HTTPs_CONN_TMR_PHASE_NONE;
+             break;
+    }
+
+    if (phase != p_conn->TmrPhase) {                            /* See Note #1.                                         */
+        HTTPsSock_ConnTmrSet(p_instance, p_conn, phase);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        HTTPsSock_ConnRdyGet()
+*
+* Description : Remove the first connection from the instance ready list.
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceStart().
+*
+* Return(s)   : Pointer to the connection ready to be processed, if any.
+*
+*               Null pointer,                                    otherwise.
+*
+* Caller(s)   : HTTPsConn_Process().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+HTTPs_CONN  *HTTPsSock_ConnRdyGet (HTTPs_INSTANCE  *p_instance)
+{
+    HTTPs_CONN  *p_conn;
+
+
+    p_conn = p_instance->ConnRdyFirstPtr;
+    if (p_conn == DEF_NULL) {
+        return (DEF_NULL);
+    }
+
+    p_instance->ConnRdyFirstPtr = p_conn->ConnRdyNextPtr;
+    if (p_instance->ConnRdyFirstPtr == DEF_NULL) {
+        p_instance->ConnRdyLastPtr = DEF_NULL;
+    } else {
+        p_instance->ConnRdyFirstPtr->ConnRdyPrevPtr = DEF_NULL;
+    }
+    p_instance->ConnRdyCtr--;
+
+    p_conn->ConnRdyNextPtr = DEF_NULL;
+    DEF_BIT_CLR(p_conn->SockFlags, (HTTPs_FLAGS)HTTPs_FLAG_SOCK_EVT_QUEUED);
+
+    return (p_conn);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        HTTPsSock_EvtConnRdy()
+*
+* Description : Report socket events on a connection socket & queue the connection in the ready list.
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceStart().
+*
+*               p_conn      Pointer to the connection.
+*               ------      Argument validated in HTTPsSock_ConnAccept().
+*
+*               rdy_flags   Socket events ready :
+*
+*                               HTTPs_FLAG_SOCK_RDY_RD      Socket ready to be read.
+*                               HTTPs_FLAG_SOCK_RDY_WR      Socket ready to be written.
+*                               HTTPs_FLAG_SOCK_RDY_ERR     Socket error is pending.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Socket event backend 'Wait()' function.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  HTTPsSock_EvtConnRdy (HTTPs_INSTANCE  *p_instance,
+                            HTTPs_CONN      *p_conn,
+                            HTTPs_FLAGS      rdy_flags)
+{
+    CPU_BOOLEAN  rdy_err;
+
+
+    DEF_BIT_SET(p_conn->SockFlags, rdy_flags & (HTTPs_FLAG_SOCK_RDY_RD |
+                                                HTTPs_FLAG_SOCK_RDY_WR |
+                                                HTTPs_FLAG_SOCK_RDY_ERR));
+
+    rdy_err = DEF_BIT_IS_SET(rdy_flags, HTTPs_FLAG_SOCK_RDY_ERR);
+    if (rdy_err == DEF_YES) {                                   /* Sock Err is pending.                                 */
+        p_conn->SockState = HTTPs_SOCK_STATE_ERR;
+    }
+
+    HTTPsSock_ConnRdyAdd(p_instance, p_conn);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       HTTPsSock_EvtListenRdy()
+*
+* Description : Report a listen socket ready & accept the incoming connections.
+*
+* Argument(s) : p_instance      Pointer to the instance.
+*               ----------      Argument validated in HTTPs_InstanceStart().
+*
+*               sock_listen_id  Listen socket ID.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : Socket event backend 'Wait()' function.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  HTTPsSock_EvtListenRdy (HTTPs_INSTANCE  *p_instance,
+                              NET_SOCK_ID      sock_listen_id)
+{
+    if (p_instance->SockListenEvtEn != DEF_YES) {
+        return;
+    }
+
+    HTTPsSock_ConnAccept(p_instance, sock_listen_id);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       HTTPsSock_InstanceWake()
+*
+* Description : Wake up an instance task waiting for socket events.
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceInit().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPs_InstanceStop(),
+*               HTTPs_InstanceWakeUp(),
+*               HTTPs_InstanceWorkerStop(),
+*               HTTPsSock_WorkerConnPost().
+*
+* Note(s)     : (1) The wake up request is kept until the next HTTPsSock_ConnSel() call so it is not lost if
+*                   the instance task is not waiting yet.
+*
+*               (2) A worker without connection pends on its signal instead of the socket event backend. See
+*                   HTTPsSock_ConnSel() Note #4.
+*********************************************************************************************************
+*/
+
+void  HTTPsSock_InstanceWake (HTTPs_INSTANCE  *p_instance)
+{
+    const  HTTPs_SOCK_EVT_API  *p_evt_api;
+           HTTPs_ERR            err;
+
+
+    HTTPsTask_LockAcquire(p_instance->ConnSelAbortLockObj, &err);
+    if (err == HTTPs_ERR_NONE) {
+        p_instance->WakeReq = DEF_YES;                          /* See Note #1.                                         */
+        HTTPsTask_LockRelease(p_instance->ConnSelAbortLockObj);
+    }
+
+    p_evt_api = p_instance->SockEvtAPI_Ptr;
+    p_evt_api->Wake(p_instance);
+
+    if (p_instance->WorkerParentPtr != DEF_NULL) {              /* See Note #2.                                         */
+        HTTPsTask_WorkerSignal(p_instance);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                       HTTPsSock_WorkerConnGet()
+*
+* Description : (1) Get the connections handed to a worker by the primary worker :
+*
+*                   (a) Remove accepted socket from the worker handoff queue.
+*                   (b) Acquire free connection structure for the accepted socket.
+*                   (c) Register the connection with the socket event backend.
+*
+* Argument(s) : p_instance  Pointer to the worker instance.
+*               ----------  Argument validated in HTTPs_InstanceInit().
+*
+*               closed      DEF_YES, if the worker is stopping & the handed sockets must be closed.
+*                           DEF_NO,  otherwise.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPsTask_InstanceTaskHandler().
+*
+* Note(s)     : (2) The handoff queue is shared with the primary worker task & MUST be accessed in critical
+*                   sections only. The worker connection list is only accessed by the worker task which
+*                   holds the worker instance lock.
+*********************************************************************************************************
+*/
+
+void  HTTPsSock_WorkerConnGet (HTTPs_INSTANCE  *p_instance,
+                               CPU_BOOLEAN      closed)
+{
+    HTTPs_CONN            *p_conn;
+    HTTPs_INSTANCE_ERRS   *p_ctr_err;
+    HTTPs_WORKER_HANDOFF   handoff;
+    CPU_BOOLEAN            done;
+    NET_ERR                err_net;
+    CPU_SR_ALLOC();
+
+
+    HTTPs_SET_PTR_ERRS(p_ctr_err, p_instance);
+
+    done = DEF_NO;
+    while (done != DEF_YES) {
+                                                                /* ------------- REMOVE FROM HANDOFF Q ---------------- */
+        CPU_CRITICAL_ENTER();                                   /* See Note #2.                                         */
+        if (p_instance->WorkerQ_Ctr == 0u) {
+            CPU_CRITICAL_EXIT();
+            done = DEF_YES;
+            continue;
+        }
+
+        handoff = p_instance->WorkerQ[p_instance->WorkerQ_IxOut];
+        p_instance->WorkerQ_IxOut++;
+        if (p_instance->WorkerQ_IxOut >= p_instance->ConnNbrMax) {
+            p_instance->WorkerQ_IxOut = 0u;
+        }
+        p_instance->WorkerQ_Ctr--;
+        CPU_CRITICAL_EXIT();
+
+        if (closed == DEF_YES) {                                /* Worker is stopping: discard conn.                    */
+           (void)NetSock_Close(handoff.SockID, &err_net);
+            continue;
+        }
+
+                                                                /* --------------- ACQUIRE CONN STRUCT ---------------- */
+        p_conn = HTTPsMem_ConnGet(p_instance,
+                                  handoff.SockID,
+                                  handoff.ClientAddr);
+        if (p_conn == DEF_NULL) {                               /* If no free conn struct avail...                      */
+            HTTPs_ERR_INC(p_ctr_err->Conn_ErrNoneAvailCtr);     /* ... close sock.                                      */
+           (void)NetSock_Close(handoff.SockID, &err_net);
+            continue;
+        }
+
+        p_conn->State = HTTPs_CONN_STATE_REQ_INIT;
+        HTTPsSock_ConnTmrUpdate(p_instance, p_conn);            /* Arm the request hdr deadline.                        */
+        HTTPsSock_ConnEvtUpdate(p_instance, p_conn);            /* Wait for the request data.                           */
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          HTTPsSock_ConnAccept()
+*
+* Description : (1) Accept new incoming connection:
+*
+*                   (a) Accept incoming connection.
+*                   (b) Configure TCP   connection MSL timeout.
+*                   (c) Admit the connection & select the worker that will handle it.
+*                   (d) Acquire free    connection structure for the new accepted connection request.
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceStart().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPsSock_EvtListenRdy().
+*
+* Note(s)     : (2) Only the primary worker accepts connections. A connection handed to another worker is
+*                   queued in the worker handoff queue & its connection structure is acquired by the worker
+*                   task itself. See HTTPsSock_WorkerConnGet().
+*
+*               (3) A connection that can't be served is answered with the precomputed overload response
+*                   before its socket is closed, without acquiring a connection structure. See
+*                   HTTPsSock_ConnAdmit().
+*********************************************************************************************************
+*/
+
+static  void  HTTPsSock_ConnAccept (HTTPs_INSTANCE  *p_instance,
+                                    NET_SOCK_ID      sock_listen_id)
+{
+        HTTPs_CONN            *p_conn;
+        HTTPs_INSTANCE        *p_worker;
+        HTTPs_INSTANCE_ERRS   *p_ctr_err;
+        HTTPs_INSTANCE_STATS  *p_ctr_stats;
+    const  HTTPs_CFG             *p_cfg = p_instance->CfgPtr;
+        CPU_BOOLEAN            posted;
+        NET_SOCK_ID            sock_id;
+        NET_SOCK_ADDR          client_addr;
+        NET_SOCK_ADDR_LEN      addr_len;
+        CPU_BOOLEAN            done;
+        NET_TCP_CONN_ID        conn_id_tcp;
+        NET_ERR                err_net;
+
+
+    HTTPs_SET_PTR_STATS(p_ctr_stats, p_instance);
+    HTTPs_SET_PTR_ERRS( p_ctr_err,   p_instance);
+
+
+    done = DEF_NO;
+    while (done != DEF_YES) {
+        CPU_BOOLEAN  close_sock = DEF_NO;
+        CPU_BOOLEAN  flag       = DEF_DISABLED;
+
+                                                                /* ---------------- ACCEPT INCOMING REQ --------------- */
+        addr_len = sizeof(client_addr);
+
+        sock_id = NetSock_Accept(sock_listen_id,
+                                &client_addr,
                                 &addr_len,
                                 &err_net);
         switch (err_net) {
             case NET_SOCK_ERR_NONE:                             /* New conn accepted.                                   */
                  HTTPs_STATS_INC(p_ctr_stats->Conn_StatAcceptedCtr);
 
-                (void)NetSock_OptSet(sock_id,                   /* Set inactivity timeout.                              */
-                                     NET_SOCK_PROTOCOL_TCP,
-                                     NET_SOCK_OPT_TCP_KEEP_IDLE,
-                            (void *)&p_cfg->ConnInactivityTimeout_s,
-                                     sizeof(p_cfg->ConnInactivityTimeout_s),
-                                    &err_net);
-                 if (err_net != NET_SOCK_ERR_NONE) {
-                     HTTPs_ERR_INC(p_ctr_err->Conn_ErrTmrStartCtr);
-                     close_sock = DEF_YES;
-                     break;
-                 }
+                (void)NetSock_OptSet(sock_id,                   /* Set inactivity timeout.                              */
+                                     NET_SOCK_PROTOCOL_TCP,
+                                     NET_SOCK_OPT_TCP_KEEP_IDLE,
+                            (void *)&p_cfg->ConnInactivityTimeout_s,
+                                     sizeof(p_cfg->ConnInactivityTimeout_s),
+                                    &err_net);
+                 if (err_net != NET_SOCK_ERR_NONE) {
+                     HTTPs_ERR_INC(p_ctr_err->Conn_ErrTmrStartCtr);
+                     close_sock = DEF_YES;
+                     break;
+                 }
+
+
+                (void)NetSock_OptSet(sock_id,                   /* Set NO DELAY option.                                 */
+                                     NET_SOCK_PROTOCOL_TCP,
+                                     NET_SOCK_OPT_TCP_NO_DELAY,
+                            (void *)&flag,
+                                     sizeof(flag),
+                                    &err_net);
+                 if (err_net != NET_SOCK_ERR_NONE) {
+                     close_sock = DEF_YES;
+                     break;
+                 }
+
+                                                                /* ----------------- CFG TCP CONN MSL ----------------- */
+                 conn_id_tcp = NetSock_GetConnTransportID(sock_id, &err_net);
+
+                (void)NetTCP_ConnCfgMSL_Timeout(conn_id_tcp, 0u, &err_net);
+                 if (err_net != NET_TCP_ERR_NONE) {
+                     close_sock = DEF_YES;
+                     break;
+                 }
+
+                                                                /* ------------ ADMIT CONN & SELECT WORKER ------------ */
+                 p_worker = HTTPsSock_ConnAdmit(p_instance);
+                 if (p_worker == DEF_NULL) {                    /* Reject conn (see Note #3).                           */
+                     HTTPsSock_ConnReject(p_instance, sock_id);
+                     close_sock = DEF_YES;
+                     break;
+                 }
+
+                 if (p_worker != p_instance) {                  /* Hand conn to another worker (see Note #2).           */
+                     posted = HTTPsSock_WorkerConnPost(p_worker,
+                                                       sock_id,
+                                                      &client_addr);
+                     if (posted != DEF_OK) {
+                         HTTPs_ERR_INC(p_ctr_err->Conn_ErrNoneAvailCtr);
+                         close_sock = DEF_YES;
+                     }
+                     break;
+                 }
+
+                                                                /* --------------- ACQUIRE CONN STRUCT ---------------- */
+                 p_conn = HTTPsMem_ConnGet(p_instance,
+                                            sock_id,
+                                            client_addr);
+                 if (p_conn != DEF_NULL) {
+                     p_conn->State = HTTPs_CONN_STATE_REQ_INIT;
+                     HTTPsSock_ConnTmrUpdate(p_instance, p_conn);   /* Arm the request hdr deadline.                    */
+                     HTTPsSock_ConnEvtUpdate(p_instance, p_conn);   /* Wait for the request data.                       */
+
+                 } else {                                       /* If no free conn struct avail...                      */
+                                                                /* ... reject & close sock.                             */
+                     HTTPs_ERR_INC(p_ctr_err->Conn_ErrNoneAvailCtr);
+                     HTTPsSock_ConnReject(p_instance, sock_id);
+                     close_sock = DEF_YES;
+                     break;
+                 }
+                 break;
+
+            case NET_INIT_ERR_NOT_COMPLETED:
+            case NET_SOCK_ERR_NONE_AVAIL:
+            case NET_SOCK_ERR_CONN_ACCEPT_Q_NONE_AVAIL:
+            case NET_SOCK_ERR_CONN_SIGNAL_TIMEOUT:
+            case NET_ERR_FAULT_LOCK_ACQUIRE:
+                 done = DEF_YES;
+                 break;
+
+            default:
+                 HTTPs_ERR_INC(p_ctr_err->Sock_ErrAcceptCtr);
+                 close_sock = DEF_YES;
+                 break;
+        }
+
+        if ((close_sock == DEF_YES) &&
+            (sock_id != NET_SOCK_ID_NONE)) {
+            (void)NetSock_Close(sock_id, &err_net);
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         HTTPsSock_ConnAdmit()
+*
+* Description : (1) Admit a newly accepted connection :
+*
+*                   (a) Update the instance overload state.
+*                   (b) Evict the least recently active idle connection, if the instance is overloaded.
+*                   (c) Select the worker that will handle the connection.
+*
+* Argument(s) : p_instance  Pointer to the primary instance.
+*               ----------  Argument validated in HTTPs_InstanceStart().
+*
+* Return(s)   : Pointer to the worker instance that will handle the connection, if admitted.
+*
+*               Null pointer,                                                    if rejected.
+*
+* Caller(s)   : HTTPsSock_ConnAccept().
+*
+* Note(s)     : (2) Admission control is disabled when 'ConnOverloadHighWater' is configured to 0; every
+*                   connection is then handed to a worker.
+*
+*               (3) The instance enters overload when the number of connections in use reaches the
+*                   'ConnOverloadHighWater' mark & leaves it only when that number is down to the
+*                   'ConnOverloadLowWater' mark, so the instance does not alternate between both states on
+*                   each accepted connection. The connections of all the workers are counted (see
+*                   'HTTPsSock_WorkerSel()  Note #2').
+*
+*               (4) While overloaded, a new connection is only admitted if an idle persistent connection can
+*                   be closed in its place :
+*
+*                   (a) Only the connections of the primary worker are accessed by the primary worker task;
+*                       the new connection is then handled by the primary worker.
+*
+*                   (b) The connection idle for the longest time has the earliest idle phase deadline (see
+*                       'HTTPsSock_ConnTmrSet()  Note #4'). Idle connections already queued in the ready list
+*                       have received data & are skipped.
+*
+*                   (c) The connection list is only walked while the instance is overloaded.
+*********************************************************************************************************
+*/
+
+static  HTTPs_INSTANCE  *HTTPsSock_ConnAdmit (HTTPs_INSTANCE  *p_instance)
+{
+    const  HTTPs_CFG             *p_cfg;
+           HTTPs_INSTANCE_STATS  *p_ctr_stats;
+           HTTPs_INSTANCE        *p_worker;
+           HTTPs_CONN            *p_conn;
+           HTTPs_CONN            *p_conn_evict;
+           CPU_INT32U             conn_nbr;
+           CPU_INT08U             worker_ix;
+           CPU_BOOLEAN            queued;
+
+
+    HTTPs_SET_PTR_STATS(p_ctr_stats, p_instance);
+
+    p_cfg = p_instance->CfgPtr;
+
+    if (p_cfg->ConnOverloadHighWater == 0u) {                   /* See Note #2.                                         */
+        return (HTTPsSock_WorkerSel(p_instance));
+    }
+
+                                                                /* -------------- UPDATE OVERLOAD STATE --------------- */
+    conn_nbr = 0u;
+    for (worker_ix = 0u; worker_ix < p_instance->WorkerNbr; worker_ix++) {
+        p_worker  = p_instance->WorkerTbl[worker_ix];
+        conn_nbr += p_worker->ConnActiveCtr + p_worker->WorkerQ_Ctr;
+    }
+
+    if (p_instance->ConnOverloadActive == DEF_NO) {             /* See Note #3.                                         */
+        if (conn_nbr >= p_cfg->ConnOverloadHighWater) {
+            p_instance->ConnOverloadActive = DEF_YES;
+            HTTPs_STATS_INC(p_ctr_stats->Conn_StatOverloadEnterCtr);
+        }
+
+    } else if (conn_nbr <= p_cfg->ConnOverloadLowWater) {
+        p_instance->ConnOverloadActive = DEF_NO;
+        HTTPs_STATS_INC(p_ctr_stats->Conn_StatOverloadExitCtr);
+    }
+
+    if (p_instance->ConnOverloadActive == DEF_NO) {
+        return (HTTPsSock_WorkerSel(p_instance));
+    }
+
+                                                                /* ------------------ EVICT IDLE CONN ----------------- */
+    if (p_cfg->ConnOverloadEvictIdleEn != DEF_ENABLED) {
+        return (DEF_NULL);
+    }
+
+    p_conn_evict = DEF_NULL;
+    p_conn       = p_instance->ConnFirstPtr;
+    while (p_conn != DEF_NULL) {                                /* Find least recently active idle conn (see Note #4b). */
+        queued = DEF_BIT_IS_SET(p_conn->SockFlags, HTTPs_FLAG_SOCK_EVT_QUEUED);
+        if ((p_conn->TmrPhase == HTTPs_CONN_TMR_PHASE_IDLE) &&
+            (queued           == DEF_NO)) {
+            if ((p_conn_evict == DEF_NULL) ||
+                ((CPU_INT32S)(p_conn->TmrDeadline_ms - p_conn_evict->TmrDeadline_ms) < 0)) {
+                p_conn_evict = p_conn;
+            }
+        }
+
+        p_conn = p_conn->ConnNextPtr;
+    }
+
+    if (p_conn_evict == DEF_NULL) {                             /* No idle conn: reject new conn.                       */
+        return (DEF_NULL);
+    }
+
+    HTTPsConn_Evict(p_instance, p_conn_evict);
+
+    return (p_instance);                                        /* See Note #4a.                                        */
+}
+
+
+/*
+*********************************************************************************************************
+*                                        HTTPsSock_ConnReject()
+*
+* Description : Transmit the overload response on a connection that can't be served.
+*
+* Argument(s) : p_instance  Pointer to the primary instance.
+*               ----------  Argument validated in HTTPs_InstanceStart().
+*
+*               sock_id     Accepted socket ID.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPsSock_ConnAccept().
+*
+* Note(s)     : (1) The response is transmitted without blocking, from the instance overload response buffer
+*                   (see HTTPsSock_ConnOverloadInit()). If the socket can't queue it at once, the connection is
+*                   closed without response.
+*
+*               (2) The socket is closed by the caller.
+*********************************************************************************************************
+*/
+
+static  void  HTTPsSock_ConnReject (HTTPs_INSTANCE  *p_instance,
+                                    NET_SOCK_ID      sock_id)
+{
+    const  HTTPs_CFG             *p_cfg;
+           HTTPs_INSTANCE_STATS  *p_ctr_stats;
+           NET_ERR                err_net;
+
+
+    HTTPs_SET_PTR_STATS(p_ctr_stats, p_instance);
+
+    p_cfg = p_instance->CfgPtr;
+
+    if (p_cfg->ConnOverloadHighWater == 0u) {                   /* Admission ctrl disabled: close without resp.         */
+        return;
+    }
+
+   (void)NetSock_TxData(sock_id,                                /* See Note #1.                                         */
+                        p_instance->ConnOverloadRespBuf,
+                        p_instance->ConnOverloadRespLen,
+                        NET_SOCK_FLAG_NO_BLOCK,
+                       &err_net);
+
+    HTTPs_STATS_INC(p_ctr_stats->Conn_StatOverloadRejectedCtr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         HTTPsSock_ConnFileTx()
+*
+* Description : Transmit file data straight from the file with the file system transmit API.
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceStart().
+*
+*               p_conn      Pointer to the connection.
+*               ------      Argument validated in HTTPsSock_ConnAccept().
+*
+* Return(s)   : DEF_OK,   if the file is entirely transmitted.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : HTTPsSock_ConnDataTx().
+*
+* Note(s)     : (1) See HTTPs_FS_TX_API Note #2 for the transmit function requirements.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  HTTPsSock_ConnFileTx (HTTPs_INSTANCE  *p_instance,
+                                           HTTPs_CONN      *p_conn)
+{
+    const  HTTPs_CFG             *p_cfg    = p_instance->CfgPtr;
+    const  HTTPs_FS_TX_API       *p_tx_api = ((HTTPs_CFG_FS_DYN *)p_cfg->FS_CfgPtr)->FS_TxAPI_Ptr;
+           HTTPs_INSTANCE_STATS  *p_ctr_stats;
+           HTTPs_INSTANCE_ERRS   *p_ctr_err;
+           CPU_SIZE_T             len_max;
+           CPU_SIZE_T             tx_len;
+           NET_ERR                err;
+
+
+    HTTPs_SET_PTR_STATS(p_ctr_stats, p_instance);
+    HTTPs_SET_PTR_ERRS( p_ctr_err,   p_instance);
+
+    len_max = p_conn->DataLen - p_conn->DataTxdLen;
+    tx_len  = p_tx_api->FileTx(p_conn->DataPtr,                 /* Tx file data (see Note #1).                          */
+                               p_conn->SockID,
+                               len_max,
+                              &err);
+    switch (err) {
+        case NET_SOCK_ERR_NONE:                                 /* Data transmitted.                                    */
+             HTTPs_STATS_OCTET_INC(p_ctr_stats->Sock_StatOctetTxdCtr, tx_len);
+             p_conn->DataTxdLen += tx_len;
+             if (p_conn->DataTxdLen < p_conn->DataLen) {        /* If file is not entirely transmitted.                 */
+                 return (DEF_FAIL);
+             }
+             DEF_BIT_CLR(p_conn->Flags, HTTPs_FLAG_RESP_FILE_TX);
+             break;
+
+
+        case NET_SOCK_ERR_CLOSED:                               /* Conn closed by peer.                                 */
+        case NET_SOCK_ERR_TX_Q_CLOSED:
+             HTTPs_ERR_INC(p_ctr_err->Sock_ErrTxConnClosedCtr);
+             p_conn->SockState = HTTPs_SOCK_STATE_CLOSE;
+             return (DEF_FAIL);
+
+
+        default:                                                /* Fatal err.                                           */
+             HTTPs_ERR_INC(p_ctr_err->Sock_ErrTxFaultCtr);
+             p_conn->SockState = HTTPs_SOCK_STATE_ERR;
+             return (DEF_FAIL);
+    }
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         HTTPsSock_ConnRdyAdd()
+*
+* Description : Queue connection at the end of the instance ready list, if not already queued.
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceStart().
+*
+*               p_conn      Pointer to the connection.
+*               ------      Argument validated in HTTPsSock_ConnAccept().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPsSock_ConnEvtUpdate(),
+*               HTTPsSock_EvtConnRdy().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  HTTPsSock_ConnRdyAdd (HTTPs_INSTANCE  *p_instance,
+                                    HTTPs_CONN      *p_conn)
+{
+    CPU_BOOLEAN  queued;
+
+
+    queued = DEF_BIT_IS_SET(p_conn->SockFlags, HTTPs_FLAG_SOCK_EVT_QUEUED);
+    if (queued == DEF_YES) {
+        return;
+    }
+
+    p_conn->ConnRdyNextPtr = DEF_NULL;
+    p_conn->ConnRdyPrevPtr = p_instance->ConnRdyLastPtr;
+    if (p_instance->ConnRdyLastPtr == DEF_NULL) {
+        p_instance->ConnRdyFirstPtr = p_conn;
+    } else {
+        p_instance->ConnRdyLastPtr->ConnRdyNextPtr = p_conn;
+    }
+    p_instance->ConnRdyLastPtr = p_conn;
+    p_instance->ConnRdyCtr++;
+
+    DEF_BIT_SET(p_conn->SockFlags, HTTPs_FLAG_SOCK_EVT_QUEUED);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        HTTPsSock_ConnTmrStop()
+*
+* Description : Cancel the deadline of a connection, if armed.
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceStart().
+*
+*               p_conn      Pointer to the connection.
+*               ------      Argument validated in HTTPsSock_ConnAccept().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPsSock_ConnEvtRemove(),
+*               HTTPsSock_ConnTmrExpire(),
+*               HTTPsSock_ConnTmrSet().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  HTTPsSock_ConnTmrStop (HTTPs_INSTANCE  *p_instance,
+                                     HTTPs_CONN      *p_conn)
+{
+    CPU_BOOLEAN  armed;
+
+
+    armed = DEF_BIT_IS_SET(p_conn->SockFlags, HTTPs_FLAG_SOCK_EVT_TMR);
+    if (armed == DEF_NO) {
+        return;
+    }
+
+    if (p_conn->TmrPrevPtr == DEF_NULL) {                       /* Unlink conn from its slot.                           */
+        p_instance->ConnTmrWheel[p_conn->TmrSlotIx] = p_conn->TmrNextPtr;
+    } else {
+        p_conn->TmrPrevPtr->TmrNextPtr = p_conn->TmrNextPtr;
+    }
+
+    if (p_conn->TmrNextPtr != DEF_NULL) {
+        p_conn->TmrNextPtr->TmrPrevPtr = p_conn->TmrPrevPtr;
+    }
+
+    p_conn->TmrPrevPtr = DEF_NULL;
+    p_conn->TmrNextPtr = DEF_NULL;
+    p_instance->ConnTmrCtr--;
+
+    DEF_BIT_CLR(p_conn->SockFlags, (HTTPs_FLAGS)HTTPs_FLAG_SOCK_EVT_TMR);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       HTTPsSock_ConnTmrExpire()
+*
+* Description : (1) Advance the instance timer wheel & close the connections whose deadline has expired :
+*
+*                   (a) Visit the slot of each timer wheel period elapsed since the last call
+*                   (b) Close the expired connections of the slot
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceStart().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPsSock_ConnSel().
+*
+* Note(s)     : (2) Only the slots of the elapsed periods are visited, so the cost does not depend on the
+*                   number of connections. A connection in a visited slot whose deadline is a later wheel
+*                   revolution is left in its slot (see HTTPsSock_ConnTmrSet() Note #3a).
+*
+*               (3) When the instance task did not run for a whole wheel revolution, every slot was visited
+*                   once & the wheel time base is re-synchronized on the current time.
+*
+*               (4) An expired connection is closed without response : the client is too slow to receive
+*                   one & its connection is released on the next pass of HTTPsConn_Process().
+*********************************************************************************************************
+*/
+
+static  void  HTTPsSock_ConnTmrExpire (HTTPs_INSTANCE  *p_instance)
+{
+    HTTPs_INSTANCE_STATS  *p_ctr_stats;
+    HTTPs_CONN            *p_conn;
+    HTTPs_CONN            *p_conn_next;
+    NET_TS_MS              ts_cur;
+    CPU_INT16U             slot_ctr;
+
+
+    HTTPs_SET_PTR_STATS(p_ctr_stats, p_instance);
+
+    ts_cur = NetUtil_TS_Get_ms();
+    if (p_instance->ConnTmrCtr == 0u) {                         /* See 'HTTPsSock_ConnTmrSet() Note #3c'.               */
+        p_instance->ConnTmrWheelTS_ms = ts_cur;
+        return;
+    }
+
+    slot_ctr = 0u;
+    while (((ts_cur - p_instance->ConnTmrWheelTS_ms) >= HTTPs_SOCK_CONN_TMR_TICK_MS) &&
+            (slot_ctr < HTTPs_CONN_TMR_WHEEL_SLOT_NBR)) {
+                                                                /* ------------------ VISIT NEXT SLOT ----------------- */
+        p_instance->ConnTmrWheelTS_ms += HTTPs_SOCK_CONN_TMR_TICK_MS;
+        p_instance->ConnTmrWheelSlotIx = (CPU_INT08U)((p_instance->ConnTmrWheelSlotIx + 1u) &
+                                                      (HTTPs_CONN_TMR_WHEEL_SLOT_NBR    - 1u));
+        slot_ctr++;
+
+        p_conn = p_instance->ConnTmrWheel[p_instance->ConnTmrWheelSlotIx];
+        while (p_conn != DEF_NULL) {
+            p_conn_next = p_conn->TmrNextPtr;
+                                                                /* ---------------- CLOSE EXPIRED CONN ---------------- */
+            if ((CPU_INT32S)(ts_cur - p_conn->TmrDeadline_ms) >= 0) {
+                switch (p_conn->TmrPhase) {
+                    case HTTPs_CONN_TMR_PHASE_REQ_HDR:
+                         HTTPs_STATS_INC(p_ctr_stats->Conn_StatTimeoutReqHdrCtr);
+                         break;
+
+
+                    case HTTPs_CONN_TMR_PHASE_REQ_BODY:
+                         HTTPs_STATS_INC(p_ctr_stats->Conn_StatTimeoutReqBodyCtr);
+                         break;
+
+
+                    case HTTPs_CONN_TMR_PHASE_IDLE:
+                    default:
+                         HTTPs_STATS_INC(p_ctr_stats->Conn_StatTimeoutIdleCtr);
+                         break;
+                }
+
+                HTTPsSock_ConnTmrStop(p_instance, p_conn);
+                p_conn->TmrPhase  = HTTPs_CONN_TMR_PHASE_NONE;
+                p_conn->SockState = HTTPs_SOCK_STATE_CLOSE;     /* See Note #4.                                         */
+                HTTPsSock_ConnEvtUpdate(p_instance, p_conn);
+            }
+
+            p_conn = p_conn_next;
+        }
+    }
+
+    if (slot_ctr >= HTTPs_CONN_TMR_WHEEL_SLOT_NBR) {            /* See Note #3.                                         */
+        p_instance->ConnTmrWheelTS_ms = ts_cur;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         HTTPsSock_WorkerSel()
+*
+* Description : Select the worker that will handle a newly accepted connection.
+*
+* Argument(s) : p_instance  Pointer to the primary instance.
+*               ----------  Argument validated in HTTPs_InstanceStart().
+*
+* Return(s)   : Pointer to the selected worker instance.
+*
+* Caller(s)   : HTTPsSock_ConnAccept().
+*
+* Note(s)     : (1) Workers are selected in round-robin order, skipping the workers whose connections are all
+*                   in use or already handed off. If every worker is full, the primary worker is returned &
+*                   the connection is refused by HTTPsMem_ConnGet().
+*
+*               (2) The connection counter of the other workers is read without acquiring their lock. The
+*                   value is only used as a hint; a worker that runs out of connection closes the handed
+*                   socket itself.
+*********************************************************************************************************
+*/
+
+static  HTTPs_INSTANCE  *HTTPsSock_WorkerSel (HTTPs_INSTANCE  *p_instance)
+{
+    HTTPs_INSTANCE  *p_worker;
+    CPU_INT08U       worker_ix;
+    CPU_INT32U       conn_nbr;
+    CPU_INT08U       i;
+
+
+    if (p_instance->WorkerNbr <= 1u) {
+        return (p_instance);
+    }
+
+    worker_ix = p_instance->WorkerIxNext;
+    for (i = 0u; i < p_instance->WorkerNbr; i++) {              /* See Note #1.                                         */
+        p_worker = p_instance->WorkerTbl[worker_ix];
+
+        worker_ix++;
+        if (worker_ix >= p_instance->WorkerNbr) {
+            worker_ix = 0u;
+        }
+
+                                                                /* See Note #2.                                         */
+        conn_nbr = p_worker->ConnActiveCtr + p_worker->WorkerQ_Ctr;
+        if (conn_nbr < p_worker->ConnNbrMax) {
+            p_instance->WorkerIxNext = worker_ix;
+            return (p_worker);
+        }
+    }
+
+    return (p_instance);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       HTTPsSock_WorkerConnPost()
+*
+* Description : Queue an accepted socket in the handoff queue of a worker & signal the worker.
+*
+* Argument(s) : p_worker        Pointer to the worker instance.
+*               --------        Argument validated in HTTPsSock_WorkerSel().
+*
+*               sock_id         Accepted socket ID.
+*
+*               p_client_addr   Pointer to the client address returned by NetSock_Accept().
+*
+* Return(s)   : DEF_OK,   if the socket was queued.
+*
+*               DEF_FAIL, if the worker handoff queue is full.
+*
+* Caller(s)   : HTTPsSock_ConnAccept().
+*
+* Note(s)     : (1) See HTTPsSock_WorkerConnGet() Note #2.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  HTTPsSock_WorkerConnPost (HTTPs_INSTANCE  *p_worker,
+                                               NET_SOCK_ID      sock_id,
+                                               NET_SOCK_ADDR   *p_client_addr)
+{
+    HTTPs_WORKER_HANDOFF  *p_handoff;
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();                                       /* See Note #1.                                         */
+    if (p_worker->WorkerQ_Ctr >= p_worker->ConnNbrMax) {
+        CPU_CRITICAL_EXIT();
+        return (DEF_FAIL);
+    }
+
+    p_handoff             = &p_worker->WorkerQ[p_worker->WorkerQ_IxIn];
+    p_handoff->SockID     =  sock_id;
+    p_handoff->ClientAddr = *p_client_addr;
+
+    p_worker->WorkerQ_IxIn++;
+    if (p_worker->WorkerQ_IxIn >= p_worker->ConnNbrMax) {
+        p_worker->WorkerQ_IxIn = 0u;
+    }
+    p_worker->WorkerQ_Ctr++;
+    CPU_CRITICAL_EXIT();
+
+    HTTPsSock_InstanceWake(p_worker);                           /* Wake up worker.                                      */
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        HTTPsSock_ListenEvtSet()
+*
+* Description : Add or remove the instance listen socket(s) from the socket event backend.
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceStart().
+*
+*               en          DEF_YES, to wait for incoming connections.
+*                           DEF_NO,  otherwise.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPsSock_ConnSel().
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  HTTPsSock_ListenEvtSet (HTTPs_INSTANCE  *p_instance,
+                                      CPU_BOOLEAN      en)
+{
+    const  HTTPs_SOCK_EVT_API  *p_evt_api;
+
 
+    if (p_instance->WorkerParentPtr != DEF_NULL) {              /* Only the primary worker owns the listen sock(s).     */
+        return;
+    }
 
-                (void)NetSock_OptSet(sock_id,                   /* Set NO DELAY option.                                 */
-                                     NET_SOCK_PROTOCOL_TCP,
-                                     NET_SOCK_OPT_TCP_NO_DELAY,
-                            (void *)&flag,
-                                     sizeof(flag),
-                                    &err_net);
-                 if (err_net != NET_SOCK_ERR_NONE) {
-                     close_sock = DEF_YES;
-                     break;
-                 }
+    p_evt_api = p_instance->SockEvtAPI_Ptr;
 
-                                                                /* ----------------- CFG TCP CONN MSL ----------------- */
-                 conn_id_tcp = NetSock_GetConnTransportID(sock_id, &err_net);
+    switch (p_instance->CfgPtr->SockSel) {
+        case HTTPs_SOCK_SEL_IPv4:
+#ifdef NET_IPv4_MODULE_EN
+             p_evt_api->ListenSet(p_instance, p_instance->SockListenID_IPv4, en);
+#endif
+             break;
 
-                (void)NetTCP_ConnCfgMSL_Timeout(conn_id_tcp, 0u, &err_net);
-                 if (err_net != NET_TCP_ERR_NONE) {
-                     close_sock = DEF_YES;
-                     break;
-                 }
 
-                                                                /* --------------- ACQUIRE CONN STRUCT ---------------- */
-                 p_conn = HTTPsMem_ConnGet(p_instance,
-                                            sock_id,
-                                            client_addr);
-                 if (p_conn != DEF_NULL) {
-                     p_conn->State = HTTPs_CONN_STATE_REQ_INIT;
+        case HTTPs_SOCK_SEL_IPv6:
+#ifdef NET_IPv6_MODULE_EN
+             p_evt_api->ListenSet(p_instance, p_instance->SockListenID_IPv6, en);
+#endif
+             break;
 
-                 } else {                                       /* If no free conn struct avail...                      */
-                                                                /* ... close sock.                                      */
-                     HTTPs_ERR_INC(p_ctr_err->Conn_ErrNoneAvailCtr);
-                     close_sock = DEF_YES;
-                     break;
-                 }
-                 break;
 
-            case NET_INIT_ERR_NOT_COMPLETED:
-            case NET_SOCK_ERR_NONE_AVAIL:
-            case NET_SOCK_ERR_CONN_ACCEPT_Q_NONE_AVAIL:
-            case NET_SOCK_ERR_CONN_SIGNAL_TIMEOUT:
-            case NET_ERR_FAULT_LOCK_ACQUIRE:
-                 done = DEF_YES;
-                 break;
+        case HTTPs_SOCK_SEL_IPv4_IPv6:
+#ifdef NET_IPv4_MODULE_EN
+             p_evt_api->ListenSet(p_instance, p_instance->SockListenID_IPv4, en);
+#endif
+#ifdef NET_IPv6_MODULE_EN
+             p_evt_api->ListenSet(p_instance, p_instance->SockListenID_IPv6, en);
+#endif
+             break;
 
-            default:
-                 HTTPs_ERR_INC(p_ctr_err->Sock_ErrAcceptCtr);
-                 close_sock = DEF_YES;
-                 break;
+
+        default:
+             break;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        HTTPsSock_EvtSelInit()
+*
+* Description : Initialize the select socket event backend data of the instance.
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceInit().
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               HTTPs_ERR_NONE                      Backend successfully initialized.
+*                               HTTPs_ERR_INIT_POOL_MEM_NO_SPACE    Not enough memory for the backend data.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPs_InstanceInit() via 'HTTPsSock_EvtAPI_Sel'.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  HTTPsSock_EvtSelInit (HTTPs_INSTANCE  *p_instance,
+                                    HTTPs_ERR       *p_err)
+{
+    HTTPs_SOCK_EVT_SEL_DATA  *p_data;
+
+
+    p_data = (HTTPs_SOCK_EVT_SEL_DATA *)HTTPsMem_SockEvtDataGet(sizeof(HTTPs_SOCK_EVT_SEL_DATA), p_err);
+    if (*p_err != HTTPs_ERR_NONE) {
+        return;
+    }
+
+    Mem_Clr(p_data, sizeof(HTTPs_SOCK_EVT_SEL_DATA));
+
+    NET_SOCK_DESC_INIT(&p_data->DescRd);
+    NET_SOCK_DESC_INIT(&p_data->DescWr);
+    NET_SOCK_DESC_INIT(&p_data->DescErr);
+    NET_SOCK_DESC_INIT(&p_data->DescListen);
+
+    p_data->NbrMax             = 0u;
+    p_data->SelAbortSockID     = NET_SOCK_ID_NONE;
+    p_instance->SockEvtDataPtr = p_data;
+}
+
+
+/*
+*********************************************************************************************************
+*                                      HTTPsSock_EvtSelListenSet()
+*
+* Description : Add or remove a listen socket from the select socket event backend.
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceStart().
+*
+*               sock_id     Listen socket ID.
+*
+*               en          DEF_YES, to add    the listen socket.
+*                           DEF_NO,  to remove the listen socket.
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPsSock_ListenEvtSet() via 'HTTPsSock_EvtAPI_Sel'.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  HTTPsSock_EvtSelListenSet (HTTPs_INSTANCE  *p_instance,
+                                         NET_SOCK_ID      sock_id,
+                                         CPU_BOOLEAN      en)
+{
+    HTTPs_SOCK_EVT_SEL_DATA  *p_data;
+
+
+    if ((sock_id <  0) ||
+        (sock_id >= NET_SOCK_NBR_SOCK)) {
+        return;
+    }
+
+    p_data = (HTTPs_SOCK_EVT_SEL_DATA *)p_instance->SockEvtDataPtr;
+
+    if (en == DEF_YES) {
+        NET_SOCK_DESC_SET(sock_id, &p_data->DescRd);
+        NET_SOCK_DESC_SET(sock_id, &p_data->DescListen);
+        if (p_data->NbrMax <= sock_id) {                        /* Update highest sock nbr.                             */
+            p_data->NbrMax = sock_id + 1;
         }
+    } else {
+        NET_SOCK_DESC_CLR(sock_id, &p_data->DescRd);
+        NET_SOCK_DESC_CLR(sock_id, &p_data->DescListen);
+    }
+}
 
-        if ((close_sock == DEF_YES) &&
-            (sock_id != NET_SOCK_ID_NONE)) {
-            (void)NetSock_Close(sock_id, &err_net);
+
+/*
+*********************************************************************************************************
+*                                       HTTPsSock_EvtSelConnSet()
+*
+* Description : Set the socket events of interest of a connection in the select socket event backend.
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceStart().
+*
+*               p_conn      Pointer to the connection.
+*               ------      Argument validated in HTTPsSock_ConnAccept().
+*
+*               interest    Socket events of interest (see 'http-s.h  SOCKET EVENT BACKEND API DATA TYPE
+*                           Note #2').
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPsSock_ConnEvtUpdate(),
+*               HTTPsSock_ConnEvtRemove() via 'HTTPsSock_EvtAPI_Sel'.
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+static  void  HTTPsSock_EvtSelConnSet (HTTPs_INSTANCE  *p_instance,
+                                       HTTPs_CONN      *p_conn,
+                                       HTTPs_FLAGS      interest)
+{
+    HTTPs_SOCK_EVT_SEL_DATA  *p_data;
+    NET_SOCK_ID               sock_id;
+    CPU_BOOLEAN               is_set;
+
+
+    sock_id = p_conn->SockID;
+    if ((sock_id <  0) ||
+        (sock_id >= NET_SOCK_NBR_SOCK)) {
+        return;
+    }
+
+    p_data = (HTTPs_SOCK_EVT_SEL_DATA *)p_instance->SockEvtDataPtr;
+
+    is_set = DEF_BIT_IS_SET(interest, HTTPs_FLAG_SOCK_RDY_RD);
+    if (is_set == DEF_YES) {
+        NET_SOCK_DESC_SET(sock_id, &p_data->DescRd);
+    } else {
+        NET_SOCK_DESC_CLR(sock_id, &p_data->DescRd);
+    }
+
+    is_set = DEF_BIT_IS_SET(interest, HTTPs_FLAG_SOCK_RDY_WR);
+    if (is_set == DEF_YES) {
+        NET_SOCK_DESC_SET(sock_id, &p_data->DescWr);
+    } else {
+        NET_SOCK_DESC_CLR(sock_id, &p_data->DescWr);
+    }
+
+    is_set = DEF_BIT_IS_SET(interest, HTTPs_FLAG_SOCK_RDY_ERR);
+    if (is_set == DEF_YES) {
+        NET_SOCK_DESC_SET(sock_id, &p_data->DescErr);
+    } else {
+        NET_SOCK_DESC_CLR(sock_id, &p_data->DescErr);
+    }
+
+    if (interest == HTTPs_FLAG_NONE) {
+        p_data->ConnTbl[sock_id] = DEF_NULL;
+    } else {
+        p_data->ConnTbl[sock_id] = p_conn;
+        if (p_data->NbrMax <= sock_id) {                        /* Update highest sock nbr.                             */
+            p_data->NbrMax = sock_id + 1;
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         HTTPsSock_EvtSelWait()
+*
+* Description : (1) Wait for socket events with NetSock_Sel() & report the ready sockets:
+*
+*                   (a) Copy the registered socket descriptors
+*                   (b) Socket select
+*                   (c) Report ready listen & connection sockets
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceStart().
+*
+*               p_timeout   Pointer to the select timeout, DEF_NULL to wait indefinitely.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               HTTPs_ERR_NONE                  Socket events successfully waited.
+*                               HTTPs_ERR_SOCK_EVT_WAIT         Socket select failed.
+*
+* Return(s)   : Number of sockets ready.
+*
+* Caller(s)   : HTTPsSock_ConnSel() via 'HTTPsSock_EvtAPI_Sel'.
+*
+* Note(s)     : (2) NetSock_Sel() modifies the descriptors it receives, so the registered descriptors are
+*                   copied before each call instead of being rebuilt from the connection list.
+*
+*               (3) The descriptors scan stops as soon as all ready sockets returned by NetSock_Sel() have
+*                   been found.
+*
+*               (4) The socket that HTTPsSock_EvtSelWake() must abort is published under the conn sel abort
+*                   lock, together with a last check of the instance wake up request. A wake up requested
+*                   before that point is not waited for, one requested after it aborts NetSock_Sel().
+*********************************************************************************************************
+*/
+
+static  NET_SOCK_QTY  HTTPsSock_EvtSelWait (HTTPs_INSTANCE    *p_instance,
+                                            NET_SOCK_TIMEOUT  *p_timeout,
+                                            HTTPs_ERR         *p_err)
+{
+    HTTPs_SOCK_EVT_SEL_DATA  *p_data;
+    HTTPs_CONN               *p_conn;
+    NET_SOCK_DESC             sock_desc_rd;
+    NET_SOCK_DESC             sock_desc_wr;
+    NET_SOCK_DESC             sock_desc_err;
+    NET_SOCK_RTN_CODE         sel_rtn_code;
+    NET_SOCK_QTY              sock_nbr_rdy;
+    NET_SOCK_QTY              sock_nbr_rem;
+    NET_SOCK_ID               sock_id;
+    NET_SOCK_ID               sock_id_abort;
+    HTTPs_FLAGS               rdy_flags;
+    CPU_BOOLEAN               wake_req;
+    HTTPs_ERR                 err_lock;
+    NET_ERR                   err;
+
+
+    p_data = (HTTPs_SOCK_EVT_SEL_DATA *)p_instance->SockEvtDataPtr;
+
+                                                                /* ---------------- COPY SOCK DESC -------------------- */
+    Mem_Copy(&sock_desc_rd,  &p_data->DescRd,  sizeof(NET_SOCK_DESC));      /* See Note #2.                             */
+    Mem_Copy(&sock_desc_wr,  &p_data->DescWr,  sizeof(NET_SOCK_DESC));
+    Mem_Copy(&sock_desc_err, &p_data->DescErr, sizeof(NET_SOCK_DESC));
+
+                                                                /* ----------------- ARM WAIT ABORT ------------------- */
+    sock_id_abort = NET_SOCK_ID_NONE;
+    sock_id       = 0;
+    while ((sock_id_abort == NET_SOCK_ID_NONE) &&
+           (sock_id       <  p_data->NbrMax)) {
+        if ((NET_SOCK_DESC_IS_SET(sock_id, &sock_desc_rd)) ||
+            (NET_SOCK_DESC_IS_SET(sock_id, &sock_desc_wr)) ||
+            (NET_SOCK_DESC_IS_SET(sock_id, &sock_desc_err))) {
+            sock_id_abort = sock_id;
+        }
+        sock_id++;
+    }
+
+    wake_req = DEF_NO;
+    HTTPsTask_LockAcquire(p_instance->ConnSelAbortLockObj, &err_lock);
+    if (err_lock == HTTPs_ERR_NONE) {                           /* See Note #4.                                         */
+        wake_req = p_instance->WakeReq;
+        if (wake_req == DEF_NO) {
+            p_data->SelAbortSockID = sock_id_abort;
+        }
+        HTTPsTask_LockRelease(p_instance->ConnSelAbortLockObj);
+    }
+
+    if (wake_req == DEF_YES) {
+       *p_err = HTTPs_ERR_NONE;
+        return (0u);
+    }
+
+                                                                /* -------------------- SOCK SEL ---------------------- */
+    sel_rtn_code = NetSock_Sel(p_data->NbrMax,
+                              &sock_desc_rd,
+                              &sock_desc_wr,
+                              &sock_desc_err,
+                               p_timeout,
+                              &err);
+
+    HTTPsTask_LockAcquire(p_instance->ConnSelAbortLockObj, &err_lock);
+    if (err_lock == HTTPs_ERR_NONE) {
+        p_data->SelAbortSockID = NET_SOCK_ID_NONE;
+        HTTPsTask_LockRelease(p_instance->ConnSelAbortLockObj);
+    }
+
+    switch (err) {
+        case NET_SOCK_ERR_NONE:
+             break;
+
+
+        case NET_SOCK_ERR_TIMEOUT:
+            *p_err = HTTPs_ERR_NONE;
+             return (0u);
+
+
+        case NET_INIT_ERR_NOT_COMPLETED:
+        case NET_SOCK_ERR_INVALID_DESC:
+        case NET_SOCK_ERR_INVALID_TIMEOUT:
+        case NET_SOCK_ERR_INVALID_SOCK:
+        case NET_SOCK_ERR_INVALID_TYPE:
+        case NET_SOCK_ERR_NOT_USED:
+        case NET_ERR_FAULT_LOCK_ACQUIRE:
+        default:
+            *p_err = HTTPs_ERR_SOCK_EVT_WAIT;
+             return (0u);
+    }
+
+                                                                /* ---------------- REPORT RDY SOCK ------------------- */
+    sock_nbr_rdy = 0u;
+    sock_nbr_rem = (sel_rtn_code > 0) ? (NET_SOCK_QTY)sel_rtn_code : 0u;
+    sock_id      = 0;
+    while ((sock_nbr_rem >  0u) &&                              /* See Note #3.                                         */
+           (sock_id      <  p_data->NbrMax)) {
+        rdy_flags = HTTPs_FLAG_NONE;
+
+        if (NET_SOCK_DESC_IS_SET(sock_id, &sock_desc_rd)) {
+            DEF_BIT_SET(rdy_flags, HTTPs_FLAG_SOCK_RDY_RD);
+        }
+        if (NET_SOCK_DESC_IS_SET(sock_id, &sock_desc_wr)) {
+            DEF_BIT_SET(rdy_flags, HTTPs_FLAG_SOCK_RDY_WR);
+        }
+        if (NET_SOCK_DESC_IS_SET(sock_id, &sock_desc_err)) {
+            DEF_BIT_SET(rdy_flags, HTTPs_FLAG_SOCK_RDY_ERR);
+        }
+
+        if (rdy_flags != HTTPs_FLAG_NONE) {
+            sock_nbr_rem--;
+            sock_nbr_rdy++;
+
+            if (NET_SOCK_DESC_IS_SET(sock_id, &p_data->DescListen)) {
+                HTTPsSock_EvtListenRdy(p_instance, sock_id);    /* Accept new conn(s).                                  */
+
+            } else {
+                p_conn = p_data->ConnTbl[sock_id];
+                if (p_conn != DEF_NULL) {
+                    HTTPsSock_EvtConnRdy(p_instance, p_conn, rdy_flags);
+                }
+            }
         }
+
+        sock_id++;
+    }
+
+   *p_err = HTTPs_ERR_NONE;
+
+    return (sock_nbr_rdy);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        HTTPsSock_EvtSelWake()
+*
+* Description : Abort a pending NetSock_Sel() of the select socket event backend.
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceInit().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPsSock_InstanceWake() via 'HTTPsSock_EvtAPI_Sel'.
+*
+* Note(s)     : (1) NetSock_Sel() can only be aborted through one of the sockets it waits for. That socket
+*                   is published by HTTPsSock_EvtSelWait() for the time of the wait (see
+*                   HTTPsSock_EvtSelWait() Note #4). No socket is published when the instance task is not
+*                   waiting or waits without any socket, in which case the wait is bounded by its timeout.
+*
+*               (2) This function is called from a foreign task, so the published socket is only read under
+*                   the conn sel abort lock.
+*********************************************************************************************************
+*/
+
+static  void  HTTPsSock_EvtSelWake (HTTPs_INSTANCE  *p_instance)
+{
+    HTTPs_SOCK_EVT_SEL_DATA  *p_data;
+    HTTPs_ERR                 err_lock;
+    NET_ERR                   err;
+
+
+    p_data = (HTTPs_SOCK_EVT_SEL_DATA *)p_instance->SockEvtDataPtr;
+
+    HTTPsTask_LockAcquire(p_instance->ConnSelAbortLockObj, &err_lock);
+    if (err_lock != HTTPs_ERR_NONE) {                           /* See Note #2.                                         */
+        return;
+    }
+
+    if (p_data->SelAbortSockID != NET_SOCK_ID_NONE) {           /* See Note #1.                                         */
+        NetSock_SelAbort(p_data->SelAbortSockID, &err);
     }
+
+    HTTPsTask_LockRelease(p_instance->ConnSelAbortLockObj);
 }
@@ -52,6 +52,17 @@
 
 #include  "http-s.h"
 
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           GLOBAL VARIABLES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+extern  const  HTTPs_SOCK_EVT_API  HTTPsSock_EvtAPI_Sel;        /* Dflt socket event backend based on NetSock_Sel().    */
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -79,6 +90,39 @@ CPU_BOOLEAN   HTTPsSock_ConnDataTx   (       HTTPs_INSTANCE            *p_instan
 void          HTTPsSock_ConnClose    (       HTTPs_INSTANCE            *p_instance,
                                              HTTPs_CONN                *p_conn);
 
+void          HTTPsSock_ConnEvtUpdate(       HTTPs_INSTANCE            *p_instance,
+                                             HTTPs_CONN                *p_conn);
+
+void          HTTPsSock_ConnEvtPoll  (       HTTPs_INSTANCE            *p_instance,
+                                             HTTPs_CONN                *p_conn);
+
+void          HTTPsSock_ConnEvtRemove(       HTTPs_INSTANCE            *p_instance,
+                                             HTTPs_CONN                *p_conn);
+
+void          HTTPsSock_ConnOverloadInit(    HTTPs_INSTANCE            *p_instance);
+
+void          HTTPsSock_ConnTmrSet   (       HTTPs_INSTANCE            *p_instance,
+                                             HTTPs_CONN                *p_conn,
+                                             HTTPs_CONN_TMR_PHASE       phase);
+
+void          HTTPsSock_ConnTmrUpdate(       HTTPs_INSTANCE            *p_instance,
+                                             HTTPs_CONN                *p_conn);
+
+void          HTTPsSock_InstanceWake (       HTTPs_INSTANCE            *p_instance);
+
+HTTPs_CONN   *HTTPsSock_ConnRdyGet   (       HTTPs_INSTANCE            *p_instance);
+
+void          HTTPsSock_WorkerConnGet(       HTTPs_INSTANCE            *p_instance,
+                                             CPU_BOOLEAN                closed);
+
+                                                                /* Socket event backend callbacks.                      */
+void          HTTPsSock_EvtConnRdy   (       HTTPs_INSTANCE            *p_instance,
+                                             HTTPs_CONN                *p_conn,
+                                             HTTPs_FLAGS                rdy_flags);
+
+void          HTTPsSock_EvtListenRdy (       HTTPs_INSTANCE            *p_instance,
+                                             NET_SOCK_ID                sock_listen_id);
+
 
 /*
 *********************************************************************************************************
@@ -58,6 +58,7 @@
 #define  HTTPs_TASK_STR_NAME_LOCK                  "HTTP Instance Lock"
 #define  HTTPs_TASK_STR_NAME_SEM_STOP_REQ          "HTTP Instance Stop req"
 #define  HTTPs_TASK_STR_NAME_SEM_STOP_COMPLETED    "HTTP Instance Stop compl"
+#define  HTTPs_TASK_STR_NAME_SEM_WORKER_SIGNAL     "HTTP Instance Worker Signal"
 #define  HTTPs_TASK_STR_NAME_TMR                   "HTTP Conn Timeout"
 
 #define  HTTPs_OS_LOCK_ACQUIRE_FAIL_DLY_MS                    5u
@@ -208,6 +209,7 @@ void  HTTPsTask_LockRelease (KAL_LOCK_HANDLE  os_lock_obj)
 *                   (c) Acquire memory space for task stack
 *                   (d) Create semaphore for instance stop request
 *                   (e) Create semaphore for instance stop request completed
+*                   (f) Create semaphore for worker signal
 *
 *
 * Argument(s) : p_instance  Pointer to the instance.
@@ -283,6 +285,17 @@ void  HTTPsTask_InstanceObjInit (HTTPs_INSTANCE  *p_instance,
     }
 
 
+                                                                /* -------------- CREATE WORKER SIGNAL SEM ------------ */
+    p_os_task_obj->SemWorkerSignal = KAL_SemCreate(HTTPs_TASK_STR_NAME_SEM_WORKER_SIGNAL,
+                                                   DEF_NULL,
+                                                  &err_rtos);
+
+    if (err_rtos != RTOS_ERR_NONE) {
+       *p_err = HTTPs_ERR_TASK_SEM_CREATE;
+        goto exit;
+    }
+
+
    *p_err = HTTPs_ERR_NONE;
 
 exit:
@@ -290,6 +303,45 @@ exit:
 }
 
 
+/*
+*********************************************************************************************************
+*                                      HTTPsTask_InstanceObjDel()
+*
+* Description : Delete the OS objects of an instance that was initialized but never started.
+*
+* Argument(s) : p_instance  Pointer to the instance.
+*               ----------  Argument validated in HTTPs_InstanceInit().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPs_InstanceWorkerRelease().
+*
+*               This function is an INTERNAL HTTP server function & MUST NOT be called by application
+*               function(s).
+*
+* Note(s)     : (1) The task object & its stack are allocated from a memory segment & can't be freed. They are
+*                   lost with the instance.
+*********************************************************************************************************
+*/
+
+void  HTTPsTask_InstanceObjDel (HTTPs_INSTANCE  *p_instance)
+{
+    HTTPs_OS_TASK_OBJ  *p_os_task_obj;
+    RTOS_ERR            err_rtos;
+
+
+    p_os_task_obj = (HTTPs_OS_TASK_OBJ *)p_instance->OS_TaskObjPtr;
+
+    KAL_SemDel(p_os_task_obj->SemStopReq,       &err_rtos);
+    KAL_SemDel(p_os_task_obj->SemStopCompleted, &err_rtos);
+    KAL_SemDel(p_os_task_obj->SemWorkerSignal,  &err_rtos);
+
+    KAL_LockDel(p_instance->OS_LockObj, &err_rtos);
+
+   (void)err_rtos;                                              /* Ignore err(s).                                       */
+}
+
+
 /*
 *********************************************************************************************************
 *                                     HTTPsTask_InstanceTaskCreate()
@@ -588,6 +640,81 @@ void  HTTPsTask_InstanceStopCompletedPending (HTTPs_INSTANCE  *p_instance,
 }
 
 
+/*
+*********************************************************************************************************
+*                                        HTTPsTask_WorkerSignal()
+*
+* Description : Signal a worker that connection(s) have been handed to it or that it must stop.
+*
+* Argument(s) : p_instance  Pointer to the worker instance.
+*               ----------  Argument validated in HTTPs_InstanceInit().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPsSock_InstanceWake().
+*
+*               This function is an INTERNAL HTTP server function & MUST NOT be called by application
+*               function(s).
+*
+* Note(s)     : none.
+*********************************************************************************************************
+*/
+
+void  HTTPsTask_WorkerSignal (HTTPs_INSTANCE  *p_instance)
+{
+    HTTPs_OS_TASK_OBJ  *p_os_task_obj;
+    RTOS_ERR            err_rtos;
+
+
+    p_os_task_obj = (HTTPs_OS_TASK_OBJ *)p_instance->OS_TaskObjPtr;
+
+    KAL_SemPost(p_os_task_obj->SemWorkerSignal,
+                KAL_OPT_POST_NONE,
+               &err_rtos);
+
+   (void)err_rtos;                                              /* Ignore err(s).                                       */
+}
+
+
+/*
+*********************************************************************************************************
+*                                      HTTPsTask_WorkerSignalPend()
+*
+* Description : Wait until the worker is signaled.
+*
+* Argument(s) : p_instance  Pointer to the worker instance.
+*               ----------  Argument validated in HTTPs_InstanceInit().
+*
+* Return(s)   : none.
+*
+* Caller(s)   : HTTPsSock_ConnSel().
+*
+*               This function is an INTERNAL HTTP server function & MUST NOT be called by application
+*               function(s).
+*
+* Note(s)     : (1) A worker which is not the primary worker has no listen socket to wait on. When it has
+*                   no connection, it pends on its signal semaphore until the primary worker hands it a
+*                   connection or until the instance is stopped.
+*********************************************************************************************************
+*/
+
+void  HTTPsTask_WorkerSignalPend (HTTPs_INSTANCE  *p_instance)
+{
+    HTTPs_OS_TASK_OBJ  *p_os_task_obj;
+    RTOS_ERR            err_rtos;
+
+
+    p_os_task_obj = (HTTPs_OS_TASK_OBJ *)p_instance->OS_TaskObjPtr;
+
+    KAL_SemPend(p_os_task_obj->SemWorkerSignal,
+                KAL_OPT_PEND_BLOCKING,
+                0u,                                             /* Infinite timeout.                                    */
+               &err_rtos);
+
+   (void)err_rtos;                                              /* Ignore err(s), the caller re-evaluates its state.    */
+}
+
+
 /*
 *********************************************************************************************************
 *                                         HTTPsTask_TimeDly_ms()
@@ -772,30 +899,32 @@ static  void  HTTPsTask_InstanceTaskHandler (HTTPs_INSTANCE  *p_instance)
             if (closed == DEF_NO) {                             /* If not closed.                                       */
 
                                                                 /* ---------------- CLOSE LISTEN SOCK ----------------- */
-                switch (p_cfg->SockSel) {
-                    case HTTPs_SOCK_SEL_IPv4:
+                if (p_instance->WorkerParentPtr == DEF_NULL) {  /* Only the primary worker owns the listen sock(s).     */
+                    switch (p_cfg->SockSel) {
+                        case HTTPs_SOCK_SEL_IPv4:
 #ifdef   NET_IPv4_MODULE_EN
-                         HTTPsSock_ListenClose(p_instance, p_instance->SockListenID_IPv4);
+                             HTTPsSock_ListenClose(p_instance, p_instance->SockListenID_IPv4);
 #endif
-                         break;
+                             break;
 
-                    case HTTPs_SOCK_SEL_IPv6:
+                        case HTTPs_SOCK_SEL_IPv6:
 #ifdef   NET_IPv6_MODULE_EN
-                         HTTPsSock_ListenClose(p_instance, p_instance->SockListenID_IPv6);
+                             HTTPsSock_ListenClose(p_instance, p_instance->SockListenID_IPv6);
 #endif
-                         break;
+                             break;
 
-                    case HTTPs_SOCK_SEL_IPv4_IPv6:
+                        case HTTPs_SOCK_SEL_IPv4_IPv6:
 #ifdef   NET_IPv4_MODULE_EN
-                         HTTPsSock_ListenClose(p_instance, p_instance->SockListenID_IPv4);
+                             HTTPsSock_ListenClose(p_instance, p_instance->SockListenID_IPv4);
 #endif
 #ifdef   NET_IPv6_MODULE_EN
-                         HTTPsSock_ListenClose(p_instance, p_instance->SockListenID_IPv6);
+                             HTTPsSock_ListenClose(p_instance, p_instance->SockListenID_IPv6);
 #endif
-                         break;
+                             break;
 
-                    default:
-                        break;
+                        default:
+                            break;
+                    }
                 }
                                                                     /* Close listen sock: discard incoming conn.        */
                 closed = DEF_YES;
@@ -809,6 +938,11 @@ static  void  HTTPsTask_InstanceTaskHandler (HTTPs_INSTANCE  *p_instance)
             }
         }
 
+                                                                /* -------------- GET HANDED OFF CONN(S) -------------- */
+        if (p_instance->WorkerParentPtr != DEF_NULL) {          /* Conn(s) accepted by the primary worker.              */
+            HTTPsSock_WorkerConnGet(p_instance, closed);
+        }
+
                                                                 /* ----------------- PROCESS CONN RDY ----------------- */
         if (sock_nbr_rdy > 0) {
             HTTPsConn_Process(p_instance);
@@ -72,6 +72,8 @@ void                 HTTPsTask_LockRelease                  (KAL_LOCK_HANDLE
 void                 HTTPsTask_InstanceObjInit              (HTTPs_INSTANCE            *p_instance,
                                                              HTTPs_ERR                 *p_err);
 
+void                 HTTPsTask_InstanceObjDel               (HTTPs_INSTANCE            *p_instance);
+
 void                 HTTPsTask_InstanceTaskCreate           (HTTPs_INSTANCE            *p_instance,
                                                              HTTPs_ERR                 *p_err);
 
@@ -87,6 +89,10 @@ void                 HTTPsTask_InstanceStopCompletedSignal  (HTTPs_INSTANCE
 void                 HTTPsTask_InstanceStopCompletedPending (HTTPs_INSTANCE            *p_instance,
                                                              HTTPs_ERR                 *p_err);
 
+void                 HTTPsTask_WorkerSignal                 (HTTPs_INSTANCE            *p_instance);
+
+void                 HTTPsTask_WorkerSignalPend             (HTTPs_INSTANCE            *p_instance);
+
 void                 HTTPsTask_TimeDly_ms                   (CPU_INT32U                 time_dly_ms);
 
 